@@ -26,7 +26,6 @@
 #include "commsdsl/gen/util.h"
 
 #include <cassert>
-#include <fstream>
 
 namespace comms = commsdsl::gen::comms;
 namespace strings = commsdsl::gen::strings;
@@ -51,12 +50,6 @@ bool CCmake::cWriteInternal() const
     }
 
     m_cGenerator.genLogger().genInfo("Generating " + filePath);
-    std::ofstream stream(filePath);
-    if (!stream) {
-        m_cGenerator.genLogger().genError("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
-
     const std::string Templ =
         "cmake_minimum_required (VERSION 3.12)\n"
         "project (#^#PROJ_NAME#$#_c)\n\n"
@@ -225,10 +218,7 @@ bool CCmake::cWriteInternal() const
     };
 
     auto str = commsdsl::gen::util::genProcessTemplate(Templ, repl, true);
-    stream << str;
-    stream.flush();
-    if (!stream.good()) {
-        m_cGenerator.genLogger().genError("Failed to write " + filePath + ".");
+    if (!m_cGenerator.genWriteFile(filePath, str)) {
         return false;
     }
 
@@ -27,7 +27,6 @@
 
 #include <algorithm>
 #include <cassert>
-#include <fstream>
 
 namespace comms = commsdsl::gen::comms;
 namespace strings = commsdsl::gen::strings;
@@ -55,17 +54,7 @@ bool cWriteFileInternal(const std::string& name, const std::string& str, CGenera
         return false;
     }
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        generator.genLogger().genError("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
-
-    stream << str;
-    stream.flush();
-
-    if (!stream.good()) {
-        generator.genLogger().genError("Failed to write \"" + filePath + "\".");
+    if (!generator.genWriteFile(filePath, str)) {
         return false;
     }
     return true;
@@ -23,7 +23,7 @@
 #include "commsdsl/gen/comms.h"
 
 #include <cassert>
-#include <fstream>
+#include <sstream>
 
 namespace util = commsdsl::gen::util;
 namespace comms = commsdsl::gen::comms;
@@ -83,11 +83,7 @@ bool CErrorStatus::cWriteHeaderInternal()
         return false;
     }
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        m_cGenerator.genLogger().genError("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
+    std::ostringstream stream;
 
     const std::string Templ =
         "#^#GENERATED#$#\n"
@@ -122,9 +118,7 @@ bool CErrorStatus::cWriteHeaderInternal()
     };
 
     stream << util::genProcessTemplate(Templ, repl, true);
-    stream.flush();
-    if (!stream.good()) {
-        m_cGenerator.genLogger().genError("Failed to write \"" + filePath + "\".");
+    if (!m_cGenerator.genWriteFile(filePath, stream.str())) {
         return false;
     }
 
@@ -142,12 +136,6 @@ bool CErrorStatus::cWriteSourceInternal()
         return false;
     }
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        m_cGenerator.genLogger().genError("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
-
     const std::string Templ =
         "#^#GENERATED#$#\n"
         "#include \"#^#HEADER#$#\"\n\n"
@@ -180,10 +168,7 @@ bool CErrorStatus::cWriteSourceInternal()
         {"HEADER", cRelHeader(m_cGenerator)},
     };
 
-    stream << util::genProcessTemplate(Templ, repl, true);
-    stream.flush();
-    if (!stream.good()) {
-        m_cGenerator.genLogger().genError("Failed to write \"" + filePath + "\".");
+    if (!m_cGenerator.genWriteFile(filePath, util::genProcessTemplate(Templ, repl, true))) {
         return false;
     }
 
@@ -29,7 +29,6 @@
 #include "commsdsl/gen/util.h"
 
 #include <cassert>
-#include <fstream>
 
 namespace comms = commsdsl::gen::comms;
 namespace strings = commsdsl::gen::strings;
@@ -576,12 +575,6 @@ bool CField::cWriteHeaderInternal() const
     auto& logger = generator.genLogger();
     logger.genInfo("Generating " + filePath);
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        logger.genError("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
-
     static const std::string Templ =
         "#^#GENERATED#$#\n\n"
         "#pragma once\n\n"
@@ -601,9 +594,7 @@ bool CField::cWriteHeaderInternal() const
         {"CPP_GUARD_END", CGenerator::cCppGuardEnd()},
     };
 
-    stream << util::genProcessTemplate(Templ, repl, true);
-    stream.flush();
-    return stream.good();
+    return generator.genWriteFile(filePath, util::genProcessTemplate(Templ, repl, true));
 }
 
 bool CField::cWriteSrcInternal() const
@@ -619,12 +610,6 @@ bool CField::cWriteSrcInternal() const
     auto& logger = generator.genLogger();
     logger.genInfo("Generating " + filePath);
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        logger.genError("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
-
     static const std::string Templ =
         "#^#GENERATED#$#\n\n"
         "#include \"#^#HEADER#$#\"\n\n"
@@ -641,9 +626,7 @@ bool CField::cWriteSrcInternal() const
         {"APPEND", generator.genReadCodeInjectCode(generator.cInputRelSourceFor(m_genField) + strings::genAppendFileSuffixStr(), "Append here")},
     };
 
-    stream << util::genProcessTemplate(Templ, repl, true);
-    stream.flush();
-    return stream.good();
+    return generator.genWriteFile(filePath, util::genProcessTemplate(Templ, repl, true));
 }
 
 bool CField::cWriteCommsHeaderInternal() const
@@ -659,12 +642,6 @@ bool CField::cWriteCommsHeaderInternal() const
     auto& logger = generator.genLogger();
     logger.genInfo("Generating " + filePath);
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        logger.genError("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
-
     static const std::string Templ =
         "#^#GENERATED#$#\n\n"
         "#pragma once\n\n"
@@ -678,9 +655,7 @@ bool CField::cWriteCommsHeaderInternal() const
         {"CODE", cCommsHeaderCode()},
     };
 
-    stream << util::genProcessTemplate(Templ, repl, true);
-    stream.flush();
-    return stream.good();
+    return generator.genWriteFile(filePath, util::genProcessTemplate(Templ, repl, true));
 }
 
 std::string CField::cHeaderIncludesInternal() const
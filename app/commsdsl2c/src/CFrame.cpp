@@ -29,7 +29,6 @@
 
 #include <algorithm>
 #include <cassert>
-#include <fstream>
 
 namespace comms = commsdsl::gen::comms;
 namespace strings = commsdsl::gen::strings;
@@ -168,12 +167,6 @@ bool CFrame::cWriteHeaderInternal() const
     auto& logger = cGenerator.genLogger();
     logger.genInfo("Generating " + filePath);
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        logger.genError("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
-
     static const std::string Templ =
         "#^#GENERATED#$#\n"
         "#pragma once\n\n"
@@ -195,9 +188,7 @@ bool CFrame::cWriteHeaderInternal() const
         {"APPEND", cGenerator.genReadCodeInjectCode(cGenerator.cInputRelHeaderFor(*this) + strings::genAppendFileSuffixStr(), "Append here")},
     };
 
-    stream << util::genProcessTemplate(Templ, repl, true);
-    stream.flush();
-    return stream.good();
+    return cGenerator.genWriteFile(filePath, util::genProcessTemplate(Templ, repl, true));
 }
 
 bool CFrame::cWriteSourceInternal() const
@@ -213,12 +204,6 @@ bool CFrame::cWriteSourceInternal() const
     auto& logger = cGenerator.genLogger();
     logger.genInfo("Generating " + filePath);
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        logger.genError("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
-
     static const std::string Templ =
         "#^#GENERATED#$#\n\n"
         "#include \"#^#HEADER#$#\"\n\n"
@@ -237,9 +222,7 @@ bool CFrame::cWriteSourceInternal() const
         {"APPEND", cGenerator.genReadCodeInjectCode(cGenerator.cInputRelSourceFor(*this) + strings::genAppendFileSuffixStr(), "Append here")},
     };
 
-    stream << util::genProcessTemplate(Templ, repl, true);
-    stream.flush();
-    return stream.good();
+    return cGenerator.genWriteFile(filePath, util::genProcessTemplate(Templ, repl, true));
 }
 
 bool CFrame::cWriteCommsHeaderInternal() const
@@ -255,12 +238,6 @@ bool CFrame::cWriteCommsHeaderInternal() const
     auto& logger = cGenerator.genLogger();
     logger.genInfo("Generating " + filePath);
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        logger.genError("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
-
     static const std::string Templ =
         "#^#GENERATED#$#\n\n"
         "#^#INCLUDES#$#\n"
@@ -275,9 +252,7 @@ bool CFrame::cWriteCommsHeaderInternal() const
         {"FRAME", cCommsHeaderFrameCodeInternal()},
     };
 
-    stream << util::genProcessTemplate(Templ, repl, true);
-    stream.flush();
-    return stream.good();
+    return cGenerator.genWriteFile(filePath, util::genProcessTemplate(Templ, repl, true));
 }
 
 std::string CFrame::cHeaderIncludesInternal() const
@@ -560,7 +535,25 @@ std::string CFrame::cSourceFrameCodeInternal() const
         "        return 0U;\n"
         "    }\n\n"
         "    #^#COMMS_HANDLER#$# commsHandler(*handler, userData);\n"
-        "    return comms::processAllWithDispatch(buf, bufSize, *(fromFrameHandle(frame)), commsHandler);\n"
+        "    auto& commsFrame = *fromFrameHandle(frame);\n"
+        "    using CommsFrame = typename std::decay<decltype(commsFrame)>::type;\n\n"
+        "    std::size_t consumed = 0U;\n"
+        "    while (consumed < bufSize) {\n"
+        "        auto begIter = buf + consumed;\n"
+        "        auto iter = begIter;\n"
+        "        auto len = bufSize - consumed;\n\n"
+        "        CommsFrame::MsgPtr msg;\n"
+        "        auto es = comms::processSingleWithDispatch(iter, len, commsFrame, msg, commsHandler);\n"
+        "        if (es == comms::ErrorStatus::NotEnoughData) {\n"
+        "            break;\n"
+        "        }\n\n"
+        "        if (es == comms::ErrorStatus::ProtocolError) {\n"
+        "            consumed += CommsFrame::resyncOffset(begIter, len);\n"
+        "            continue;\n"
+        "        }\n\n"
+        "        consumed += static_cast<decltype(consumed)>(std::distance(begIter, iter));\n"
+        "    }\n"
+        "    return consumed;\n"
         "}\n"
         "\n"
         "size_t #^#NAME#$#_processInputDataSingleMsg(\n"
@@ -596,7 +589,7 @@ std::string CFrame::cSourceFrameCodeInternal() const
         "            return consumed;\n"
         "        }\n\n"
         "        if (es == comms::ErrorStatus::ProtocolError) {\n"
-        "            ++consumed;\n"
+        "            consumed += CommsFrame::resyncOffset(begIter, len);\n"
         "            continue;\n"
         "        }\n\n"
         "        if (frameValues != nullptr) {\n"
@@ -27,7 +27,6 @@
 #include "commsdsl/gen/comms.h"
 
 #include <cassert>
-#include <fstream>
 
 namespace util = commsdsl::gen::util;
 namespace comms = commsdsl::gen::comms;
@@ -71,12 +70,6 @@ bool CInputMessages::cWrite() const
         return false;
     }
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        m_cGenerator.genLogger().genError("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
-
     const std::string Templ =
         "#^#GENERATED#$#\n"
         "#pragma once\n\n"
@@ -101,10 +94,7 @@ bool CInputMessages::cWrite() const
         {"DEF", cInputDefInternal()},
     };
 
-    stream << util::genProcessTemplate(Templ, repl, true);
-    stream.flush();
-    if (!stream.good()) {
-        m_cGenerator.genLogger().genError("Failed to write \"" + filePath + "\".");
+    if (!m_cGenerator.genWriteFile(filePath, util::genProcessTemplate(Templ, repl, true))) {
         return false;
     }
 
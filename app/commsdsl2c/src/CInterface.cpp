@@ -27,7 +27,6 @@
 #include "commsdsl/gen/util.h"
 
 #include <cassert>
-#include <fstream>
 
 namespace comms = commsdsl::gen::comms;
 namespace strings = commsdsl::gen::strings;
@@ -143,12 +142,6 @@ bool CInterface::cWriteHeaderInternal() const
     auto& logger = cGenerator.genLogger();
     logger.genInfo("Generating " + filePath);
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        logger.genError("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
-
     static const std::string Templ =
         "#^#GENERATED#$#\n"
         "#pragma once\n\n"
@@ -170,9 +163,7 @@ bool CInterface::cWriteHeaderInternal() const
         {"APPEND", cGenerator.genReadCodeInjectCode(cGenerator.cInputRelHeaderFor(*this) + strings::genAppendFileSuffixStr(), "Append here")},
     };
 
-    stream << util::genProcessTemplate(Templ, repl, true);
-    stream.flush();
-    return stream.good();
+    return cGenerator.genWriteFile(filePath, util::genProcessTemplate(Templ, repl, true));
 }
 
 bool CInterface::cWriteSourceInternal() const
@@ -188,12 +179,6 @@ bool CInterface::cWriteSourceInternal() const
     auto& logger = cGenerator.genLogger();
     logger.genInfo("Generating " + filePath);
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        logger.genError("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
-
     static const std::string Templ =
         "#^#GENERATED#$#\n"
         "#include \"#^#HEADER#$#\"\n\n"
@@ -212,9 +197,7 @@ bool CInterface::cWriteSourceInternal() const
         {"APPEND", cGenerator.genReadCodeInjectCode(cGenerator.cInputRelSourceFor(*this) + strings::genAppendFileSuffixStr(), "Append here")},
     };
 
-    stream << util::genProcessTemplate(Templ, repl, true);
-    stream.flush();
-    return stream.good();
+    return cGenerator.genWriteFile(filePath, util::genProcessTemplate(Templ, repl, true));
 }
 
 bool CInterface::cWriteCommsHeaderInternal() const
@@ -230,12 +213,6 @@ bool CInterface::cWriteCommsHeaderInternal() const
     auto& logger = cGenerator.genLogger();
     logger.genInfo("Generating " + filePath);
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        logger.genError("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
-
     static const std::string Templ =
         "#^#GENERATED#$#\n"
         "#pragma once\n\n"
@@ -304,9 +281,7 @@ bool CInterface::cWriteCommsHeaderInternal() const
         {"HANDLER", handler->cCommsTypeName()},
     };
 
-    stream << util::genProcessTemplate(Templ, repl, true);
-    stream.flush();
-    return stream.good();
+    return cGenerator.genWriteFile(filePath, util::genProcessTemplate(Templ, repl, true));
 }
 
 std::string CInterface::cHeaderIncludesInternal() const
@@ -29,7 +29,6 @@
 #include "commsdsl/gen/util.h"
 
 #include <cassert>
-#include <fstream>
 
 namespace comms = commsdsl::gen::comms;
 namespace strings = commsdsl::gen::strings;
@@ -137,12 +136,6 @@ bool CMessage::cWriteHeaderInternal() const
     auto& logger = cGenerator.genLogger();
     logger.genInfo("Generating " + filePath);
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        logger.genError("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
-
     static const std::string Templ =
         "#^#GENERATED#$#\n"
         "#pragma once\n\n"
@@ -164,9 +157,7 @@ bool CMessage::cWriteHeaderInternal() const
         {"APPEND", cGenerator.genReadCodeInjectCode(cGenerator.cInputRelHeaderFor(*this) + strings::genAppendFileSuffixStr(), "Append here")},
     };
 
-    stream << util::genProcessTemplate(Templ, repl, true);
-    stream.flush();
-    return stream.good();
+    return cGenerator.genWriteFile(filePath, util::genProcessTemplate(Templ, repl, true));
 }
 
 bool CMessage::cWriteSourceInternal() const
@@ -182,12 +173,6 @@ bool CMessage::cWriteSourceInternal() const
     auto& logger = cGenerator.genLogger();
     logger.genInfo("Generating " + filePath);
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        logger.genError("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
-
     static const std::string Templ =
         "#^#GENERATED#$#\n"
         "#include \"#^#HEADER#$#\"\n\n"
@@ -206,9 +191,7 @@ bool CMessage::cWriteSourceInternal() const
         {"APPEND", cGenerator.genReadCodeInjectCode(cGenerator.cInputRelSourceFor(*this) + strings::genAppendFileSuffixStr(), "Append here")},
     };
 
-    stream << util::genProcessTemplate(Templ, repl, true);
-    stream.flush();
-    return stream.good();
+    return cGenerator.genWriteFile(filePath, util::genProcessTemplate(Templ, repl, true));
 }
 
 bool CMessage::cWriteCommsHeaderInternal() const
@@ -224,12 +207,6 @@ bool CMessage::cWriteCommsHeaderInternal() const
     auto& logger = cGenerator.genLogger();
     logger.genInfo("Generating " + filePath);
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        logger.genError("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
-
     static const std::string Templ =
         "#^#GENERATED#$#\n"
         "#pragma once\n\n"
@@ -246,9 +223,7 @@ bool CMessage::cWriteCommsHeaderInternal() const
         {"CODE", cCommsHeaderCodeInternal()},
     };
 
-    stream << util::genProcessTemplate(Templ, repl, true);
-    stream.flush();
-    return stream.good();
+    return cGenerator.genWriteFile(filePath, util::genProcessTemplate(Templ, repl, true));
 }
 
 std::string CMessage::cHeaderIncludesInternal() const
@@ -29,7 +29,6 @@
 
 #include <algorithm>
 #include <cassert>
-#include <fstream>
 #include <limits>
 
 namespace util = commsdsl::gen::util;
@@ -102,12 +101,6 @@ bool CMsgHandler::cWriteHeaderInternal() const
         return false;
     }
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        m_cGenerator.genLogger().genError("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
-
     const std::string Templ =
         "#^#GENERATED#$#\n"
         "#pragma once\n\n"
@@ -131,10 +124,7 @@ bool CMsgHandler::cWriteHeaderInternal() const
         {"NAME", cName()},
     };
 
-    stream << util::genProcessTemplate(Templ, repl, true);
-    stream.flush();
-    if (!stream.good()) {
-        m_cGenerator.genLogger().genError("Failed to write \"" + filePath + "\".");
+    if (!m_cGenerator.genWriteFile(filePath, util::genProcessTemplate(Templ, repl, true))) {
         return false;
     }
 
@@ -153,12 +143,6 @@ bool CMsgHandler::cWriteSourceInternal() const
         return false;
     }
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        m_cGenerator.genLogger().genError("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
-
     const std::string Templ =
         "#^#GENERATED#$#\n"
         "#include \"#^#COMMS_HEADER#$#\"\n\n"
@@ -173,10 +157,7 @@ bool CMsgHandler::cWriteSourceInternal() const
         {"FUNCS", cCommsSourceFuncsInternal()},
     };
 
-    stream << util::genProcessTemplate(Templ, repl, true);
-    stream.flush();
-    if (!stream.good()) {
-        m_cGenerator.genLogger().genError("Failed to write \"" + filePath + "\".");
+    if (!m_cGenerator.genWriteFile(filePath, util::genProcessTemplate(Templ, repl, true))) {
         return false;
     }
 
@@ -195,12 +176,6 @@ bool CMsgHandler::cWriteCommsHeaderInternal() const
         return false;
     }
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        m_cGenerator.genLogger().genError("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
-
     const std::string Templ =
         "#^#GENERATED#$#\n"
         "#pragma once\n\n"
@@ -225,10 +200,7 @@ bool CMsgHandler::cWriteCommsHeaderInternal() const
         {"FUNCS", cCommsHeaderFuncsInternal()},
     };
 
-    stream << util::genProcessTemplate(Templ, repl, true);
-    stream.flush();
-    if (!stream.good()) {
-        m_cGenerator.genLogger().genError("Failed to write \"" + filePath + "\".");
+    if (!m_cGenerator.genWriteFile(filePath, util::genProcessTemplate(Templ, repl, true))) {
         return false;
     }
 
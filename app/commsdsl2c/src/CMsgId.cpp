@@ -27,7 +27,6 @@
 
 #include <algorithm>
 #include <cassert>
-#include <fstream>
 #include <limits>
 
 namespace util = commsdsl::gen::util;
@@ -65,12 +64,6 @@ bool CMsgId::cWrite() const
         return false;
     }
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        m_cGenerator.genLogger().genError("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
-
     const std::string Templ =
         "#^#GENERATED#$#\n"
         "#pragma once\n\n"
@@ -91,10 +84,7 @@ bool CMsgId::cWrite() const
         {"NAME", cName()},
     };
 
-    stream << util::genProcessTemplate(Templ, repl, true);
-    stream.flush();
-    if (!stream.good()) {
-        m_cGenerator.genLogger().genError("Failed to write \"" + filePath + "\".");
+    if (!m_cGenerator.genWriteFile(filePath, util::genProcessTemplate(Templ, repl, true))) {
         return false;
     }
 
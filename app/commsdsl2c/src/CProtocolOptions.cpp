@@ -24,7 +24,6 @@
 
 #include <algorithm>
 #include <cassert>
-#include <fstream>
 #include <limits>
 
 namespace util = commsdsl::gen::util;
@@ -101,12 +100,6 @@ bool CProtocolOptions::cWriteHeaderInternal()
         return false;
     }
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        m_cGenerator.genLogger().genError("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
-
     const std::string Templ =
         "#^#GENERATED#$#\n"
         "#^#INCLUDES#$#\n"
@@ -119,10 +112,7 @@ bool CProtocolOptions::cWriteHeaderInternal()
         {"DEF", cTypeDefInternal()}
     };
 
-    stream << util::genProcessTemplate(Templ, repl, true);
-    stream.flush();
-    if (!stream.good()) {
-        m_cGenerator.genLogger().genError("Failed to write \"" + filePath + "\".");
+    if (!m_cGenerator.genWriteFile(filePath, util::genProcessTemplate(Templ, repl, true))) {
         return false;
     }
 
@@ -24,7 +24,6 @@
 #include "commsdsl/gen/comms.h"
 
 #include <cassert>
-#include <fstream>
 
 namespace comms = commsdsl::gen::comms;
 namespace strings = commsdsl::gen::strings;
@@ -51,12 +50,6 @@ bool CVersion::cWriteHeaderInternal() const
     auto filePath = m_cGenerator.cAbsRootHeaderFor(strings::genVersionFileNameStr());
 
     m_cGenerator.genLogger().genInfo("Generating " + filePath);
-    std::ofstream stream(filePath);
-    if (!stream) {
-        m_cGenerator.genLogger().genError("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
-
     const std::string Templ =
         "#^#GENERATED#$#\n"
         "#pragma once\n\n"
@@ -73,11 +66,7 @@ bool CVersion::cWriteHeaderInternal() const
         {"APPEND", m_cGenerator.genReadCodeInjectCode(m_cGenerator.cInputRelRootHeaderFor(strings::genVersionFileNameStr()) + strings::genAppendFileSuffixStr(), "Append here")},
     };
 
-    stream << util::genProcessTemplate(Templ, repl, true);
-    stream.flush();
-
-    if (!stream.good()) {
-        m_cGenerator.genLogger().genError("Failed to write \"" + filePath + "\".");
+    if (!m_cGenerator.genWriteFile(filePath, util::genProcessTemplate(Templ, repl, true))) {
         return false;
     }
 
@@ -89,12 +78,6 @@ bool CVersion::cWriteCommsHeaderInternal() const
     auto filePath = m_cGenerator.cAbsRootCommsHeaderFor(strings::genVersionFileNameStr());
 
     m_cGenerator.genLogger().genInfo("Generating " + filePath);
-    std::ofstream stream(filePath);
-    if (!stream) {
-        m_cGenerator.genLogger().genError("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
-
     const std::string Templ =
         "#^#GENERATED#$#\n"
         "#pragma once\n\n"
@@ -118,11 +101,7 @@ bool CVersion::cWriteCommsHeaderInternal() const
         {"NS", util::genStrToUpper(m_cGenerator.genProtocolSchema().genMainNamespace())},
     };
 
-    stream << util::genProcessTemplate(Templ, repl, true);
-    stream.flush();
-
-    if (!stream.good()) {
-        m_cGenerator.genLogger().genError("Failed to write \"" + filePath + "\".");
+    if (!m_cGenerator.genWriteFile(filePath, util::genProcessTemplate(Templ, repl, true))) {
         return false;
     }
 
@@ -17,6 +17,8 @@
 #include "CGenerator.h"
 #include "CProgramOptions.h"
 
+#include "commsdsl/gen/GenWatcher.h"
+
 #include <cassert>
 #include <iostream>
 #include <stdexcept>
@@ -27,8 +29,7 @@ int main(int argc, const char* argv[])
         commsdsl2c::CProgramOptions options;
         options.genParse(argc, argv);
 
-        commsdsl2c::CGenerator generator;
-        return generator.genExec(options);
+        return commsdsl::gen::GenWatcher::genRun<commsdsl2c::CGenerator>(options);
     }
     catch (const std::exception& e) {
         std::cerr << "Unhandled exception: " << e.what() << std::endl;
@@ -382,6 +382,51 @@ bool CommsBundleField::commsPrepareInternal()
     return true;
 }
 
+std::string CommsBundleField::commsDefSkipFuncBodyImpl() const
+{
+    auto hasLengthMember =
+        std::any_of(
+            m_commsMembers.begin(), m_commsMembers.end(),
+            [](auto* m) {
+                assert(m != nullptr);
+                return m->commsGenField().genParseObj().parseSemanticType() == ParseField::ParseSemanticType::Length;
+            });
+
+    if (commsHasGeneratedReadCode() || hasLengthMember) {
+        return strings::genEmptyString();
+    }
+
+    static const std::string MemTempl =
+        "es = Field_#^#NAME#$#::skip(buf + total, len - total, memLen);\n"
+        "if (es != comms::ErrorStatus::Success) {\n"
+        "    return es;\n"
+        "}\n\n"
+        "total += memLen;\n";
+
+    util::GenStringsList skips;
+    for (auto* m : m_commsMembers) {
+        util::GenReplacementMap memRepl = {
+            {"NAME", comms::genAccessName(m->commsGenField().genParseObj().parseName())},
+        };
+
+        skips.push_back(util::genProcessTemplate(MemTempl, memRepl));
+    }
+
+    static const std::string Templ =
+        "std::size_t total = 0U;\n"
+        "std::size_t memLen = 0U;\n"
+        "auto es = comms::ErrorStatus::Success;\n"
+        "#^#SKIPS#$#\n"
+        "consumed = total;\n"
+        "return es;";
+
+    util::GenReplacementMap repl = {
+        {"SKIPS", util::genStrListToString(skips, "\n", "")},
+    };
+
+    return util::genProcessTemplate(Templ, repl);
+}
+
 bool CommsBundleField::commsIsVersionDependentImpl() const
 {
     return
@@ -60,6 +60,7 @@ protected:
     virtual std::string commsDefReadFuncBodyImpl() const override;
     virtual std::string commsDefRefreshFuncBodyImpl() const override;
     virtual std::string commsDefValidFuncBodyImpl() const override;
+    virtual std::string commsDefSkipFuncBodyImpl() const override;
     virtual bool commsIsVersionDependentImpl() const override;
     virtual std::string commsMembersCustomizationOptionsBodyImpl(CommsFieldOptsFunc fieldOptsFunc) const override;
     virtual std::size_t commsMinLengthImpl() const override;
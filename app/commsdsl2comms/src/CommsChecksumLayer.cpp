@@ -16,6 +16,7 @@
 
 #include "CommsChecksumLayer.h"
 
+#include "CommsFastChecksum.h"
 #include "CommsGenerator.h"
 
 #include "commsdsl/gen/comms.h"
@@ -39,6 +40,66 @@ CommsChecksumLayer::CommsChecksumLayer(CommsGenerator& generator, ParseLayer par
 {
 }
 
+std::string CommsChecksumLayer::commsDefAlg(const std::string& fieldType) const
+{
+    const std::string ClassMap[] = {
+        /* Custom */ strings::genEmptyString(),
+        /* Sum */ "BasicSum",
+        /* Crc_CCITT */ "Crc_CCITT",
+        /* Crc_16 */ "Crc_16",
+        /* Crc_32 */ "Crc_32",
+        /* Xor */ "BasicXor",
+    };
+
+    const std::size_t ClassMapSize = std::extent<decltype(ClassMap)>::value;
+    static_assert(ClassMapSize == static_cast<std::size_t>(commsdsl::parse::ParseChecksumLayer::ParseAlg::NumOfValues),
+            "Invalid map");
+
+    auto obj = genChecksumDslObj();
+    auto alg = obj.parseAlg();
+    auto idx = static_cast<std::size_t>(alg);
+
+    if (ClassMapSize <= idx) {
+        [[maybe_unused]] static constexpr bool Should_not_happen = false;
+        assert(Should_not_happen);
+        idx = 0U;
+    }
+
+    if (ClassMap[idx].empty()) {
+        assert(!obj.parseCustomAlgName().empty());
+        return comms::genScopeForChecksum(obj.parseCustomAlgName(), genGenerator());
+    }
+
+    std::string str;
+    if (CommsGenerator::commsCast(genGenerator()).commsGetFastChecksums()) {
+        str = comms::genScopeForChecksum(CommsFastChecksum::commsClassName(alg), genGenerator());
+    }
+    else {
+        str = "comms::frame::checksum::" + ClassMap[idx];
+    }
+
+    if ((alg != commsdsl::parse::ParseChecksumLayer::ParseAlg::Sum) &&
+        (alg != commsdsl::parse::ParseChecksumLayer::ParseAlg::Xor)) {
+        return str;
+    }
+
+    static const std::string Templ =
+        "#^#ALG#$#<\n"
+        "    #^#FIELD#$#::ValueType\n"
+        ">";
+
+    util::GenReplacementMap repl = {
+        {"ALG", std::move(str)},
+        {"FIELD", fieldType},
+    };
+
+    if (!util::genStrStartsWith(repl["FIELD"], "typename")) {
+        repl["FIELD"] = "typename " + repl["FIELD"];
+    }
+
+    return util::genProcessTemplate(Templ, repl);
+}
+
 bool CommsChecksumLayer::genPrepareImpl()
 {
     return GenBase::genPrepareImpl() && CommsBase::commsPrepare();
@@ -77,13 +138,18 @@ CommsChecksumLayer::CommsIncludesList CommsChecksumLayer::commsDefIncludesImpl()
         idx = 0U;
     }
 
-    if (!ChecksumMap[idx].empty()) {
-        result.push_back("comms/frame/checksum/" + ChecksumMap[idx] + strings::genCppHeaderSuffixStr());
-    }
-    else {
+    if (ChecksumMap[idx].empty()) {
         assert(!obj.parseCustomAlgName().empty());
         result.push_back(comms::genRelHeaderForChecksum(comms::genClassName(obj.parseCustomAlgName()), genGenerator()));
+        return result;
+    }
+
+    if (CommsGenerator::commsCast(genGenerator()).commsGetFastChecksums()) {
+        result.push_back(comms::genRelHeaderForChecksum(CommsFastChecksum::commsClassName(obj.parseAlg()), genGenerator()));
+        return result;
     }
+
+    result.push_back("comms/frame/checksum/" + ChecksumMap[idx] + strings::genCppHeaderSuffixStr());
     return result;
 }
 
@@ -99,7 +165,7 @@ std::string CommsChecksumLayer::commsDefBaseTypeImpl(const std::string& prevName
 
     util::GenReplacementMap repl = {
         {"FIELD_TYPE", commsDefFieldType()},
-        {"ALG", commsDefAlgInternal()},
+        {"ALG", commsDefAlg(commsDefFieldType())},
         {"PREV_LAYER", prevName},
         {"EXTRA_OPT", commsDefExtraOptInternal()}
     };
@@ -115,59 +181,6 @@ std::string CommsChecksumLayer::commsDefBaseTypeImpl(const std::string& prevName
     return util::genProcessTemplate(Templ, repl);
 }
 
-std::string CommsChecksumLayer::commsDefAlgInternal() const
-{
-    const std::string ClassMap[] = {
-        /* Custom */ strings::genEmptyString(),
-        /* Sum */ "BasicSum",
-        /* Crc_CCITT */ "Crc_CCITT",
-        /* Crc_16 */ "Crc_16",
-        /* Crc_32 */ "Crc_32",
-        /* Xor */ "BasicXor",
-    };
-
-    const std::size_t ClassMapSize = std::extent<decltype(ClassMap)>::value;
-    static_assert(ClassMapSize == static_cast<std::size_t>(commsdsl::parse::ParseChecksumLayer::ParseAlg::NumOfValues),
-            "Invalid map");
-
-    auto obj = genChecksumDslObj();
-    auto alg = obj.parseAlg();
-    auto idx = static_cast<std::size_t>(alg);
-
-    if (ClassMapSize <= idx) {
-        [[maybe_unused]] static constexpr bool Should_not_happen = false;
-        assert(Should_not_happen);
-        idx = 0U;
-    }
-
-    if (ClassMap[idx].empty()) {
-        assert(!obj.parseCustomAlgName().empty());
-        return comms::genScopeForChecksum(obj.parseCustomAlgName(), genGenerator());
-    }
-
-    auto str = "comms::frame::checksum::" + ClassMap[idx];
-    if ((alg != commsdsl::parse::ParseChecksumLayer::ParseAlg::Sum) &&
-        (alg != commsdsl::parse::ParseChecksumLayer::ParseAlg::Xor)) {
-        return str;
-    }
-
-    static const std::string Templ =
-        "#^#ALG#$#<\n"
-        "    #^#FIELD#$#::ValueType\n"
-        ">";
-
-    util::GenReplacementMap repl = {
-        {"ALG", std::move(str)},
-        {"FIELD", commsDefFieldType()},
-    };
-
-    if (!util::genStrStartsWith(repl["FIELD"], "typename")) {
-        repl["FIELD"] = "typename " + repl["FIELD"];
-    }
-
-    return util::genProcessTemplate(Templ, repl);
-}
-
 std::string CommsChecksumLayer::commsDefExtraOptInternal() const
 {
     std::string result;
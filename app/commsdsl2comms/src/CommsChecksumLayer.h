@@ -35,6 +35,8 @@ public:
 
     CommsChecksumLayer(CommsGenerator& generator, ParseLayer parseObj, GenElem* parent);
 
+    std::string commsDefAlg(const std::string& fieldType) const;
+
 protected:
     virtual bool genPrepareImpl() override;
 
@@ -43,7 +45,6 @@ protected:
     virtual std::string commsDefBaseTypeImpl(const std::string& prevName) const override;
 
 private:
-    std::string commsDefAlgInternal() const;
     std::string commsDefExtraOptInternal() const;
 };
 
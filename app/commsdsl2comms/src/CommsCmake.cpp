@@ -22,7 +22,6 @@
 #include "commsdsl/gen/util.h"
 
 #include <cassert>
-#include <fstream>
 
 namespace strings = commsdsl::gen::strings;
 namespace util = commsdsl::gen::util;
@@ -43,12 +42,6 @@ bool CommsCmake::commsWriteInternal() const
             m_generator.genGetOutputDir(), strings::genCmakeListsFileStr());
 
     m_generator.genLogger().genInfo("Generating " + filePath);
-    std::ofstream stream(filePath);
-    if (!stream) {
-        m_generator.genLogger().genError("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
-
     const std::string Templ =
         "cmake_minimum_required (VERSION 3.10)\n"
         "project (\"#^#NAME#$#\")\n\n"
@@ -138,10 +131,7 @@ bool CommsCmake::commsWriteInternal() const
         {"CAP_NAME", util::genStrToUpper(m_generator.genProtocolSchema().genMainNamespace())},
     };
 
-    stream << util::genProcessTemplate(Templ, repl);
-    stream.flush();
-    if (!stream.good()) {
-        m_generator.genLogger().genError("Failed to write \"" + filePath + "\".");
+    if (!m_generator.genWriteFile(filePath, util::genProcessTemplate(Templ, repl))) {
         return false;
     }
 
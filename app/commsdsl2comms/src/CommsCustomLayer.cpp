@@ -100,6 +100,11 @@ CommsCustomLayer::GenStringsList CommsCustomLayer::commsExtraBareMetalDefaultOpt
     return CommsBase::commsExtraBareMetalDefaultOptionsImpl();
 }
 
+CommsCustomLayer::GenStringsList CommsCustomLayer::commsExtraHighThroughputDefaultOptionsImpl() const
+{
+    return commsExtraMsgFactoryDefaultOptionsImpl();
+}
+
 CommsCustomLayer::GenStringsList CommsCustomLayer::commsExtraMsgFactoryDefaultOptionsImpl() const
 {
     if (commsDefHasInputMessagesImpl()) {
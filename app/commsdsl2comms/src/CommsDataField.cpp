@@ -383,6 +383,42 @@ std::string CommsDataField::commsDefValidFuncBodyImpl() const
     return util::genProcessTemplate(Templ, repl);
 }
 
+std::string CommsDataField::commsDefSkipFuncBodyImpl() const
+{
+    auto obj = genDataFieldParseObj();
+    if ((!obj.parseDetachedPrefixFieldName().empty()) ||
+        (obj.parseFixedLength() != 0U)) {
+        return strings::genEmptyString();
+    }
+
+    if ((m_commsMemberPrefixField != nullptr) || (m_commsExternalPrefixField != nullptr)) {
+        static const std::string Templ =
+            "#^#PREFIX_TYPE#$# prefix;\n"
+            "auto iter = buf;\n"
+            "auto es = prefix.read(iter, len);\n"
+            "if (es != comms::ErrorStatus::Success) {\n"
+            "    return es;\n"
+            "}\n\n"
+            "auto prefixLen = static_cast<std::size_t>(iter - buf);\n"
+            "auto dataLen = static_cast<std::size_t>(prefix.getValue());\n"
+            "if ((len - prefixLen) < dataLen) {\n"
+            "    return comms::ErrorStatus::NotEnoughData;\n"
+            "}\n\n"
+            "consumed = prefixLen + dataLen;\n"
+            "return comms::ErrorStatus::Success;";
+
+        util::GenReplacementMap repl = {
+            {"PREFIX_TYPE", commsPrefixTypeInternal()},
+        };
+
+        return util::genProcessTemplate(Templ, repl);
+    }
+    return
+        "static_cast<void>(buf);\n"
+        "consumed = len;\n"
+        "return comms::ErrorStatus::Success;";
+}
+
 bool CommsDataField::commsIsLimitedCustomizableImpl() const
 {
     return true;
@@ -406,6 +442,12 @@ CommsDataField::GenStringsList CommsDataField::commsExtraDataViewDefaultOptionsI
         };
 }
 
+CommsDataField::GenStringsList CommsDataField::commsExtraHighThroughputDefaultOptionsImpl() const
+{
+    // The view on the input buffer is cheaper than any storage
+    return commsExtraDataViewDefaultOptionsImpl();
+}
+
 CommsDataField::GenStringsList CommsDataField::commsExtraBareMetalDefaultOptionsImpl() const
 {
     auto obj = genDataFieldParseObj();
@@ -472,22 +514,28 @@ void CommsDataField::commsAddLengthPrefixOptInternal(GenStringsList& opts) const
         return;
     }
 
-    std::string prefixName;
+    auto prefixName = commsPrefixTypeInternal();
+    if (m_commsMemberPrefixField == nullptr) {
+        prefixName += ' ';
+    }
+
+    opts.push_back("comms::option::def::SequenceSerLengthFieldPrefix<" + prefixName + '>');
+}
+
+std::string CommsDataField::commsPrefixTypeInternal() const
+{
     if (m_commsMemberPrefixField != nullptr) {
-        prefixName = "typename " + comms::genClassName(genName()) + strings::genMembersSuffixStr();
+        auto prefixName = "typename " + comms::genClassName(genName()) + strings::genMembersSuffixStr();
         if (comms::genIsGlobalField(*this)) {
             prefixName += "<TOpt>";
         }
 
         prefixName += "::" + comms::genClassName(m_commsMemberPrefixField->commsGenField().genName());
-    }
-    else {
-        assert(m_commsExternalPrefixField != nullptr);
-        prefixName = comms::genScopeFor(m_commsExternalPrefixField->commsGenField(), genGenerator(), true, true);
-        prefixName += "<TOpt> ";
+        return prefixName;
     }
 
-    opts.push_back("comms::option::def::SequenceSerLengthFieldPrefix<" + prefixName + '>');
+    assert(m_commsExternalPrefixField != nullptr);
+    return comms::genScopeFor(m_commsExternalPrefixField->commsGenField(), genGenerator(), true, true) + "<TOpt>";
 }
 
 void CommsDataField::commsAddLengthForcingOptInternal(GenStringsList& opts) const
@@ -27,7 +27,6 @@
 #include <algorithm>
 #include <cassert>
 #include <functional>
-#include <fstream>
 
 namespace comms = commsdsl::gen::comms;
 namespace strings = commsdsl::gen::strings;
@@ -40,6 +39,8 @@ namespace
 {
 
 const std::string CommsMsgFactoryOptionsSuffix("MsgFactoryDefaultOptions");
+const std::string CommsPoolAllocStr("Pool");
+const std::size_t CommsDefaultPoolCapacity = 16U;
 
 using NamespaceOptionsFunc = std::string (CommsNamespace::*)() const;
 std::string commsOptionsBodyInternal(
@@ -96,15 +97,7 @@ bool commsWriteFileInternal(
         return false;
     }
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        generator.genLogger().genError("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
-
-    stream << data;
-    stream.flush();
-    return stream.good();
+    return generator.genWriteFile(filePath, data);
 }
 
 const std::string& commsExtOptionsTempl()
@@ -160,9 +153,11 @@ const std::string& commsMsgFactoryOptionsTempl()
         "{\n\n"
         "/// @brief Provided #^#DESC#$# message factory options of the protocol.\n"
         "/// @details Must be used as the outermost wrapper of the protocol options.\n"
-        "template <typename TBase = #^#DEFAULT_OPTS#$#>\n"
+        "#^#TPARAMS_DOC#$#\n"
+        "template <typename TBase = #^#DEFAULT_OPTS#$##^#EXTRA_TPARAMS#$#>\n"
         "struct #^#NAME#$#MsgFactoryDefaultOptionsT : public TBase\n"
         "{\n"
+        "    #^#MEMBERS#$#\n"
         "    #^#MSG_FACTORIES#$#\n"
         "    #^#BODY#$#\n"
         "};\n\n"
@@ -176,6 +171,41 @@ const std::string& commsMsgFactoryOptionsTempl()
     return Templ;
 }
 
+util::GenStringsList commsMsgFactoryAliasesInternal(
+    CommsGenerator& generator,
+    const std::string& prefix,
+    const std::string& optsName,
+    util::GenStringsList& includes,
+    const std::string& extraTArgs = std::string())
+{
+    util::GenStringsList allFactories;
+    auto allNamespaces = generator.genGetAllNamespaces();
+    for (auto* ns : allNamespaces) {
+        auto suffix = "<TInterface, " + optsName + "T<TBase" + extraTArgs + ">" + extraTArgs + " >";
+        auto factoryDef = CommsNamespace::commsCast(ns)->commsMsgFactoryAliasDef(prefix, suffix);
+        if (factoryDef.empty()) {
+            continue;
+        }
+
+        static const std::string AliasTempl =
+            "/// @brief Alias to actual message factory class.\n"
+            "/// @details Exposes the same template parameters as @b comms::MsgFactory.\n"
+            "template <typename TInterface, typename TAllMessages, typename... TOptions>\n"
+            "#^#DEF#$#\n"
+        ;
+
+        util::GenReplacementMap aliasRepl = {
+            {"DEF", std::move(factoryDef)},
+            {"REF", CommsNamespace::commsCast(ns)->commsMsgFactoryAliasType()},
+        };
+
+        allFactories.push_back(util::genProcessTemplate(AliasTempl, aliasRepl));
+        includes.push_back(CommsNamespace::commsCast(ns)->commsRelHeaderPath(prefix));
+    }
+
+    return allFactories;
+}
+
 } // namespace
 
 bool CommsDefaultOptions::commsWrite(CommsGenerator& generator)
@@ -197,6 +227,7 @@ bool CommsDefaultOptions::commsWriteInternal() const
         commsWriteServerDefaultOptionsInternal() &&
         commsWriteDataViewDefaultOptionsInternal() &&
         commsWriteBareMetalDefaultOptionsInternal() &&
+        commsWriteHighThroughputDefaultOptionsInternal() &&
         commsWriteMsgFactoryDefaultOptionsInternal();
 }
 
@@ -338,59 +369,112 @@ bool CommsDefaultOptions::commsWriteBareMetalDefaultOptionsInternal() const
     return true;
 }
 
+bool CommsDefaultOptions::commsWriteHighThroughputDefaultOptionsInternal() const
+{
+    util::GenReplacementMap repl = commsExtInitialRepl(m_commsGenerator);
+    auto name = strings::genHighThroughputStr() + strings::genDefaultOptionsClassStr();
+
+    util::GenStringsList includes;
+    std::string factoryPrefix = "AllMessagesDynMem";
+    if (m_commsGenerator.commsGetPoolMsgFactories()) {
+        factoryPrefix = "AllMessagesPool";
+    }
+
+    auto allFactories = commsMsgFactoryAliasesInternal(m_commsGenerator, factoryPrefix, name, includes);
+    comms::genPrepareIncludeStatement(includes);
+
+    auto body =
+        util::genStrListToString(allFactories, "\n", "\n") +
+        commsOptionsBodyInternal(m_commsGenerator, &CommsNamespace::commsHighThroughputDefaultOptions, true);
+
+    bool classExtended = false;
+    repl.insert({
+        {"DESC", "high throughput"},
+        {"NAME", strings::genHighThroughputStr()},
+        {"BODY", std::move(body)},
+        {"EXTRA", util::genStrListToString(includes, "\n", "\n")},
+        {"EXTEND", m_commsGenerator.genReadCodeInjectCode(comms::genInputCodeRelPathForOptions(name, m_commsGenerator) + strings::genExtendFileSuffixStr(), "Extend class", &classExtended)},
+        {"APPEND", m_commsGenerator.genReadCodeInjectCode(comms::genInputCodeRelPathForOptions(name, m_commsGenerator) + strings::genAppendFileSuffixStr(), "Append here")},
+    });
+
+    if (classExtended) {
+        repl["ORIG"] = strings::genOrigSuffixStr();
+    }
+
+    commsWriteFileInternal(name, m_commsGenerator, util::genProcessTemplate(commsExtOptionsTempl(), repl, true));
+    return true;
+}
+
 bool CommsDefaultOptions::commsWriteMsgFactoryDefaultOptionsInternal() const
 {
     if (!m_commsGenerator.genIsCurrentProtocolSchema()) {
         return true;
     }
 
-    return
-        commsWriteAllMessagesDynMemMsgFactoryOptionsInternal() &&
-        commsWriteClientInputMessagesDynMemMsgFactoryOptionsInternal() &&
-        commsWriteServerInputMessagesDynMemMsgFactoryOptionsInternal() &&
-        commsWritePlatformSpecificDynMemMsgFactoryOptionsInternal() &&
-        commsWriteExtraBundlesDynMemMsgFactoryOptionsInternal();
+    static const std::pair<std::string, std::string> Allocs[] = {
+        {"DynMem", "dynamic memory"},
+        {CommsPoolAllocStr, "pool memory"},
+    };
+
+    for (auto& a : Allocs) {
+        if ((a.first == CommsPoolAllocStr) && (!m_commsGenerator.commsGetPoolMsgFactories())) {
+            continue;
+        }
+
+        bool result =
+            commsWriteAllMessagesMsgFactoryOptionsInternal(a.first, a.second) &&
+            commsWriteClientInputMessagesMsgFactoryOptionsInternal(a.first, a.second) &&
+            commsWriteServerInputMessagesMsgFactoryOptionsInternal(a.first, a.second) &&
+            commsWritePlatformSpecificMsgFactoryOptionsInternal(a.first, a.second) &&
+            commsWriteExtraBundlesMsgFactoryOptionsInternal(a.first, a.second);
+
+        if (!result) {
+            return false;
+        }
+    }
+
+    return true;
 }
 
-bool CommsDefaultOptions::commsWriteAllMessagesDynMemMsgFactoryOptionsInternal() const
+bool CommsDefaultOptions::commsWriteAllMessagesMsgFactoryOptionsInternal(const std::string& allocName, const std::string& allocDesc) const
 {
     return
         commsWriteSingleMsgFactoryDefaultOptionsInternal(
-            "AllMessagesDynMem",
+            "AllMessages" + allocName,
             "all",
-            "dynamic memory"
+            allocDesc
         );
 }
 
-bool CommsDefaultOptions::commsWriteClientInputMessagesDynMemMsgFactoryOptionsInternal() const
+bool CommsDefaultOptions::commsWriteClientInputMessagesMsgFactoryOptionsInternal(const std::string& allocName, const std::string& allocDesc) const
 {
     return
         commsWriteSingleMsgFactoryDefaultOptionsInternal(
-            "ClientInputMessagesDynMem",
+            "ClientInputMessages" + allocName,
             "client input",
-            "dynamic memory"
+            allocDesc
         );
 }
 
-bool CommsDefaultOptions::commsWriteServerInputMessagesDynMemMsgFactoryOptionsInternal() const
+bool CommsDefaultOptions::commsWriteServerInputMessagesMsgFactoryOptionsInternal(const std::string& allocName, const std::string& allocDesc) const
 {
     return
         commsWriteSingleMsgFactoryDefaultOptionsInternal(
-            "ServerInputMessagesDynMem",
+            "ServerInputMessages" + allocName,
             "server input",
-            "dynamic memory"
+            allocDesc
         );
 }
 
-bool CommsDefaultOptions::commsWritePlatformSpecificDynMemMsgFactoryOptionsInternal() const
+bool CommsDefaultOptions::commsWritePlatformSpecificMsgFactoryOptionsInternal(const std::string& allocName, const std::string& allocDesc) const
 {
     auto& platforms = m_commsGenerator.genCurrentSchema().platformNames();
     for (auto& p : platforms) {
         bool result =
             commsWriteSingleMsgFactoryDefaultOptionsInternal(
-                comms::genClassName(p) + "MessagesDynMem",
+                comms::genClassName(p) + "Messages" + allocName,
                 "all \"" + p + "\" platform scpecific",
-                "dynamic memory"
+                allocDesc
             );
 
         if (!result) {
@@ -399,9 +483,9 @@ bool CommsDefaultOptions::commsWritePlatformSpecificDynMemMsgFactoryOptionsInter
 
         result =
             commsWriteSingleMsgFactoryDefaultOptionsInternal(
-                comms::genClassName(p) + "ClientInputMessagesDynMem",
+                comms::genClassName(p) + "ClientInputMessages" + allocName,
                 "client input \"" + p + "\" platform scpecific",
-                "dynamic memory"
+                allocDesc
             );
 
         if (!result) {
@@ -410,9 +494,9 @@ bool CommsDefaultOptions::commsWritePlatformSpecificDynMemMsgFactoryOptionsInter
 
         result =
             commsWriteSingleMsgFactoryDefaultOptionsInternal(
-                comms::genClassName(p) + "ServerInputMessagesDynMem",
+                comms::genClassName(p) + "ServerInputMessages" + allocName,
                 "server input \"" + p + "\" platform scpecific",
-                "dynamic memory"
+                allocDesc
             );
 
         if (!result) {
@@ -423,15 +507,15 @@ bool CommsDefaultOptions::commsWritePlatformSpecificDynMemMsgFactoryOptionsInter
     return true;
 }
 
-bool CommsDefaultOptions::commsWriteExtraBundlesDynMemMsgFactoryOptionsInternal() const
+bool CommsDefaultOptions::commsWriteExtraBundlesMsgFactoryOptionsInternal(const std::string& allocName, const std::string& allocDesc) const
 {
     auto& extraBundles = m_commsGenerator.commsExtraMessageBundles();
     for (auto& b : extraBundles) {
         bool result =
             commsWriteSingleMsgFactoryDefaultOptionsInternal(
-                comms::genClassName(b.first) + "MessagesDynMem",
+                comms::genClassName(b.first) + "Messages" + allocName,
                 "all \"" + b.first + "\" bundle scpecific",
-                "dynamic memory"
+                allocDesc
             );
 
         if (!result) {
@@ -440,9 +524,9 @@ bool CommsDefaultOptions::commsWriteExtraBundlesDynMemMsgFactoryOptionsInternal(
 
         result =
             commsWriteSingleMsgFactoryDefaultOptionsInternal(
-                comms::genClassName(b.first) + "ClientInputMessagesDynMem",
+                comms::genClassName(b.first) + "ClientInputMessages" + allocName,
                 "client input \"" + b.first + "\" bundle scpecific",
-                "dynamic memory"
+                allocDesc
             );
 
         if (!result) {
@@ -451,9 +535,9 @@ bool CommsDefaultOptions::commsWriteExtraBundlesDynMemMsgFactoryOptionsInternal(
 
         result =
             commsWriteSingleMsgFactoryDefaultOptionsInternal(
-                comms::genClassName(b.first) + "ServerInputMessagesDynMem",
+                comms::genClassName(b.first) + "ServerInputMessages" + allocName,
                 "server input \"" + b.first + "\" bundle scpecific",
-                "dynamic memory"
+                allocDesc
             );
 
         if (!result) {
@@ -475,31 +559,14 @@ bool CommsDefaultOptions::commsWriteSingleMsgFactoryDefaultOptionsInternal(
         comms::genRelHeaderForOptions(strings::genDefaultOptionsClassStr(), m_commsGenerator, true),
     };
 
-    util::GenStringsList allFactories;
-    auto allNamespaces = m_commsGenerator.genGetAllNamespaces();
-    for (auto* ns : allNamespaces) {
-        auto suffix = "<TInterface, " + name + "T<TBase> >";
-        auto factoryDef = CommsNamespace::commsCast(ns)->commsMsgFactoryAliasDef(prefix, suffix);
-        if (factoryDef.empty()) {
-            continue;
-        }
-
-        static const std::string AliasTempl =
-            "/// @brief Alias to actual message factory class.\n"
-            "/// @details Exposes the same template parameters as @b comms::MsgFactory.\n"
-            "template <typename TInterface, typename TAllMessages, typename... TOptions>\n"
-            "#^#DEF#$#\n"
-        ;
-
-        util::GenReplacementMap aliasRepl = {
-            {"DEF", std::move(factoryDef)},
-            {"REF", CommsNamespace::commsCast(ns)->commsMsgFactoryAliasType()},
-        };
-
-        allFactories.push_back(util::genProcessTemplate(AliasTempl, aliasRepl));
-        includes.push_back(CommsNamespace::commsCast(ns)->commsRelHeaderPath(prefix));
+    std::string extraTArgs;
+    bool pool = util::genStrEndsWith(prefix, CommsPoolAllocStr);
+    if (pool) {
+        extraTArgs = ", TPoolCapacity";
+        includes.push_back("<cstddef>");
     }
 
+    auto allFactories = commsMsgFactoryAliasesInternal(m_commsGenerator, prefix, name, includes, extraTArgs);
     comms::genPrepareIncludeStatement(includes);
 
     bool classExtended = false;
@@ -518,6 +585,18 @@ bool CommsDefaultOptions::commsWriteSingleMsgFactoryDefaultOptionsInternal(
         repl["ORIG"] = strings::genOrigSuffixStr();
     }
 
+    if (pool) {
+        repl["TPARAMS_DOC"] =
+            "/// @tparam TPoolCapacity Number of objects in the pool of every message type,\n"
+            "///     see @ref MsgFactoryPoolCapacity.";
+        repl["EXTRA_TPARAMS"] = ", std::size_t TPoolCapacity = " + util::genNumToString(CommsDefaultPoolCapacity) + "U";
+        repl["MEMBERS"] =
+            "/// @brief Number of objects in the pool of every message type of the factory.\n"
+            "/// @details The factory object owns the pools and must outlive all the\n"
+            "///     messages it allocated.\n"
+            "static constexpr std::size_t MsgFactoryPoolCapacity = TPoolCapacity;\n";
+    }
+
     commsWriteFileInternal(name, m_commsGenerator, util::genProcessTemplate(commsMsgFactoryOptionsTempl(), repl, true));
     return true;
 }
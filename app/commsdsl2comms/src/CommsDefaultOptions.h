@@ -36,12 +36,13 @@ private:
     bool commsWriteServerDefaultOptionsInternal() const;
     bool commsWriteDataViewDefaultOptionsInternal() const;
     bool commsWriteBareMetalDefaultOptionsInternal() const;
+    bool commsWriteHighThroughputDefaultOptionsInternal() const;
     bool commsWriteMsgFactoryDefaultOptionsInternal() const;
-    bool commsWriteAllMessagesDynMemMsgFactoryOptionsInternal() const;
-    bool commsWriteClientInputMessagesDynMemMsgFactoryOptionsInternal() const;
-    bool commsWriteServerInputMessagesDynMemMsgFactoryOptionsInternal() const;
-    bool commsWritePlatformSpecificDynMemMsgFactoryOptionsInternal() const;
-    bool commsWriteExtraBundlesDynMemMsgFactoryOptionsInternal() const;
+    bool commsWriteAllMessagesMsgFactoryOptionsInternal(const std::string& allocName, const std::string& allocDesc) const;
+    bool commsWriteClientInputMessagesMsgFactoryOptionsInternal(const std::string& allocName, const std::string& allocDesc) const;
+    bool commsWriteServerInputMessagesMsgFactoryOptionsInternal(const std::string& allocName, const std::string& allocDesc) const;
+    bool commsWritePlatformSpecificMsgFactoryOptionsInternal(const std::string& allocName, const std::string& allocDesc) const;
+    bool commsWriteExtraBundlesMsgFactoryOptionsInternal(const std::string& allocName, const std::string& allocDesc) const;
     bool commsWriteSingleMsgFactoryDefaultOptionsInternal(
         const std::string& prefix,
         const std::string& messagesDesc,
@@ -27,7 +27,8 @@
 #include <algorithm>
 #include <cassert>
 #include <functional>
-#include <fstream>
+#include <limits>
+#include <vector>
 
 namespace comms = commsdsl::gen::comms;
 namespace strings = commsdsl::gen::strings;
@@ -59,15 +60,7 @@ bool commsWriteFileInternal(
         return false;
     }
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        generator.genLogger().genError("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
-
-    stream << data;
-    stream.flush();
-    return stream.good();
+    return generator.genWriteFile(filePath, data);
 }
 
 const std::string& commsDispatchTempl()
@@ -102,8 +95,9 @@ util::GenReplacementMap commsInitialRepl(const CommsGenerator& generator, const
 const std::string& commsSingleMessagePerIdTempl()
 {
     static const std::string Templ =
+        "#^#HELPER#$#\n"
         "/// @brief Dispatch message object to its appropriate handling function.\n"
-        "/// @details @b switch statement based (on message ID) cast and dispatch functionality.\n"
+        "/// @details #^#DETAILS#$#\n"
         "/// @tparam TProtOptions Protocol options struct used for the application,\n"
         "///     like @ref #^#DEFAULT_OPTIONS#$#.\n"
         "/// @param[in] id Numeric message ID.\n"
@@ -132,13 +126,7 @@ const std::string& commsSingleMessagePerIdTempl()
         "    TMsg& msg,\n"
         "    THandler& handler) -> decltype(handler.handle(msg))\n"
         "{\n"
-        "    using InterfaceType = typename std::decay<decltype(msg)>::type;\n"
-        "    switch(static_cast<std::intmax_t>(id)) {\n"
-        "    #^#CASES#$#\n"
-        "    default:\n"
-        "        break;\n"
-        "    };\n\n"
-        "    return handler.handle(msg);\n"
+        "    #^#BODY#$#\n"
         "}\n\n"
         "/// @brief Dispatch message object to its appropriate handling function.\n"
         "/// @details Same as other dispatch#^#NAME#$#Message(), but receives extra @b idx parameter.\n"
@@ -299,6 +287,114 @@ const std::string& commsMultipleMessagesPerIdTempl()
     return Templ;
 }
 
+const std::uintmax_t CommsMaxDispatchTableSize = 0x10000U;
+const std::size_t CommsMinTableDispatchMessages = 8U;
+
+// Must be the same as the "mix()" function in the generated code
+std::uint32_t commsHashMix(std::uint32_t key, std::uint32_t seed)
+{
+    std::uint32_t h = key ^ seed;
+    h ^= h >> 16;
+    h *= 0x7feb352dU;
+    h ^= h >> 15;
+    h *= 0x846ca68bU;
+    h ^= h >> 16;
+    return h;
+}
+
+struct CommsPerfectHash
+{
+    std::uint32_t m_seed = 0U;
+    std::vector<std::uint32_t> m_displacements;
+    std::vector<std::size_t> m_slots; // index of key in every slot
+};
+
+// Hash and displace (CHD) construction of minimal perfect hash:
+// the keys are distributed into the buckets using the seeded hash, then
+// every bucket (the largest first) looks for the displacement value
+// that places all its keys into the free slots.
+bool commsBuildPerfectHash(const std::vector<std::uint32_t>& keys, CommsPerfectHash& result)
+{
+    static const std::uint32_t MaxSeedAttempts = 64U;
+    static const std::uint32_t MaxDisplacement = 0x100000U;
+    static const std::size_t NoKey = std::numeric_limits<std::size_t>::max();
+
+    auto count = static_cast<std::uint32_t>(keys.size());
+    assert(0U < count);
+    for (std::uint32_t attempt = 0U; attempt < MaxSeedAttempts; ++attempt) {
+        auto seed = (attempt * 0x9e3779b9U) + 1U;
+        std::vector<std::vector<std::size_t>> buckets(count);
+        for (auto idx = 0U; idx < keys.size(); ++idx) {
+            buckets[commsHashMix(keys[idx], seed) % count].push_back(idx);
+        }
+
+        std::vector<std::size_t> order(count);
+        for (auto idx = 0U; idx < order.size(); ++idx) {
+            order[idx] = idx;
+        }
+
+        std::stable_sort(
+            order.begin(), order.end(),
+            [&buckets](std::size_t first, std::size_t second)
+            {
+                return buckets[second].size() < buckets[first].size();
+            });
+
+        std::vector<std::uint32_t> displacements(count, 0U);
+        std::vector<std::size_t> slots(count, NoKey);
+        std::vector<std::uint32_t> bucketSlots;
+        bool success = true;
+        for (auto bucketIdx : order) {
+            auto& bucket = buckets[bucketIdx];
+            if (bucket.empty()) {
+                break;
+            }
+
+            bool placed = false;
+            for (std::uint32_t disp = 0U; disp < MaxDisplacement; ++disp) {
+                bucketSlots.clear();
+                for (auto keyIdx : bucket) {
+                    auto slot = commsHashMix(keys[keyIdx], disp) % count;
+                    if ((slots[slot] != NoKey) ||
+                        (std::find(bucketSlots.begin(), bucketSlots.end(), slot) != bucketSlots.end())) {
+                        break;
+                    }
+
+                    bucketSlots.push_back(slot);
+                }
+
+                if (bucketSlots.size() != bucket.size()) {
+                    continue;
+                }
+
+                for (auto idx = 0U; idx < bucket.size(); ++idx) {
+                    slots[bucketSlots[idx]] = bucket[idx];
+                }
+
+                displacements[bucketIdx] = disp;
+                placed = true;
+                break;
+            }
+
+            if (!placed) {
+                success = false;
+                break;
+            }
+        }
+
+        if (!success) {
+            continue;
+        }
+
+        result.m_seed = seed;
+        result.m_displacements = std::move(displacements);
+        result.m_slots = std::move(slots);
+        return true;
+    }
+
+    return false;
+}
+
 } // namespace
 
 CommsDispatch::CommsDispatch(CommsGenerator& generator, const CommsNamespace& parent) :
@@ -332,10 +428,12 @@ bool CommsDispatch::commsWriteDispatchInternal() const
         };
 
     util::GenReplacementMap repl = commsInitialRepl(m_commsGenerator, m_commsParent);
+    CommsIncludesList extraIncludes;
+    auto code = commsDispatchCodeInternal(std::string(), std::move(checkFunc), extraIncludes);
     repl.insert({
         {"DESC", "all"},
-        {"INCLUDES", commsIncludesInternal("All")},
-        {"CODE", commsDispatchCodeInternal(std::string(), std::move(checkFunc))}
+        {"INCLUDES", commsIncludesInternal("All", extraIncludes)},
+        {"CODE", std::move(code)}
     });
 
     return commsWriteFileInternal(commsGetFileName(), m_commsGenerator, m_commsParent, util::genProcessTemplate(commsDispatchTempl(), repl, true));
@@ -351,10 +449,12 @@ bool CommsDispatch::commsWriteClientDispatchInternal() const
 
     util::GenReplacementMap repl = commsInitialRepl(m_commsGenerator, m_commsParent);
     std::string inputPrefix = "ClientInput";
+    CommsIncludesList extraIncludes;
+    auto code = commsDispatchCodeInternal(inputPrefix, std::move(checkFunc), extraIncludes);
     repl.insert({
         {"DESC", "client input"},
-        {"INCLUDES", commsIncludesInternal(inputPrefix)},
-        {"CODE", commsDispatchCodeInternal(inputPrefix, std::move(checkFunc))}
+        {"INCLUDES", commsIncludesInternal(inputPrefix, extraIncludes)},
+        {"CODE", std::move(code)}
     });
 
     return commsWriteFileInternal(commsGetFileName(inputPrefix), m_commsGenerator, m_commsParent, util::genProcessTemplate(commsDispatchTempl(), repl, true));
@@ -370,10 +470,12 @@ bool CommsDispatch::commsWriteServerDispatchInternal() const
 
     util::GenReplacementMap repl = commsInitialRepl(m_commsGenerator, m_commsParent);
     std::string inputPrefix = "ServerInput";
+    CommsIncludesList extraIncludes;
+    auto code = commsDispatchCodeInternal(inputPrefix, std::move(checkFunc), extraIncludes);
     repl.insert({
         {"DESC", "client input"},
-        {"INCLUDES", commsIncludesInternal(inputPrefix)},
-        {"CODE", commsDispatchCodeInternal(inputPrefix, std::move(checkFunc))}
+        {"INCLUDES", commsIncludesInternal(inputPrefix, extraIncludes)},
+        {"CODE", std::move(code)}
     });
 
     return commsWriteFileInternal(commsGetFileName(inputPrefix), m_commsGenerator, m_commsParent, util::genProcessTemplate(commsDispatchTempl(), repl, true));
@@ -404,10 +506,12 @@ bool CommsDispatch::commsWritePlatformDispatchInternal() const
 
             util::GenReplacementMap repl = commsInitialRepl(m_commsGenerator, m_commsParent);
             std::string inputPrefix = comms::genClassName(p);
+            CommsIncludesList extraIncludes;
+            auto code = commsDispatchCodeInternal(inputPrefix, std::move(allCheckFunc), extraIncludes);
             repl.insert({
                 {"DESC", p + " platform"},
-                {"INCLUDES", commsIncludesInternal(inputPrefix)},
-                {"CODE", commsDispatchCodeInternal(inputPrefix, std::move(allCheckFunc))}
+                {"INCLUDES", commsIncludesInternal(inputPrefix, extraIncludes)},
+                {"CODE", std::move(code)}
             });
 
             bool result =
@@ -433,10 +537,12 @@ bool CommsDispatch::commsWritePlatformDispatchInternal() const
 
             util::GenReplacementMap repl = commsInitialRepl(m_commsGenerator, m_commsParent);
             std::string inputPrefix = comms::genClassName(p) + "ClientInput";
+            CommsIncludesList extraIncludes;
+            auto code = commsDispatchCodeInternal(inputPrefix, std::move(clientCheckFunc), extraIncludes);
             repl.insert({
                 {"DESC", p + " platform client input"},
-                {"INCLUDES", commsIncludesInternal(inputPrefix)},
-                {"CODE", commsDispatchCodeInternal(inputPrefix, std::move(clientCheckFunc))}
+                {"INCLUDES", commsIncludesInternal(inputPrefix, extraIncludes)},
+                {"CODE", std::move(code)}
             });
 
             bool result =
@@ -462,10 +568,12 @@ bool CommsDispatch::commsWritePlatformDispatchInternal() const
 
             util::GenReplacementMap repl = commsInitialRepl(m_commsGenerator, m_commsParent);
             std::string inputPrefix = comms::genClassName(p) + "ServerInput";
+            CommsIncludesList extraIncludes;
+            auto code = commsDispatchCodeInternal(inputPrefix, std::move(serverCheckFunc), extraIncludes);
             repl.insert({
                 {"DESC", p + " platform server input"},
-                {"INCLUDES", commsIncludesInternal(inputPrefix)},
-                {"CODE", commsDispatchCodeInternal(inputPrefix, std::move(serverCheckFunc))}
+                {"INCLUDES", commsIncludesInternal(inputPrefix, extraIncludes)},
+                {"CODE", std::move(code)}
             });
 
             bool result =
@@ -505,10 +613,12 @@ bool CommsDispatch::commsWriteExtraDispatchInternal() const
 
             util::GenReplacementMap repl = commsInitialRepl(m_commsGenerator, m_commsParent);
             std::string inputPrefix = comms::genClassName(b.first);
+            CommsIncludesList extraIncludes;
+            auto code = commsDispatchCodeInternal(inputPrefix, std::move(allCheckFunc), extraIncludes);
             repl.insert({
                 {"DESC", b.first + " bundle"},
-                {"INCLUDES", commsIncludesInternal(inputPrefix)},
-                {"CODE", commsDispatchCodeInternal(inputPrefix, std::move(allCheckFunc))}
+                {"INCLUDES", commsIncludesInternal(inputPrefix, extraIncludes)},
+                {"CODE", std::move(code)}
             });
 
             bool result =
@@ -534,10 +644,12 @@ bool CommsDispatch::commsWriteExtraDispatchInternal() const
 
             util::GenReplacementMap repl = commsInitialRepl(m_commsGenerator, m_commsParent);
             std::string inputPrefix = comms::genClassName(b.first) + "ClientInput";
+            CommsIncludesList extraIncludes;
+            auto code = commsDispatchCodeInternal(inputPrefix, std::move(clientCheckFunc), extraIncludes);
             repl.insert({
                 {"DESC", b.first + " bundle client input"},
-                {"INCLUDES", commsIncludesInternal(inputPrefix)},
-                {"CODE", commsDispatchCodeInternal(inputPrefix, std::move(clientCheckFunc))}
+                {"INCLUDES", commsIncludesInternal(inputPrefix, extraIncludes)},
+                {"CODE", std::move(code)}
             });
 
             bool result =
@@ -563,10 +675,12 @@ bool CommsDispatch::commsWriteExtraDispatchInternal() const
 
             util::GenReplacementMap repl = commsInitialRepl(m_commsGenerator, m_commsParent);
             std::string inputPrefix = comms::genClassName(b.first) + "ServerInput";
+            CommsIncludesList extraIncludes;
+            auto code = commsDispatchCodeInternal(inputPrefix, std::move(serverCheckFunc), extraIncludes);
             repl.insert({
                 {"DESC", b.first + " bundle server input"},
-                {"INCLUDES", commsIncludesInternal(inputPrefix)},
-                {"CODE", commsDispatchCodeInternal(inputPrefix, std::move(serverCheckFunc))}
+                {"INCLUDES", commsIncludesInternal(inputPrefix, extraIncludes)},
+                {"CODE", std::move(code)}
             });
 
             bool result =
@@ -586,7 +700,7 @@ bool CommsDispatch::commsWriteExtraDispatchInternal() const
     return true;
 }
 
-std::string CommsDispatch::commsIncludesInternal(const std::string& inputPrefix) const
+std::string CommsDispatch::commsIncludesInternal(const std::string& inputPrefix, const CommsIncludesList& extraIncludes) const
 {
     util::GenStringsList incs = {
         "<cstdint>",
@@ -594,11 +708,13 @@ std::string CommsDispatch::commsIncludesInternal(const std::string& inputPrefix)
         comms::genRelHeaderForOptions(strings::genDefaultOptionsClassStr(), m_commsGenerator),
     };
 
+    incs.insert(incs.end(), extraIncludes.begin(), extraIncludes.end());
+
     comms::genPrepareIncludeStatement(incs);
     return util::genStrListToString(incs, "\n", "\n");
 }
 
-std::string CommsDispatch::commsDispatchCodeInternal(const std::string& name, CommsCheckMsgFunc&& func) const
+std::string CommsDispatch::commsDispatchCodeInternal(const std::string& name, CommsCheckMsgFunc&& func, CommsIncludesList& extraIncludes) const
 {
     CommsMessagesMap map;
     auto allMessages = m_commsParent.genGetAllMessagesIdSorted();
@@ -641,14 +757,79 @@ std::string CommsDispatch::commsDispatchCodeInternal(const std::string& name, Co
         {"DISPATCHER", commsMsgDispatcherCodeInternal(name)},
     };
 
-    auto& templ = hasMultipleMessagesWithSameId ? commsMultipleMessagesPerIdTempl() : commsSingleMessagePerIdTempl();
-    return util::genProcessTemplate(templ, repl);
+    if (hasMultipleMessagesWithSameId) {
+        using CommsDispatchStrategy = CommsGenerator::CommsDispatchStrategy;
+        auto strategy = m_commsGenerator.commsGetDispatchStrategy();
+        if ((strategy != CommsDispatchStrategy::Auto) && (strategy != CommsDispatchStrategy::Switch)) {
+            m_commsGenerator.genLogger().genWarning(
+                "Multiple messages with the same ID are not supported by the selected dispatch strategy, using switch statement instead.");
+        }
+
+        return util::genProcessTemplate(commsMultipleMessagesPerIdTempl(), repl);
+    }
+
+    auto kind = commsDispatchKindInternal(map);
+    std::string hashLookup;
+    if (kind == CommsDispatchKind::Hash) {
+        hashLookup = commsHashLookupCodeInternal(map);
+        if (hashLookup.empty()) {
+            // The direct table may be huge for the IDs spread over 32 bits
+            m_commsGenerator.genLogger().genWarning(
+                "Failed to build the perfect hash of the message IDs, using switch statement instead.");
+            kind = CommsDispatchKind::Switch;
+        }
+    }
+
+    if (kind == CommsDispatchKind::Switch) {
+        repl["DETAILS"] = "@b switch statement based (on message ID) cast and dispatch functionality.";
+        repl["BODY"] = commsSwitchBodyCodeInternal(map);
+        return util::genProcessTemplate(commsSingleMessagePerIdTempl(), repl);
+    }
+
+    if (kind == CommsDispatchKind::Table) {
+        repl["DETAILS"] = "Function pointers table (directly indexed by message ID) based cast and dispatch functionality.";
+        repl["HELPER"] = commsHelperCodeInternal(name, commsTableLookupCodeInternal(map));
+    }
+    else {
+        assert(kind == CommsDispatchKind::Hash);
+        repl["DETAILS"] = "Function pointers table (indexed by minimal perfect hash of message ID) based cast and dispatch functionality.";
+        repl["HELPER"] = commsHelperCodeInternal(name, hashLookup);
+    }
+
+    repl["BODY"] = commsHelperBodyCodeInternal(name, map);
+    extraIncludes.insert(extraIncludes.end(), {"<cstddef>", "<type_traits>", "<utility>"});
+    return util::genProcessTemplate(commsSingleMessagePerIdTempl(), repl);
 }
 
 std::string CommsDispatch::commsCasesCodeInternal(const CommsMessagesMap& map) const
 {
-    util::GenStringsList cases;
+    // The most frequent messages (if the profile is provided) are placed first
+    std::vector<const CommsMessagesMap::value_type*> elems;
+    elems.reserve(map.size());
     for (auto& elem : map) {
+        elems.push_back(&elem);
+    }
+
+    auto freqFunc =
+        [this](const CommsMessagesMap::value_type* elem)
+        {
+            std::uintmax_t result = 0U;
+            for (auto* m : elem->second) {
+                result += m_commsGenerator.commsMsgFrequency(*m);
+            }
+            return result;
+        };
+
+    std::stable_sort(
+        elems.begin(), elems.end(),
+        [&freqFunc](auto* first, auto* second)
+        {
+            return freqFunc(second) < freqFunc(first);
+        });
+
+    util::GenStringsList cases;
+    for (auto* elemPtr : elems) {
+        auto& elem = *elemPtr;
         auto& msgList = elem.second;
         assert(!msgList.empty());
         auto idStr = util::genNumToStringWithHexComment(elem.first);
@@ -700,6 +881,309 @@ std::string CommsDispatch::commsCasesCodeInternal(const CommsMessagesMap& map) c
     return util::genStrListToString(cases, "\n", "");
 }
 
+CommsDispatch::CommsDispatchKind CommsDispatch::commsDispatchKindInternal(const CommsMessagesMap& map) const
+{
+    using CommsDispatchStrategy = CommsGenerator::CommsDispatchStrategy;
+    auto strategy = m_commsGenerator.commsGetDispatchStrategy();
+    if ((strategy == CommsDispatchStrategy::Switch) || map.empty()) {
+        return CommsDispatchKind::Switch;
+    }
+
+    auto minId = std::numeric_limits<std::intmax_t>::max();
+    auto maxId = std::numeric_limits<std::intmax_t>::min();
+    for (auto& elem : map) {
+        auto id = static_cast<std::intmax_t>(elem.first);
+        minId = std::min(minId, id);
+        maxId = std::max(maxId, id);
+    }
+
+    auto tableSize = (static_cast<std::uintmax_t>(maxId) - static_cast<std::uintmax_t>(minId)) + 1U;
+    bool tableFits = (0U < tableSize) && (tableSize <= CommsMaxDispatchTableSize);
+    bool hashFits = (0 <= minId) && (maxId <= static_cast<std::intmax_t>(std::numeric_limits<std::uint32_t>::max()));
+
+    if (strategy == CommsDispatchStrategy::Auto) {
+        if (map.size() < CommsMinTableDispatchMessages) {
+            return CommsDispatchKind::Switch;
+        }
+
+        if (tableFits && (tableSize <= (map.size() * 2U))) {
+            return CommsDispatchKind::Table;
+        }
+
+        if (hashFits) {
+            return CommsDispatchKind::Hash;
+        }
+
+        return CommsDispatchKind::Switch;
+    }
+
+    if (strategy == CommsDispatchStrategy::Table) {
+        if (!tableFits) {
+            m_commsGenerator.genLogger().genWarning(
+                "The range of message IDs is too large for the direct dispatch table, using switch statement instead.");
+            return CommsDispatchKind::Switch;
+        }
+
+        return CommsDispatchKind::Table;
+    }
+
+    assert(strategy == CommsDispatchStrategy::Hash);
+    if (!hashFits) {
+        m_commsGenerator.genLogger().genWarning(
+            "The message IDs don't fit into 32 bits required by the perfect hash dispatch, using switch statement instead.");
+        return CommsDispatchKind::Switch;
+    }
+
+    return CommsDispatchKind::Hash;
+}
+
+std::string CommsDispatch::commsSwitchBodyCodeInternal(const CommsMessagesMap& map) const
+{
+    static const std::string Templ =
+        "using InterfaceType = typename std::decay<decltype(msg)>::type;\n"
+        "#^#HOT#$#\n"
+        "switch(static_cast<std::intmax_t>(id)) {\n"
+        "#^#CASES#$#\n"
+        "default:\n"
+        "    break;\n"
+        "};\n\n"
+        "return handler.handle(msg);";
+
+    util::GenReplacementMap repl = {
+        {"CASES", commsCasesCodeInternal(map)},
+        {"HOT", commsHotPathCodeInternal(map)},
+    };
+
+    return util::genProcessTemplate(Templ, repl);
+}
+
+std::string CommsDispatch::commsHotPathCodeInternal(const CommsMessagesMap& map) const
+{
+    GenMessagesList messages;
+    for (auto& elem : map) {
+        messages.insert(messages.end(), elem.second.begin(), elem.second.end());
+    }
+
+    auto hotMessages = m_commsGenerator.commsHotMessages(messages);
+    if (hotMessages.empty()) {
+        return strings::genEmptyString();
+    }
+
+    static const std::string Templ =
+        "if (static_cast<std::intmax_t>(id) == #^#MSG_ID#$#) {\n"
+        "    using MsgType = #^#MSG_TYPE#$#<InterfaceType, TProtOptions>;\n"
+        "    return handler.handle(static_cast<MsgType&>(msg));\n"
+        "}\n";
+
+    util::GenStringsList checks;
+    for (auto* m : hotMessages) {
+        util::GenReplacementMap repl = {
+            {"MSG_ID", util::genNumToStringWithHexComment(m->genParseObj().parseId())},
+            {"MSG_TYPE", comms::genScopeFor(*m, m_commsGenerator)},
+        };
+
+        checks.push_back(util::genProcessTemplate(Templ, repl));
+    }
+
+    return "// Fast path for the most frequent messages\n" + util::genStrListToString(checks, "\n", "");
+}
+
+std::string CommsDispatch::commsHelperBodyCodeInternal(const std::string& name, const CommsMessagesMap& map) const
+{
+    static const std::string Templ =
+        "#^#HOT#$#\n"
+        "using HelperType = Dispatch#^#NAME#$#MessageHelper<TProtOptions, TMsg, THandler>;\n"
+        "return HelperType::dispatch(static_cast<std::intmax_t>(id), msg, handler);";
+
+    util::GenReplacementMap repl = {
+        {"NAME", name},
+    };
+
+    auto hot = commsHotPathCodeInternal(map);
+    if (!hot.empty()) {
+        repl["HOT"] =
+            "using InterfaceType = typename std::decay<decltype(msg)>::type;\n" +
+            std::move(hot);
+    }
+
+    return util::genProcessTemplate(Templ, repl);
+}
+
+std::string CommsDispatch::commsHelperCodeInternal(const std::string& name, const std::string& lookup) const
+{
+    static const std::string Templ =
+        "/// @brief Auxiliary class used by dispatch#^#NAME#$#Message().\n"
+        "/// @details Not expected to be used directly.\n"
+        "/// @note Defined in #^#HEADERFILE#$#\n"
+        "template<typename TProtOptions, typename TMsg, typename THandler>\n"
+        "struct Dispatch#^#NAME#$#MessageHelper\n"
+        "{\n"
+        "    /// @brief Interface class of the dispatched message.\n"
+        "    using InterfaceType = typename std::decay<TMsg>::type;\n\n"
+        "    /// @brief Return type of the handling functions.\n"
+        "    using RetType = decltype(std::declval<THandler&>().handle(std::declval<TMsg&>()));\n\n"
+        "    /// @brief Type of the handling function pointer.\n"
+        "    using FuncPtr = RetType (*)(TMsg&, THandler&);\n\n"
+        "    /// @brief Cast the message object to its actual type and invoke the handler.\n"
+        "    template<typename TMsgType>\n"
+        "    static RetType handleMsg(TMsg& msg, THandler& handler)\n"
+        "    {\n"
+        "        return handler.handle(static_cast<TMsgType&>(msg));\n"
+        "    }\n\n"
+        "    /// @brief Invoke the handler of the interface class.\n"
+        "    static RetType handleInterface(TMsg& msg, THandler& handler)\n"
+        "    {\n"
+        "        return handler.handle(msg);\n"
+        "    }\n\n"
+        "#^#MIX#$#\n"
+        "    /// @brief Dispatch message object to its appropriate handling function.\n"
+        "    static RetType dispatch(std::intmax_t id, TMsg& msg, THandler& handler)\n"
+        "    {\n"
+        "        #^#LOOKUP#$#\n"
+        "    }\n"
+        "};\n";
+
+    util::GenReplacementMap repl = {
+        {"NAME", name},
+        {"HEADERFILE", comms::genRelHeaderForDispatch(commsGetFileName(name), m_commsGenerator, m_commsParent)},
+        {"LOOKUP", lookup},
+    };
+
+    if (lookup.find("mix(") != std::string::npos) {
+        repl["MIX"] =
+            "    /// @brief Hash function of the message ID.\n"
+            "    static std::uint32_t mix(std::uint32_t key, std::uint32_t seed)\n"
+            "    {\n"
+            "        std::uint32_t h = key ^ seed;\n"
+            "        h ^= h >> 16;\n"
+            "        h *= 0x7feb352dU;\n"
+            "        h ^= h >> 15;\n"
+            "        h *= 0x846ca68bU;\n"
+            "        h ^= h >> 16;\n"
+            "        return h;\n"
+            "    }\n";
+    }
+
+    return util::genProcessTemplate(Templ, repl);
+}
+
+std::string CommsDispatch::commsTableLookupCodeInternal(const CommsMessagesMap& map) const
+{
+    static const std::string Templ =
+        "static const FuncPtr Table[] = {\n"
+        "    #^#FUNCS#$#\n"
+        "};\n"
+        "static const std::intmax_t MinId = #^#MIN_ID#$#;\n"
+        "static const std::size_t TableSize = std::extent<decltype(Table)>::value;\n"
+        "if (id < MinId) {\n"
+        "    return handleInterface(msg, handler);\n"
+        "}\n\n"
+        "auto idx = static_cast<std::uintmax_t>(id) - static_cast<std::uintmax_t>(MinId);\n"
+        "if (TableSize <= idx) {\n"
+        "    return handleInterface(msg, handler);\n"
+        "}\n\n"
+        "return Table[static_cast<std::size_t>(idx)](msg, handler);";
+
+    std::map<std::intmax_t, const GenMessage*> sorted;
+    for (auto& elem : map) {
+        assert(elem.second.size() == 1U);
+        sorted[static_cast<std::intmax_t>(elem.first)] = elem.second.front();
+    }
+
+    assert(!sorted.empty());
+    auto minId = sorted.begin()->first;
+    auto maxId = sorted.rbegin()->first;
+    util::GenStringsList funcs;
+    for (auto id = minId; ; ++id) {
+        auto iter = sorted.find(id);
+        if (iter == sorted.end()) {
+            funcs.push_back("&handleInterface, // " + util::genNumToString(id));
+        }
+        else {
+            funcs.push_back(commsHandleFuncInternal(*iter->second) + ", // " + util::genNumToString(id));
+        }
+
+        if (id == maxId) {
+            break;
+        }
+    }
+
+    util::GenReplacementMap repl = {
+        {"FUNCS", util::genStrListToString(funcs, "\n", "")},
+        {"MIN_ID", util::genNumToString(minId)},
+    };
+
+    return util::genProcessTemplate(Templ, repl);
+}
+
+std::string CommsDispatch::commsHashLookupCodeInternal(const CommsMessagesMap& map) const
+{
+    static const std::string Templ =
+        "static const std::uint32_t Seed = #^#SEED#$#;\n"
+        "static const std::uint32_t Displacements[] = {\n"
+        "    #^#DISPLACEMENTS#$#\n"
+        "};\n"
+        "static const std::uint32_t Ids[] = {\n"
+        "    #^#IDS#$#\n"
+        "};\n"
+        "static const FuncPtr Funcs[] = {\n"
+        "    #^#FUNCS#$#\n"
+        "};\n"
+        "static const std::uint32_t Count = static_cast<std::uint32_t>(std::extent<decltype(Ids)>::value);\n"
+        "static_assert(std::extent<decltype(Displacements)>::value == Count, \"Invalid displacements table\");\n"
+        "static_assert(std::extent<decltype(Funcs)>::value == Count, \"Invalid functions table\");\n"
+        "if ((id < 0) || (static_cast<std::intmax_t>(0xffffffffUL) < id)) {\n"
+        "    return handleInterface(msg, handler);\n"
+        "}\n\n"
+        "auto key = static_cast<std::uint32_t>(id);\n"
+        "auto slot = mix(key, Displacements[mix(key, Seed) % Count]) % Count;\n"
+        "if (Ids[slot] != key) {\n"
+        "    return handleInterface(msg, handler);\n"
+        "}\n\n"
+        "return Funcs[slot](msg, handler);";
+
+    std::vector<std::uint32_t> keys;
+    std::vector<const GenMessage*> messages;
+    keys.reserve(map.size());
+    messages.reserve(map.size());
+    for (auto& elem : map) {
+        assert(elem.second.size() == 1U);
+        keys.push_back(static_cast<std::uint32_t>(elem.first));
+        messages.push_back(elem.second.front());
+    }
+
+    CommsPerfectHash hash;
+    if (!commsBuildPerfectHash(keys, hash)) {
+        return strings::genEmptyString();
+    }
+
+    util::GenStringsList displacements;
+    for (auto d : hash.m_displacements) {
+        displacements.push_back(std::to_string(d) + "U,");
+    }
+
+    util::GenStringsList ids;
+    util::GenStringsList funcs;
+    for (auto idx : hash.m_slots) {
+        ids.push_back(std::to_string(keys[idx]) + "U,");
+        funcs.push_back(commsHandleFuncInternal(*messages[idx]) + ",");
+    }
+
+    util::GenReplacementMap repl = {
+        {"SEED", std::to_string(hash.m_seed) + "U"},
+        {"DISPLACEMENTS", util::genStrListToString(displacements, "\n", "")},
+        {"IDS", util::genStrListToString(ids, "\n", "")},
+        {"FUNCS", util::genStrListToString(funcs, "\n", "")},
+    };
+
+    return util::genProcessTemplate(Templ, repl);
+}
+
+std::string CommsDispatch::commsHandleFuncInternal(const GenMessage& msg) const
+{
+    return "&handleMsg<" + comms::genScopeFor(msg, m_commsGenerator) + "<InterfaceType, TProtOptions> >";
+}
+
 std::string CommsDispatch::commsMsgDispatcherCodeInternal(const std::string& inputPrefix) const
 {
     static const std::string Templ =
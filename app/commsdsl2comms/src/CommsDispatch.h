@@ -21,6 +21,8 @@
 #include <cstdint>
 #include <functional>
 #include <map>
+#include <string>
+#include <vector>
 
 namespace commsdsl2comms
 {
@@ -40,6 +42,14 @@ private:
 
     using CommsCheckMsgFunc = std::function<bool (const GenMessage& msg)>;
     using CommsMessagesMap = std::map<std::uintmax_t, GenMessagesList>;
+    using CommsIncludesList = std::vector<std::string>;
+
+    enum class CommsDispatchKind
+    {
+        Switch,
+        Table,
+        Hash
+    };
 
     bool commsWriteDispatchInternal() const;
     bool commsWriteClientDispatchInternal() const;
@@ -47,9 +57,17 @@ private:
     bool commsWritePlatformDispatchInternal() const;
     bool commsWriteExtraDispatchInternal() const;
 
-    std::string commsIncludesInternal(const std::string& inputPrefix) const;
-    std::string commsDispatchCodeInternal(const std::string& name, CommsCheckMsgFunc&& func) const;
+    std::string commsIncludesInternal(const std::string& inputPrefix, const CommsIncludesList& extraIncludes) const;
+    std::string commsDispatchCodeInternal(const std::string& name, CommsCheckMsgFunc&& func, CommsIncludesList& extraIncludes) const;
     std::string commsCasesCodeInternal(const CommsMessagesMap& map) const;
+    CommsDispatchKind commsDispatchKindInternal(const CommsMessagesMap& map) const;
+    std::string commsSwitchBodyCodeInternal(const CommsMessagesMap& map) const;
+    std::string commsHotPathCodeInternal(const CommsMessagesMap& map) const;
+    std::string commsHelperBodyCodeInternal(const std::string& name, const CommsMessagesMap& map) const;
+    std::string commsHelperCodeInternal(const std::string& name, const std::string& lookup) const;
+    std::string commsTableLookupCodeInternal(const CommsMessagesMap& map) const;
+    std::string commsHashLookupCodeInternal(const CommsMessagesMap& map) const;
+    std::string commsHandleFuncInternal(const GenMessage& msg) const;
     std::string commsMsgDispatcherCodeInternal(const std::string& inputPrefix) const;
 
     CommsGenerator& m_commsGenerator;
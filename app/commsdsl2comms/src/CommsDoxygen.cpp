@@ -25,7 +25,6 @@
 
 #include <algorithm>
 #include <cassert>
-#include <fstream>
 
 namespace comms = commsdsl::gen::comms;
 namespace strings = commsdsl::gen::strings;
@@ -53,17 +52,7 @@ bool commsWriteFileInternal(const std::string& name, const std::string& str, Com
         return false;
     }
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        generator.genLogger().genError("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
-
-    stream << str;
-    stream.flush();
-
-    if (!stream.good()) {
-        generator.genLogger().genError("Failed to write \"" + filePath + "\".");
+    if (!generator.genWriteFile(filePath, str)) {
         return false;
     }
     return true;
@@ -791,12 +780,19 @@ std::string CommsDoxygen::commsCustomizeDocInternal() const
         "/// @b #^#DATA_VIEW_OPTIONS_HDR#$# file) where relevant fields apply @b comms::option::app::OrigDataView\n"
         "/// option.\n"
         "///\n"
+        "/// For the applications where the processing speed matters the most there is\n"
+        "/// #^#HIGH_THROUGHPUT_OPTIONS#$# (defined in @b #^#HIGH_THROUGHPUT_OPTIONS_HDR#$# file).\n"
+        "/// It combines the @b comms::option::app::OrigDataView for the relevant fields, fixed\n"
+        "/// size storage for the lists with fixed number of elements and #^#HIGH_THROUGHPUT_ALLOC#$#\n"
+        "/// allocation of the message objects by the frames.\n"
+        "///\n"
         "/// Also note that the specified extension options are implemented as the following template classes\n"
         "/// which receive other options as their base class and apply relevant changes on top.\n"
         "/// @li @ref #^#CLIENT_OPTIONS#$#T\n"
         "/// @li @ref #^#SERVER_OPTIONS#$#T\n"
         "/// @li @ref #^#BARE_METAL_OPTIONS#$#T\n"
         "/// @li @ref #^#DATA_VIEW_OPTIONS#$#T\n"
+        "/// @li @ref #^#HIGH_THROUGHPUT_OPTIONS#$#T\n"
         "///\n"
         "/// As the result it is possible to combine them. For example:\n"
         "/// @code\n"
@@ -823,6 +819,9 @@ std::string CommsDoxygen::commsCustomizeDocInternal() const
         {"BARE_METAL_OPTIONS_HDR", comms::genRelHeaderForOptions(strings::genBareMetalStr() + strings::genDefaultOptionsStr(), m_commsGenerator)},
         {"DATA_VIEW_OPTIONS", comms::genScopeForOptions(strings::genDataViewStr() + strings::genDefaultOptionsStr(), m_commsGenerator)},
         {"DATA_VIEW_OPTIONS_HDR", comms::genRelHeaderForOptions(strings::genDataViewStr() + strings::genDefaultOptionsStr(), m_commsGenerator)},
+        {"HIGH_THROUGHPUT_OPTIONS", comms::genScopeForOptions(strings::genHighThroughputStr() + strings::genDefaultOptionsStr(), m_commsGenerator)},
+        {"HIGH_THROUGHPUT_OPTIONS_HDR", comms::genRelHeaderForOptions(strings::genHighThroughputStr() + strings::genDefaultOptionsStr(), m_commsGenerator)},
+        {"HIGH_THROUGHPUT_ALLOC", m_commsGenerator.commsGetPoolMsgFactories() ? "pooled" : "dynamic memory"},
     };
 
     return util::genProcessTemplate(Templ, repl);
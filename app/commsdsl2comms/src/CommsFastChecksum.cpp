@@ -0,0 +1,600 @@
+//
+// Copyright 2025 - 2025 (C). Alex Robenko. All rights reserved.
+//
+// SPDX-License-Identifier: Apache-2.0
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "CommsFastChecksum.h"
+
+#include "CommsGenerator.h"
+#include "CommsSchema.h"
+
+#include "commsdsl/gen/comms.h"
+#include "commsdsl/gen/strings.h"
+#include "commsdsl/gen/util.h"
+
+#include <cassert>
+#include <cstdint>
+#include <set>
+#include <vector>
+
+namespace comms = commsdsl::gen::comms;
+namespace strings = commsdsl::gen::strings;
+namespace util = commsdsl::gen::util;
+
+namespace commsdsl2comms
+{
+
+namespace
+{
+
+using ParseAlg = CommsFastChecksum::ParseAlg;
+
+struct CommsCrcParams
+{
+    unsigned m_width = 0U;
+    std::uint32_t m_poly = 0U;
+    std::uint32_t m_init = 0U;
+    std::uint32_t m_fin = 0U;
+    bool m_reflect = false;
+};
+
+// Same parameters as used by the comms::frame::checksum::Crc_* definitions
+const CommsCrcParams& commsCrcParamsInternal(ParseAlg alg)
+{
+    static const CommsCrcParams CrcCcitt = {16U, 0x1021U, 0xffffU, 0U, false};
+    static const CommsCrcParams Crc16 = {16U, 0x8005U, 0U, 0U, true};
+    static const CommsCrcParams Crc32 = {32U, 0x04c11db7U, 0xffffffffU, 0xffffffffU, true};
+
+    if (alg == ParseAlg::Crc_CCITT) {
+        return CrcCcitt;
+    }
+
+    if (alg == ParseAlg::Crc_16) {
+        return Crc16;
+    }
+
+    assert(alg == ParseAlg::Crc_32);
+    return Crc32;
+}
+
+std::uint32_t commsWidthMaskInternal(unsigned width)
+{
+    return static_cast<std::uint32_t>((static_cast<std::uint64_t>(1U) << width) - 1U);
+}
+
+std::uint32_t commsReflectInternal(std::uint32_t value, unsigned width)
+{
+    std::uint32_t result = 0U;
+    for (auto idx = 0U; idx < width; ++idx) {
+        if ((value & (static_cast<std::uint32_t>(1U) << idx)) != 0U) {
+            result |= static_cast<std::uint32_t>(1U) << (width - 1U - idx);
+        }
+    }
+    return result;
+}
+
+using CommsCrcTable = std::vector<std::vector<std::uint32_t> >;
+
+// Slicing-by-8 tables, Table[k][i] is the CRC register of byte i followed by k zero bytes
+CommsCrcTable commsCrcTableInternal(const CommsCrcParams& params)
+{
+    static const std::size_t NumOfSlices = 8U;
+    static const std::size_t NumOfEntries = 256U;
+
+    auto mask = commsWidthMaskInternal(params.m_width);
+    auto topShift = params.m_width - 8U;
+    auto polyReflected = commsReflectInternal(params.m_poly, params.m_width);
+    auto topBit = static_cast<std::uint32_t>(1U) << (params.m_width - 1U);
+
+    CommsCrcTable result(NumOfSlices, std::vector<std::uint32_t>(NumOfEntries));
+    for (auto idx = 0U; idx < NumOfEntries; ++idx) {
+        std::uint32_t value = 0U;
+        if (params.m_reflect) {
+            value = idx;
+            for (auto bitIdx = 0U; bitIdx < 8U; ++bitIdx) {
+                value = ((value & 1U) != 0U) ? ((value >> 1U) ^ polyReflected) : (value >> 1U);
+            }
+        }
+        else {
+            value = idx << topShift;
+            for (auto bitIdx = 0U; bitIdx < 8U; ++bitIdx) {
+                value = ((value & topBit) != 0U) ? ((value << 1U) ^ params.m_poly) : (value << 1U);
+                value &= mask;
+            }
+        }
+
+        result[0][idx] = value;
+    }
+
+    for (auto sliceIdx = 1U; sliceIdx < NumOfSlices; ++sliceIdx) {
+        auto& prevSlice = result[sliceIdx - 1U];
+        for (auto idx = 0U; idx < NumOfEntries; ++idx) {
+            auto prev = prevSlice[idx];
+            if (params.m_reflect) {
+                result[sliceIdx][idx] = (prev >> 8U) ^ result[0][prev & 0xffU];
+                continue;
+            }
+
+            result[sliceIdx][idx] = ((prev << 8U) & mask) ^ result[0][(prev >> topShift) & 0xffU];
+        }
+    }
+
+    return result;
+}
+
+std::string commsCrcTableCodeInternal(const CommsCrcParams& params)
+{
+    static const std::size_t ValuesPerLine = 8U;
+
+    auto table = commsCrcTableInternal(params);
+    util::GenStringsList slices;
+    for (auto& slice : table) {
+        util::GenStringsList lines;
+        for (auto lineIdx = 0U; lineIdx < slice.size(); lineIdx += ValuesPerLine) {
+            util::GenStringsList values;
+            for (auto idx = lineIdx; idx < (lineIdx + ValuesPerLine); ++idx) {
+                values.push_back(util::genNumToString(static_cast<std::uintmax_t>(slice[idx]), params.m_width / 4U));
+            }
+            lines.push_back(util::genStrListToString(values, ", ", ""));
+        }
+
+        slices.push_back("{\n    " + util::genStrListToString(lines, ",\n    ", "") + "\n}");
+    }
+
+    return util::genStrListToString(slices, ",\n", "");
+}
+
+std::string commsCrcByteStepInternal(const CommsCrcParams& params, const std::string& type)
+{
+    if (params.m_reflect) {
+        return "crc = static_cast<" + type + ">((crc >> 8) ^ t[0][(crc ^ byte) & 0xFFU]);";
+    }
+
+    return
+        "crc = static_cast<" + type + ">((crc << 8) ^ t[0][((crc >> " +
+        std::to_string(params.m_width - 8U) + ") ^ byte) & 0xFFU]);";
+}
+
+std::string commsCrcBlockStepInternal(const CommsCrcParams& params, const std::string& type)
+{
+    static const unsigned NumOfSlices = 8U;
+
+    auto crcBytes = params.m_width / 8U;
+    util::GenStringsList lookups;
+    for (auto idx = 0U; idx < NumOfSlices; ++idx) {
+        auto sliceStr = std::to_string(NumOfSlices - 1U - idx);
+        auto byteStr = "bytes[" + std::to_string(idx) + "]";
+        if (crcBytes <= idx) {
+            lookups.push_back("t[" + sliceStr + "][" + byteStr + "]");
+            continue;
+        }
+
+        unsigned shift = idx * 8U;
+        if (!params.m_reflect) {
+            shift = params.m_width - 8U - shift;
+        }
+
+        std::string crcStr = "crc";
+        if (shift != 0U) {
+            crcStr = "(crc >> " + std::to_string(shift) + ")";
+        }
+
+        lookups.push_back("t[" + sliceStr + "][(" + crcStr + " ^ " + byteStr + ") & 0xFFU]");
+    }
+
+    return
+        "crc = static_cast<" + type + ">(\n    " +
+        util::genStrListToString(lookups, " ^\n    ", "") + ");";
+}
+
+} // namespace
+
+bool CommsFastChecksum::commsWrite(CommsGenerator& generator)
+{
+    if (!generator.commsGetFastChecksums()) {
+        return true;
+    }
+
+    std::set<ParseAlg> algs;
+    for (auto* frame : generator.genGetAllFrames()) {
+        for (auto& layer : frame->genLayers()) {
+            auto parseObj = layer->genParseObj();
+            if (parseObj.parseKind() != commsdsl::parse::ParseLayer::ParseKind::Checksum) {
+                continue;
+            }
+
+            auto alg = commsdsl::parse::ParseChecksumLayer(parseObj).parseAlg();
+            if (commsClassName(alg).empty()) {
+                continue;
+            }
+
+            algs.insert(alg);
+        }
+    }
+
+    for (auto alg : algs) {
+        CommsFastChecksum obj(generator, alg);
+        if (!obj.commsWriteInternal()) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+const std::string& CommsFastChecksum::commsClassName(ParseAlg alg)
+{
+    static const std::string ClassMap[] = {
+        /* Custom */ strings::genEmptyString(),
+        /* Sum */ "FastSum",
+        /* Crc_CCITT */ "FastCrc_CCITT",
+        /* Crc_16 */ "FastCrc_16",
+        /* Crc_32 */ "FastCrc_32",
+        /* Xor */ "FastXor",
+    };
+
+    static const std::size_t ClassMapSize = std::extent<decltype(ClassMap)>::value;
+    static_assert(ClassMapSize == static_cast<std::size_t>(ParseAlg::NumOfValues),
+            "Invalid map");
+
+    auto idx = static_cast<std::size_t>(alg);
+    if (ClassMapSize <= idx) {
+        [[maybe_unused]] static constexpr bool Should_not_happen = false;
+        assert(Should_not_happen);
+        return strings::genEmptyString();
+    }
+
+    return ClassMap[idx];
+}
+
+bool CommsFastChecksum::commsWriteInternal() const
+{
+    auto& className = commsClassName(m_alg);
+    auto filePath =
+        m_commsGenerator.genGetOutputDir() + '/' + strings::genIncludeDirStr() + '/' +
+        comms::genRelHeaderForChecksum(className, m_commsGenerator);
+
+    m_commsGenerator.genLogger().genInfo("Generating " + filePath);
+
+    auto dirPath = util::genPathUp(filePath);
+    assert(!dirPath.empty());
+    if (!m_commsGenerator.genCreateDirectory(dirPath)) {
+        return false;
+    }
+
+    const std::string Templ =
+        "#^#GENERATED#$#\n"
+        "/// @file\n"
+        "/// @brief Contains definition of @ref #^#SCOPE#$# checksum calculator.\n\n"
+        "#pragma once\n\n"
+        "#^#INCLUDES#$#\n"
+        "namespace #^#PROT_NAMESPACE#$#\n"
+        "{\n\n"
+        "namespace frame\n"
+        "{\n\n"
+        "namespace checksum\n"
+        "{\n\n"
+        "#^#CODE#$#\n"
+        "} // namespace checksum\n\n"
+        "} // namespace frame\n\n"
+        "} // namespace #^#PROT_NAMESPACE#$#\n";
+
+    bool wordWise = (m_alg == ParseAlg::Sum) || (m_alg == ParseAlg::Xor);
+
+    util::GenStringsList includes = {
+        "<cstddef>",
+        "<cstdint>",
+        "<type_traits>",
+    };
+
+    if (wordWise) {
+        util::genAddToStrList("<algorithm>", includes);
+        util::genAddToStrList("<cstring>", includes);
+    }
+
+    comms::genPrepareIncludeStatement(includes);
+
+    auto includesStr = util::genStrListToString(includes, "\n", "\n");
+    if (m_alg == ParseAlg::Crc_32) {
+        includesStr +=
+            "#if defined(__PCLMUL__) && defined(__SSE4_1__)\n"
+            "#include <immintrin.h>\n"
+            "#endif // #if defined(__PCLMUL__) && defined(__SSE4_1__)\n\n";
+    }
+
+    util::GenReplacementMap repl = {
+        {"GENERATED", CommsGenerator::commsFileGeneratedComment()},
+        {"SCOPE", comms::genScopeForChecksum(className, m_commsGenerator)},
+        {"INCLUDES", std::move(includesStr)},
+        {"PROT_NAMESPACE", m_commsGenerator.genCurrentSchema().genMainNamespace()},
+        {"CODE", wordWise ? commsWordWiseCodeInternal() : commsCrcCodeInternal()},
+    };
+
+    return m_commsGenerator.genWriteFile(filePath, util::genProcessTemplate(Templ, repl, true));
+}
+
+std::string CommsFastChecksum::commsWordWiseCodeInternal() const
+{
+    static const std::string Templ =
+        "/// @brief Word-wise equivalent of the @b comms::frame::checksum::#^#GENERIC#$#.\n"
+        "/// @details Processes 8 bytes per iteration when the iterator is a pointer to\n"
+        "///     a single byte type, falls back to the byte-by-byte processing otherwise.\n"
+        "/// @tparam TResult Type of the checksum value.\n"
+        "template <typename TResult = std::uint8_t>\n"
+        "class #^#CLASS_NAME#$#\n"
+        "{\n"
+        "public:\n"
+        "    /// @brief Calculate the checksum.\n"
+        "    /// @param[in, out] iter Input iterator, advanced by @b len bytes.\n"
+        "    /// @param[in] len Number of bytes to process.\n"
+        "    template <typename TIter>\n"
+        "    TResult operator()(TIter& iter, std::size_t len) const\n"
+        "    {\n"
+        "        using IterType = typename std::decay<TIter>::type;\n"
+        "        using Tag =\n"
+        "            typename std::conditional<\n"
+        "                std::is_pointer<IterType>::value && (sizeof(typename std::remove_pointer<IterType>::type) == 1U),\n"
+        "                PointerTag,\n"
+        "                GenericTag\n"
+        "            >::type;\n\n"
+        "        return static_cast<TResult>(calcInternal(iter, len, Tag()));\n"
+        "    }\n\n"
+        "private:\n"
+        "    struct PointerTag {};\n"
+        "    struct GenericTag {};\n\n"
+        "    template <typename TIter>\n"
+        "    static std::uint64_t calcInternal(TIter& iter, std::size_t len, GenericTag)\n"
+        "    {\n"
+        "        std::uint64_t result = 0U;\n"
+        "        for (std::size_t idx = 0U; idx < len; ++idx) {\n"
+        "            result #^#OP#$# static_cast<std::uint8_t>(*iter);\n"
+        "            ++iter;\n"
+        "        }\n"
+        "        return result;\n"
+        "    }\n\n"
+        "    template <typename TIter>\n"
+        "    static std::uint64_t calcInternal(TIter& iter, std::size_t len, PointerTag)\n"
+        "    {\n"
+        "        auto* bytes = reinterpret_cast<const std::uint8_t*>(iter);\n"
+        "        iter += len;\n\n"
+        "        #^#WORDS#$#\n"
+        "        for (; 0U < len; --len) {\n"
+        "            result #^#OP#$# *bytes;\n"
+        "            ++bytes;\n"
+        "        }\n"
+        "        return result;\n"
+        "    }\n"
+        "};\n";
+
+    static const std::string SumWords =
+        "std::uint64_t result = 0U;\n"
+        "while (8U <= len) {\n"
+        "    // The 16 bit lanes can accumulate up to 128 words without overflow\n"
+        "    auto words = std::min(len / 8U, static_cast<std::size_t>(128U));\n"
+        "    std::uint64_t lanes = 0U;\n"
+        "    for (std::size_t idx = 0U; idx < words; ++idx) {\n"
+        "        std::uint64_t word = 0U;\n"
+        "        std::memcpy(&word, bytes, sizeof(word));\n"
+        "        lanes += (word & 0x00FF00FF00FF00FFULL) + ((word >> 8) & 0x00FF00FF00FF00FFULL);\n"
+        "        bytes += sizeof(word);\n"
+        "    }\n\n"
+        "    len -= words * 8U;\n"
+        "    lanes = (lanes & 0x0000FFFF0000FFFFULL) + ((lanes >> 16) & 0x0000FFFF0000FFFFULL);\n"
+        "    result += (lanes & 0xFFFFFFFFULL) + (lanes >> 32);\n"
+        "}\n";
+
+    static const std::string XorWords =
+        "std::uint64_t lanes = 0U;\n"
+        "while (8U <= len) {\n"
+        "    std::uint64_t word = 0U;\n"
+        "    std::memcpy(&word, bytes, sizeof(word));\n"
+        "    lanes ^= word;\n"
+        "    bytes += sizeof(word);\n"
+        "    len -= sizeof(word);\n"
+        "}\n\n"
+        "lanes ^= (lanes >> 32);\n"
+        "lanes ^= (lanes >> 16);\n"
+        "lanes ^= (lanes >> 8);\n"
+        "std::uint64_t result = (lanes & 0xFFU);\n";
+
+    bool sum = (m_alg == ParseAlg::Sum);
+    util::GenReplacementMap repl = {
+        {"GENERIC", sum ? "BasicSum" : "BasicXor"},
+        {"CLASS_NAME", commsClassName(m_alg)},
+        {"OP", sum ? "+=" : "^="},
+        {"WORDS", sum ? SumWords : XorWords},
+    };
+
+    return util::genProcessTemplate(Templ, repl);
+}
+
+std::string CommsFastChecksum::commsCrcCodeInternal() const
+{
+    static const std::string Templ =
+        "/// @brief Table driven (slicing-by-8) equivalent of the @b comms::frame::checksum::#^#GENERIC#$#.\n"
+        "/// @details Processes 8 bytes per iteration when the iterator is a pointer to\n"
+        "///     a single byte type, falls back to the byte-by-byte table lookup otherwise.\n"
+        "#^#EXTRA_DOC#$#\n"
+        "class #^#CLASS_NAME#$#\n"
+        "{\n"
+        "public:\n"
+        "    /// @brief Calculate the checksum.\n"
+        "    /// @param[in, out] iter Input iterator, advanced by @b len bytes.\n"
+        "    /// @param[in] len Number of bytes to process.\n"
+        "    template <typename TIter>\n"
+        "    #^#TYPE#$# operator()(TIter& iter, std::size_t len) const\n"
+        "    {\n"
+        "        using IterType = typename std::decay<TIter>::type;\n"
+        "        using Tag =\n"
+        "            typename std::conditional<\n"
+        "                std::is_pointer<IterType>::value && (sizeof(typename std::remove_pointer<IterType>::type) == 1U),\n"
+        "                PointerTag,\n"
+        "                GenericTag\n"
+        "            >::type;\n\n"
+        "        auto crc = calcInternal(iter, len, #^#INIT#$#, Tag());\n"
+        "        #^#RETURN#$#\n"
+        "    }\n\n"
+        "private:\n"
+        "    struct PointerTag {};\n"
+        "    struct GenericTag {};\n"
+        "    using TableType = #^#TYPE#$#[8][256];\n\n"
+        "    template <typename TIter>\n"
+        "    static #^#TYPE#$# calcInternal(TIter& iter, std::size_t len, #^#TYPE#$# crc, GenericTag)\n"
+        "    {\n"
+        "        auto& t = table();\n"
+        "        for (std::size_t idx = 0U; idx < len; ++idx) {\n"
+        "            auto byte = static_cast<std::uint8_t>(*iter);\n"
+        "            #^#BYTE_STEP#$#\n"
+        "            ++iter;\n"
+        "        }\n"
+        "        return crc;\n"
+        "    }\n\n"
+        "    template <typename TIter>\n"
+        "    static #^#TYPE#$# calcInternal(TIter& iter, std::size_t len, #^#TYPE#$# crc, PointerTag)\n"
+        "    {\n"
+        "        auto* bytes = reinterpret_cast<const std::uint8_t*>(iter);\n"
+        "        iter += len;\n\n"
+        "#^#CLMUL_CALL#$#\n"
+        "        auto& t = table();\n"
+        "        while (8U <= len) {\n"
+        "            #^#BLOCK_STEP#$#\n"
+        "            bytes += 8;\n"
+        "            len -= 8U;\n"
+        "        }\n\n"
+        "        for (; 0U < len; --len) {\n"
+        "            auto byte = *bytes;\n"
+        "            #^#BYTE_STEP#$#\n"
+        "            ++bytes;\n"
+        "        }\n"
+        "        return crc;\n"
+        "    }\n\n"
+        "#^#CLMUL_FUNC#$#\n"
+        "    static const TableType& table()\n"
+        "    {\n"
+        "        static const TableType Table = {\n"
+        "            #^#TABLE#$#\n"
+        "        };\n"
+        "        return Table;\n"
+        "    }\n"
+        "};\n";
+
+    auto& params = commsCrcParamsInternal(m_alg);
+    auto type = "std::uint" + std::to_string(params.m_width) + "_t";
+    auto hexWidth = params.m_width / 4U;
+
+    std::string returnStr = "return crc;";
+    if (params.m_fin != 0U) {
+        returnStr =
+            "return static_cast<" + type + ">(crc ^ " +
+            util::genNumToString(static_cast<std::uintmax_t>(params.m_fin), hexWidth) + ");";
+    }
+
+    util::GenReplacementMap repl = {
+        {"GENERIC", commsClassName(m_alg).substr(4)},
+        {"CLASS_NAME", commsClassName(m_alg)},
+        {"TYPE", type},
+        {"INIT", util::genNumToString(static_cast<std::uintmax_t>(params.m_init), hexWidth)},
+        {"RETURN", std::move(returnStr)},
+        {"BYTE_STEP", commsCrcByteStepInternal(params, type)},
+        {"BLOCK_STEP", commsCrcBlockStepInternal(params, type)},
+        {"TABLE", commsCrcTableCodeInternal(params)},
+    };
+
+    if (m_alg != ParseAlg::Crc_32) {
+        return util::genProcessTemplate(Templ, repl);
+    }
+
+    repl["EXTRA_DOC"] =
+        "///     When compiled with PCLMUL and SSE4.1 instructions enabled the\n"
+        "///     buffers of at least 64 bytes are folded using the carry-less multiplication.";
+
+    repl["CLMUL_CALL"] =
+        "#if defined(__PCLMUL__) && defined(__SSE4_1__)\n"
+        "        if (64U <= len) {\n"
+        "            auto blocksLen = len & ~static_cast<std::size_t>(0xFU);\n"
+        "            crc = clmulInternal(bytes, blocksLen, crc);\n"
+        "            bytes += blocksLen;\n"
+        "            len -= blocksLen;\n"
+        "        }\n"
+        "#endif // #if defined(__PCLMUL__) && defined(__SSE4_1__)\n";
+
+    // Folding constants of the bit-reflected CRC32 polynomial, see the
+    // "Fast CRC Computation for Generic Polynomials Using PCLMULQDQ Instruction" paper.
+    repl["CLMUL_FUNC"] =
+        "#if defined(__PCLMUL__) && defined(__SSE4_1__)\n"
+        "    // Requires len to be multiple of 16 and at least 64.\n"
+        "    static std::uint32_t clmulInternal(const std::uint8_t* bytes, std::size_t len, std::uint32_t crc)\n"
+        "    {\n"
+        "        auto load =\n"
+        "            [](const std::uint8_t* ptr)\n"
+        "            {\n"
+        "                return _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr));\n"
+        "            };\n\n"
+        "        auto x1 = load(bytes);\n"
+        "        auto x2 = load(bytes + 0x10);\n"
+        "        auto x3 = load(bytes + 0x20);\n"
+        "        auto x4 = load(bytes + 0x30);\n"
+        "        x1 = _mm_xor_si128(x1, _mm_cvtsi32_si128(static_cast<int>(crc)));\n"
+        "        bytes += 64;\n"
+        "        len -= 64U;\n\n"
+        "        auto k = _mm_set_epi64x(0x01c6e41596LL, 0x0154442bd4LL);\n"
+        "        while (64U <= len) {\n"
+        "            auto x5 = _mm_clmulepi64_si128(x1, k, 0x00);\n"
+        "            auto x6 = _mm_clmulepi64_si128(x2, k, 0x00);\n"
+        "            auto x7 = _mm_clmulepi64_si128(x3, k, 0x00);\n"
+        "            auto x8 = _mm_clmulepi64_si128(x4, k, 0x00);\n\n"
+        "            x1 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x1, k, 0x11), x5), load(bytes));\n"
+        "            x2 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x2, k, 0x11), x6), load(bytes + 0x10));\n"
+        "            x3 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x3, k, 0x11), x7), load(bytes + 0x20));\n"
+        "            x4 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x4, k, 0x11), x8), load(bytes + 0x30));\n"
+        "            bytes += 64;\n"
+        "            len -= 64U;\n"
+        "        }\n\n"
+        "        k = _mm_set_epi64x(0x00ccaa009eLL, 0x01751997d0LL);\n"
+        "        auto fold =\n"
+        "            [&k](__m128i x, __m128i next)\n"
+        "            {\n"
+        "                auto lo = _mm_clmulepi64_si128(x, k, 0x00);\n"
+        "                auto hi = _mm_clmulepi64_si128(x, k, 0x11);\n"
+        "                return _mm_xor_si128(_mm_xor_si128(hi, lo), next);\n"
+        "            };\n\n"
+        "        x1 = fold(x1, x2);\n"
+        "        x1 = fold(x1, x3);\n"
+        "        x1 = fold(x1, x4);\n"
+        "        while (16U <= len) {\n"
+        "            x1 = fold(x1, load(bytes));\n"
+        "            bytes += 16;\n"
+        "            len -= 16U;\n"
+        "        }\n\n"
+        "        // Fold 128 bits to 64\n"
+        "        auto mask32 = _mm_setr_epi32(~0, 0, ~0, 0);\n"
+        "        x2 = _mm_clmulepi64_si128(x1, k, 0x10);\n"
+        "        x1 = _mm_xor_si128(_mm_srli_si128(x1, 8), x2);\n\n"
+        "        k = _mm_set_epi64x(0, 0x0163cd6124LL);\n"
+        "        x2 = _mm_srli_si128(x1, 4);\n"
+        "        x1 = _mm_clmulepi64_si128(_mm_and_si128(x1, mask32), k, 0x00);\n"
+        "        x1 = _mm_xor_si128(x1, x2);\n\n"
+        "        // Barrett reduction to 32 bits\n"
+        "        k = _mm_set_epi64x(0x01f7011641LL, 0x01db710641LL);\n"
+        "        x2 = _mm_clmulepi64_si128(_mm_and_si128(x1, mask32), k, 0x10);\n"
+        "        x2 = _mm_clmulepi64_si128(_mm_and_si128(x2, mask32), k, 0x00);\n"
+        "        x1 = _mm_xor_si128(x1, x2);\n"
+        "        return static_cast<std::uint32_t>(_mm_extract_epi32(x1, 1));\n"
+        "    }\n"
+        "#endif // #if defined(__PCLMUL__) && defined(__SSE4_1__)\n";
+
+    return util::genProcessTemplate(Templ, repl);
+}
+
+} // namespace commsdsl2comms
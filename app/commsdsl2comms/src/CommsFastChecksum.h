@@ -0,0 +1,50 @@
+//
+// Copyright 2025 - 2025 (C). Alex Robenko. All rights reserved.
+//
+// SPDX-License-Identifier: Apache-2.0
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "commsdsl/parse/ParseLayer.h"
+
+#include <string>
+
+namespace commsdsl2comms
+{
+
+class CommsGenerator;
+class CommsFastChecksum
+{
+public:
+    using ParseAlg = commsdsl::parse::ParseChecksumLayer::ParseAlg;
+
+    static bool commsWrite(CommsGenerator& generator);
+    static const std::string& commsClassName(ParseAlg alg);
+
+private:
+    CommsFastChecksum(CommsGenerator& generator, ParseAlg alg) :
+        m_commsGenerator(generator),
+        m_alg(alg)
+    {
+    }
+
+    bool commsWriteInternal() const;
+    std::string commsWordWiseCodeInternal() const;
+    std::string commsCrcCodeInternal() const;
+
+    CommsGenerator& m_commsGenerator;
+    ParseAlg m_alg = ParseAlg::Custom;
+};
+
+} // namespace commsdsl2comms
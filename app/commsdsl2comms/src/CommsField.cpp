@@ -22,13 +22,13 @@
 #include "CommsInterface.h"
 #include "CommsMessage.h"
 
+#include "commsdsl/gen/GenRefField.h"
 #include "commsdsl/gen/comms.h"
 #include "commsdsl/gen/strings.h"
 #include "commsdsl/gen/util.h"
 
 #include <algorithm>
 #include <cassert>
-#include <fstream>
 
 namespace comms = commsdsl::gen::comms;
 namespace strings = commsdsl::gen::strings;
@@ -84,6 +84,18 @@ CommsField::CommsFieldsList CommsField::commsTransformFieldsList(const GenFields
     return result;
 }
 
+const CommsField::GenField& CommsField::commsResolvedField(const GenField& field)
+{
+    auto* result = &field;
+    while (result->genParseObj().parseKind() == commsdsl::parse::ParseField::ParseKind::Ref) {
+        auto* refField = static_cast<const commsdsl::gen::GenRefField*>(result)->genReferencedField();
+        assert(refField != nullptr);
+        result = refField;
+    }
+
+    return *result;
+}
+
 bool CommsField::commsPrepare()
 {
     if (!commsCopyCodeFromInternal()) {
@@ -250,6 +262,12 @@ CommsField::CommsIncludesList CommsField::commsDefIncludes() const
         list.push_back("comms/field/Optional.h");
     }
 
+    if (static_cast<const CommsGenerator&>(generator).commsGetSkipFunctions()) {
+        list.push_back("<cstddef>");
+        list.push_back("<cstdint>");
+        list.push_back("comms/ErrorStatus.h");
+    }
+
     auto extraList = commsDefIncludesImpl();
     list.insert(list.end(), extraList.begin(), extraList.end());
 
@@ -360,6 +378,26 @@ bool CommsField::commsIsVersionOptional() const
     return comms::genIsVersionOptionalField(m_genField, m_genField.genGenerator());
 }
 
+bool CommsField::commsHasFixedLayout() const
+{
+    // Eligible for the read / write without intermediate length checks
+    if (m_customCode.m_hasRead ||
+        m_customCode.m_hasWrite ||
+        commsIsFailOnInvalid() ||
+        commsHasGeneratedReadCode() ||
+        commsIsVersionDependent() ||
+        commsHasCustomLength()) {
+        return false;
+    }
+
+    return commsMinLength() == commsMaxLength();
+}
+
+bool CommsField::commsIsFailOnInvalid() const
+{
+    return m_forcedFailOnInvalid || m_genField.genParseObj().parseIsFailOnInvalid();
+}
+
 bool CommsField::commsIsVersionDependent() const
 {
     if (!m_genField.genGenerator().genSchemaOf(m_genField).genVersionDependentCode()) {
@@ -396,6 +434,15 @@ std::string CommsField::commsBareMetalDefaultOptions() const
             true);
 }
 
+std::string CommsField::commsHighThroughputDefaultOptions() const
+{
+    return
+        commsCustomizationOptionsInternal(
+            &CommsField::commsHighThroughputDefaultOptions,
+            &CommsField::commsExtraHighThroughputDefaultOptionsInternal,
+            true);
+}
+
 bool CommsField::commsHasCustomValue() const
 {
     return m_customCode.m_hasValue;
@@ -647,6 +694,11 @@ std::string CommsField::commsDefValidFuncBodyImpl() const
     return strings::genEmptyString();
 }
 
+std::string CommsField::commsDefSkipFuncBodyImpl() const
+{
+    return strings::genEmptyString();
+}
+
 bool CommsField::commsIsLimitedCustomizableImpl() const
 {
     return false;
@@ -677,6 +729,11 @@ CommsField::GenStringsList CommsField::commsExtraBareMetalDefaultOptionsImpl() c
     return GenStringsList();
 }
 
+CommsField::GenStringsList CommsField::commsExtraHighThroughputDefaultOptionsImpl() const
+{
+    return GenStringsList();
+}
+
 std::size_t CommsField::commsMinLengthImpl() const
 {
     return m_genField.genParseObj().parseMinLength();
@@ -1170,12 +1227,6 @@ bool CommsField::commsWriteCommonInternal() const
     auto includes = commsCommonIncludes();
     comms::genPrepareIncludeStatement(includes);
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        logger.genError("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
-
     static const std::string Templ =
         "#^#GENERATED#$#\n"
         "/// @file\n"
@@ -1197,9 +1248,7 @@ bool CommsField::commsWriteCommonInternal() const
         {"DEF", commsCommonCode()},
     };
 
-    stream << util::genProcessTemplate(Templ, repl, true);
-    stream.flush();
-    return stream.good();
+    return generator.genWriteFile(filePath, util::genProcessTemplate(Templ, repl, true));
 }
 
 bool CommsField::commsWriteDefInternal() const
@@ -1213,12 +1262,6 @@ bool CommsField::commsWriteDefInternal() const
     auto includes = commsDefIncludes();
     comms::genPrepareIncludeStatement(includes);
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        logger.genError("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
-
     static const std::string Templ =
         "#^#GENERATED#$#\n"
         "/// @file\n"
@@ -1242,9 +1285,7 @@ bool CommsField::commsWriteDefInternal() const
         {"DEF", commsDefCode()},
     };
 
-    stream << util::genProcessTemplate(Templ, repl, true);
-    stream.flush();
-    return stream.good();
+    return generator.genWriteFile(filePath, util::genProcessTemplate(Templ, repl, true));
 }
 
 std::string CommsField::commsFieldDefCodeInternal() const
@@ -1591,6 +1632,7 @@ std::string CommsField::commsDefPublicCodeInternal() const
         "    #^#REFRESH#$#\n"
         "    #^#LENGTH#$#\n"
         "    #^#VALID#$#\n"
+        "    #^#SKIP#$#\n"
         "    #^#EXTRA_PUBLIC#$#\n"
     };
 
@@ -1605,6 +1647,7 @@ std::string CommsField::commsDefPublicCodeInternal() const
         {"REFRESH", commsDefRefreshFuncCodeInternal()},
         {"LENGTH", commsDefLengthFuncCodeInternal()},
         {"VALID", commsDefValidFuncCodeInternal()},
+        {"SKIP", commsDefSkipFuncCodeInternal()},
         {"EXTRA_PUBLIC", m_customCode.m_public},
     };
 
@@ -1951,6 +1994,92 @@ std::string CommsField::commsDefValidFuncCodeInternal() const
     return util::genProcessTemplate(Templ, repl);
 }
 
+std::string CommsField::commsDefSkipFuncCodeInternal() const
+{
+    auto& generator = static_cast<const CommsGenerator&>(m_genField.genGenerator());
+    if (!generator.commsGetSkipFunctions()) {
+        return strings::genEmptyString();
+    }
+
+    // The members of the bitfield are not serialized on their own
+    auto* parent = m_genField.genGetParent();
+    if ((parent != nullptr) &&
+        (parent->genElemType() == commsdsl::gen::GenElem::GenType_Field) &&
+        (static_cast<const GenField*>(parent)->genParseObj().parseKind() == commsdsl::parse::ParseField::ParseKind::Bitfield)) {
+        return strings::genEmptyString();
+    }
+
+    static const std::string Templ =
+        "/// @brief Determine serialization length of the field from the raw input buffer.\n"
+        "/// @details Follows the length / count prefixes and termination suffixes\n"
+        "///     without constructing the field object where possible. The field\n"
+        "///     values are validated only when invalid ones fail the read.\n"
+        "/// @param[in] buf Input buffer.\n"
+        "/// @param[in] len Number of bytes available in the buffer.\n"
+        "/// @param[out] consumed Number of bytes occupied by the field, updated only on success.\n"
+        "static comms::ErrorStatus skip(const std::uint8_t* buf, std::size_t len, std::size_t& consumed)\n"
+        "{\n"
+        "    #^#BODY#$#\n"
+        "}\n";
+
+    util::GenReplacementMap repl = {
+        {"BODY", commsDefSkipFuncBodyInternal()},
+    };
+
+    return util::genProcessTemplate(Templ, repl);
+}
+
+std::string CommsField::commsDefSkipFuncBodyInternal() const
+{
+    // Falls back to the read of the temporary field object when the
+    // serialization length cannot be determined without it.
+    static const std::string ReadTempl =
+        "#^#CLASS_NAME#$# field;\n"
+        "auto iter = buf;\n"
+        "auto es = field.read(iter, len);\n"
+        "if (es == comms::ErrorStatus::Success) {\n"
+        "    consumed = static_cast<std::size_t>(iter - buf);\n"
+        "}\n\n"
+        "return es;";
+
+    auto className = comms::genClassName(m_genField.genName());
+    if (commsIsVersionOptional()) {
+        className += strings::genVersionOptionalFieldSuffixStr();
+    }
+
+    if (m_extraCustomCode.m_hasExtend) {
+        className += strings::genOrigSuffixStr();
+    }
+
+    util::GenReplacementMap readRepl = {
+        {"CLASS_NAME", std::move(className)},
+    };
+
+    // The read of the field failing on invalid value must be checked as well
+    if (m_customCode.m_hasRead || commsIsVersionDependent() || commsIsFailOnInvalid()) {
+        return util::genProcessTemplate(ReadTempl, readRepl);
+    }
+
+    auto body = commsDefSkipFuncBodyImpl();
+    if (!body.empty()) {
+        return body;
+    }
+
+    if (commsHasGeneratedReadCode() ||
+        commsHasCustomLength() ||
+        (commsMinLength() != commsMaxLength())) {
+        return util::genProcessTemplate(ReadTempl, readRepl);
+    }
+
+    return
+        "static_cast<void>(buf);\n"
+        "if (len < Base::minLength()) {\n"
+        "    return comms::ErrorStatus::NotEnoughData;\n"
+        "}\n\n"
+        "consumed = Base::minLength();\n"
+        "return comms::ErrorStatus::Success;";
+}
+
 std::string CommsField::commsDefMembersCodeInternal() const
 {
     auto body = commsDefMembersCodeImpl();
@@ -2127,4 +2256,9 @@ CommsField::GenStringsList CommsField::commsExtraBareMetalDefaultOptionsInternal
     return commsExtraBareMetalDefaultOptionsImpl();
 }
 
+CommsField::GenStringsList CommsField::commsExtraHighThroughputDefaultOptionsInternal() const
+{
+    return commsExtraHighThroughputDefaultOptionsImpl();
+}
+
 } // namespace commsdsl2comms
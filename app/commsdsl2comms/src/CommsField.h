@@ -42,6 +42,7 @@ public:
     virtual ~CommsField();
 
     static CommsFieldsList commsTransformFieldsList(const GenFieldsList& fields);
+    static const GenField& commsResolvedField(const GenField& field);
 
     bool commsPrepare();
     bool commsWrite() const;
@@ -70,6 +71,8 @@ public:
     bool commsVerifyInnerRef(const std::string refStr) const;
 
     bool commsIsVersionOptional() const;
+    bool commsHasFixedLayout() const;
+    bool commsIsFailOnInvalid() const;
 
     void commsSetForcedFailOnInvalid()
     {
@@ -89,6 +92,7 @@ public:
     std::string commsDefaultOptions() const;
     std::string commsDataViewDefaultOptions() const;
     std::string commsBareMetalDefaultOptions() const;
+    std::string commsHighThroughputDefaultOptions() const;
 
     bool commsHasCustomValue() const;
     bool commsHasCustomValid() const;
@@ -133,12 +137,14 @@ protected:
     virtual std::string commsDefBundledRefreshFuncBodyImpl(const CommsFieldsList& siblings) const;
     virtual std::string commsDefLengthFuncBodyImpl() const;
     virtual std::string commsDefValidFuncBodyImpl() const;
+    virtual std::string commsDefSkipFuncBodyImpl() const;
     virtual bool commsIsLimitedCustomizableImpl() const;
     virtual bool commsIsVersionDependentImpl() const;
     virtual bool commsDefHasNameFuncImpl() const;
     virtual std::string commsMembersCustomizationOptionsBodyImpl(CommsFieldOptsFunc fieldOptsFunc) const;
     virtual GenStringsList commsExtraDataViewDefaultOptionsImpl() const;
     virtual GenStringsList commsExtraBareMetalDefaultOptionsImpl() const;
+    virtual GenStringsList commsExtraHighThroughputDefaultOptionsImpl() const;
     virtual std::size_t commsMinLengthImpl() const;
     virtual std::size_t commsMaxLengthImpl() const;
     virtual std::string commsValueAccessStrImpl(const std::string& accStr, const std::string& prefix) const;
@@ -239,6 +245,8 @@ private:
     std::string commsDefRefreshFuncCodeInternal() const;
     std::string commsDefLengthFuncCodeInternal() const;
     std::string commsDefValidFuncCodeInternal() const;
+    std::string commsDefSkipFuncCodeInternal() const;
+    std::string commsDefSkipFuncBodyInternal() const;
     std::string commsDefMembersCodeInternal() const;
     std::string commsCommonMembersCodeInternal() const;
     std::string commsCustomizationOptionsInternal(
@@ -247,6 +255,7 @@ private:
         bool hasBase) const;
     GenStringsList commsExtraDataViewDefaultOptionsInternal() const;
     GenStringsList commsExtraBareMetalDefaultOptionsInternal() const;
+    GenStringsList commsExtraHighThroughputDefaultOptionsInternal() const;
 
     GenField& m_genField;
     CommsCustomCode m_customCode;
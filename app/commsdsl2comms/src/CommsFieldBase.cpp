@@ -24,7 +24,6 @@
 #include "commsdsl/gen/comms.h"
 
 #include <cassert>
-#include <fstream>
 
 namespace comms = commsdsl::gen::comms;
 namespace strings = commsdsl::gen::strings;
@@ -56,12 +55,6 @@ bool CommsFieldBase::commsWriteInternal() const
         return false;
     }
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        m_commsGenerator.genLogger().genError("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
-
     const std::string Templ =
         "#^#GENERATED#$#\n"
         "/// @file\n"
@@ -95,11 +88,7 @@ bool CommsFieldBase::commsWriteInternal() const
         {"OPTIONS", util::genStrListToString(options, ",\n", "")},
     };
 
-    stream << util::genProcessTemplate(Templ, repl, true);
-    stream.flush();
-
-    if (!stream.good()) {
-        m_commsGenerator.genLogger().genError("Failed to write \"" + filePath + "\".");
+    if (!m_commsGenerator.genWriteFile(filePath, util::genProcessTemplate(Templ, repl, true))) {
         return false;
     }
 
@@ -16,8 +16,11 @@
 
 #include "CommsFrame.h"
 
+#include "CommsChecksumLayer.h"
 #include "CommsCustomLayer.h"
+#include "CommsField.h"
 #include "CommsGenerator.h"
+#include "CommsMessage.h"
 #include "CommsNamespace.h"
 
 #include "commsdsl/gen/comms.h"
@@ -26,7 +29,7 @@
 
 #include <algorithm>
 #include <cassert>
-#include <fstream>
+#include <sstream>
 #include <iterator>
 
 namespace comms = commsdsl::gen::comms;
@@ -92,6 +95,14 @@ std::string CommsFrame::commsBareMetalDefaultOptions() const
             true);
 }
 
+std::string CommsFrame::commsHighThroughputDefaultOptions() const
+{
+    return
+        commsCustomizationOptionsInternal(
+            &CommsLayer::commsHighThroughputDefaultOptions,
+            true);
+}
+
 std::string CommsFrame::commsMsgFactoryDefaultOptions() const
 {
     return
@@ -100,6 +111,40 @@ std::string CommsFrame::commsMsgFactoryDefaultOptions() const
             true);
 }
 
+std::size_t CommsFrame::commsMinLength() const
+{
+    auto* parent = genGetParent();
+    assert(parent->genElemType() == commsdsl::gen::GenElem::GenType_Namespace);
+    auto allMessages = static_cast<const commsdsl::gen::GenNamespace*>(parent)->genGetAllMessages();
+    if (allMessages.empty()) {
+        return 0U;
+    }
+
+    auto payloadLen = comms::genMaxPossibleLength();
+    for (auto* m : allMessages) {
+        payloadLen = std::min(payloadLen, static_cast<const CommsMessage*>(m)->commsMinLength());
+    }
+
+    return comms::genAddLength(commsLayersLengthInternal(&CommsField::commsMinLength, 0U), payloadLen);
+}
+
+std::size_t CommsFrame::commsMaxLength() const
+{
+    auto* parent = genGetParent();
+    assert(parent->genElemType() == commsdsl::gen::GenElem::GenType_Namespace);
+    auto allMessages = static_cast<const commsdsl::gen::GenNamespace*>(parent)->genGetAllMessages();
+    if (allMessages.empty()) {
+        return comms::genMaxPossibleLength();
+    }
+
+    std::size_t payloadLen = 0U;
+    for (auto* m : allMessages) {
+        payloadLen = std::max(payloadLen, static_cast<const CommsMessage*>(m)->commsMaxLength());
+    }
+
+    return comms::genAddLength(commsLayersLengthInternal(&CommsField::commsMaxLength, comms::genMaxPossibleLength()), payloadLen);
+}
+
 bool CommsFrame::genPrepareImpl()
 {
     if (!GenBase::genPrepareImpl()) {
@@ -154,12 +199,6 @@ bool CommsFrame::commsWriteCommonInternal() const
         return false;
     }
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        gen.genLogger().genError("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
-
     static const std::string Templ =
         "#^#GENERATED#$#\n"
         "/// @file\n"
@@ -191,9 +230,7 @@ bool CommsFrame::commsWriteCommonInternal() const
         {"BODY", commsCommonBodyInternal()},
     };
 
-    stream << util::genProcessTemplate(Templ, repl, true);
-    stream.flush();
-    return stream.good();
+    return gen.genWriteFile(filePath, util::genProcessTemplate(Templ, repl, true));
 }
 
 bool CommsFrame::commsWriteDefInternal() const
@@ -209,19 +246,14 @@ bool CommsFrame::commsWriteDefInternal() const
         return false;
     }
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        gen.genLogger().genError("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
+    std::ostringstream stream;
 
     auto inputRelPath = comms::genInputCodeRelPathFor(*this, gen);
     bool codeReplaced = false;
     auto replaceCode = genGenerator().genReadCodeInjectCode(inputRelPath + strings::genReplaceFileSuffixStr(), "Replace the whole file", &codeReplaced);
     if (codeReplaced) {
         stream << replaceCode;
-        stream.flush();
-        return stream.good();
+        return gen.genWriteFile(filePath, stream.str());
     }
 
     static const std::string Templ =
@@ -268,7 +300,12 @@ bool CommsFrame::commsWriteDefInternal() const
         "    #^#ACCESS_FUNCS_DOC#$#\n"
         "    COMMS_FRAME_LAYERS_NAMES(\n"
         "        #^#LAYERS_ACCESS_LIST#$#\n"
-        "    );\n"
+        "    );\n\n"
+        "    #^#LENGTHS#$#\n"
+        "    #^#UPDATE_CHECKSUM#$#\n"
+        "    #^#SCAN#$#\n"
+        "    #^#READ_IN_PLACE#$#\n"
+        "    #^#RESYNC#$#\n"
         "    #^#PUBLIC#$#\n"
         "#^#PROTECTED#$#\n"
         "#^#PRIVATE#$#\n"
@@ -293,6 +330,11 @@ bool CommsFrame::commsWriteDefInternal() const
         {"INPUT_MESSAGES", commsDefInputMessagesParamInternal()},
         {"ACCESS_FUNCS_DOC", commsDefAccessDocInternal()},
         {"LAYERS_ACCESS_LIST", commsDefAccessListInternal()},
+        {"LENGTHS", commsDefLengthsInternal()},
+        {"UPDATE_CHECKSUM", commsDefUpdateChecksumInternal()},
+        {"SCAN", commsDefScanInternal()},
+        {"READ_IN_PLACE", commsDefReadInPlaceInternal()},
+        {"RESYNC", commsDefResyncInternal()},
         {"PUBLIC", gen.genReadCodeInjectCode(inputRelPath + strings::genPublicFileSuffixStr(), "Add public code")},
         {"PROTECTED", commsDefProtectedInternal()},
         {"PRIVATE", commsDefPrivateInternal()},
@@ -305,8 +347,7 @@ bool CommsFrame::commsWriteDefInternal() const
     }
 
     stream << util::genProcessTemplate(Templ, repl, true);
-    stream.flush();
-    return stream.good();
+    return gen.genWriteFile(filePath, stream.str());
 }
 
 std::string CommsFrame::commsCommonIncludesInternal() const
@@ -359,6 +400,41 @@ std::string CommsFrame::commsDefIncludesInternal() const
         std::move(fIncludes.begin(), fIncludes.end(), std::back_inserter(includes));
     }
 
+    if (CommsGenerator::commsCast(genGenerator()).commsGetLengthBounds()) {
+        util::genAddToStrList("<cstddef>", includes);
+        if (commsMaxLength() == comms::genMaxPossibleLength()) {
+            util::genAddToStrList("<limits>", includes);
+        }
+    }
+
+    if (!commsDefUpdateChecksumInternal().empty()) {
+        util::genAddToStrList("<cstddef>", includes);
+        util::genAddToStrList("<cstdint>", includes);
+        util::genAddToStrList("comms/ErrorStatus.h", includes);
+    }
+
+    if (!commsDefScanInternal().empty()) {
+        util::genAddToStrList("<cstddef>", includes);
+        util::genAddToStrList("<cstdint>", includes);
+        util::genAddToStrList("comms/ErrorStatus.h", includes);
+    }
+
+    if (!commsDefScanPrivateInternal().empty()) {
+        util::genAddToStrList("<tuple>", includes);
+    }
+
+    if (!commsDefReadInPlaceInternal().empty()) {
+        util::genAddToStrList("<cstddef>", includes);
+        util::genAddToStrList("<iterator>", includes);
+        util::genAddToStrList("comms/ErrorStatus.h", includes);
+    }
+
+    util::genAddToStrList("<cstdint>", includes);
+    if (commsSyncLayerInternal() != nullptr) {
+        util::genAddToStrList("<algorithm>", includes);
+        util::genAddToStrList("<cstring>", includes);
+    }
+
     comms::genPrepareIncludeStatement(includes);
     return util::genStrListToString(includes, "\n", "\n");
 }
@@ -484,20 +560,643 @@ std::string CommsFrame::commsDefProtectedInternal() const
 std::string CommsFrame::commsDefPrivateInternal() const
 {
     auto code = genGenerator().genReadCodeInjectCode(comms::genInputCodeRelPathFor(*this, genGenerator()) + strings::genPrivateFileSuffixStr(), "Add private code");
-    if (code.empty()) {
+    auto scan = commsDefScanPrivateInternal();
+    auto readInPlace = commsDefReadInPlacePrivateInternal();
+    if (code.empty() && scan.empty() && readInPlace.empty()) {
         return strings::genEmptyString();
     }
 
     static const std::string Templ =
     "private:\n"
+    "    #^#SCAN#$#\n"
+    "    #^#READ_IN_PLACE#$#\n"
     "    #^#CODE#$#\n";
 
     util::GenReplacementMap repl = {
+        {"SCAN", std::move(scan)},
+        {"READ_IN_PLACE", std::move(readInPlace)},
         {"CODE", std::move(code)},
     };
     return util::genProcessTemplate(Templ, repl);
 }
 
+std::string CommsFrame::commsDefLengthsInternal() const
+{
+    if (!CommsGenerator::commsCast(genGenerator()).commsGetLengthBounds()) {
+        return strings::genEmptyString();
+    }
+
+    static const std::string Templ =
+        "/// @brief Minimal length of the whole frame.\n"
+        "/// @details Combines the lengths of the framing fields with the shortest\n"
+        "///     message defined in the protocol namespace.\n"
+        "static constexpr std::size_t minFrameLength()\n"
+        "{\n"
+        "    return #^#MIN_LEN#$#;\n"
+        "}\n\n"
+        "/// @brief Maximal length of the whole frame.\n"
+        "/// @details Combines the lengths of the framing fields with the longest\n"
+        "///     message defined in the protocol namespace. Reports\n"
+        "///     @b std::numeric_limits<std::size_t>::max() for the unbounded length.\n"
+        "static constexpr std::size_t maxFrameLength()\n"
+        "{\n"
+        "    return #^#MAX_LEN#$#;\n"
+        "}\n";
+
+    auto maxLength = commsMaxLength();
+    util::GenReplacementMap repl = {
+        {"MIN_LEN", util::genNumToString(commsMinLength()) + 'U'},
+        {"MAX_LEN", util::genNumToString(maxLength) + 'U'},
+    };
+
+    if (maxLength == comms::genMaxPossibleLength()) {
+        repl["MAX_LEN"] = "std::numeric_limits<std::size_t>::max()";
+    }
+
+    return util::genProcessTemplate(Templ, repl);
+}
+
+std::string CommsFrame::commsDefUpdateChecksumInternal() const
+{
+    if (!CommsGenerator::commsCast(genGenerator()).commsGetPatchFunctions()) {
+        return strings::genEmptyString();
+    }
+
+    using LayerKind = commsdsl::parse::ParseLayer::ParseKind;
+
+    auto layerKindFunc =
+        [](const CommsLayer* l)
+        {
+            return l->commsGenLayer().genParseObj().parseKind();
+        };
+
+    auto checksumCount =
+        std::count_if(
+            m_commsLayers.begin(), m_commsLayers.end(),
+            [&layerKindFunc](const CommsLayer* l)
+            {
+                return layerKindFunc(l) == LayerKind::Checksum;
+            });
+
+    if (checksumCount != 1) {
+        return strings::genEmptyString();
+    }
+
+    auto checksumIter =
+        std::find_if(
+            m_commsLayers.begin(), m_commsLayers.end(),
+            [&layerKindFunc](const CommsLayer* l)
+            {
+                return layerKindFunc(l) == LayerKind::Checksum;
+            });
+
+    assert(checksumIter != m_commsLayers.end());
+    auto* checksumLayer = dynamic_cast<const CommsChecksumLayer*>(*checksumIter);
+    assert(checksumLayer != nullptr);
+
+    auto layerFieldFunc =
+        [](const CommsLayer* l) -> const CommsField*
+        {
+            auto* field = l->commsMemberField();
+            if (field == nullptr) {
+                field = l->commsExternalField();
+            }
+            return field;
+        };
+
+    auto isFixedFunc =
+        [&layerFieldFunc](const CommsLayer* l)
+        {
+            auto* field = layerFieldFunc(l);
+            return
+                (field != nullptr) &&
+                (!field->commsHasCustomLength()) &&
+                (field->commsMinLength() == field->commsMaxLength());
+        };
+
+    if (!isFixedFunc(checksumLayer)) {
+        return strings::genEmptyString();
+    }
+
+    // The layers are listed from the outermost one, the checksum layer
+    // wraps all the following ones.
+    auto checksumObj = commsdsl::parse::ParseChecksumLayer(checksumLayer->commsGenLayer().genParseObj());
+    bool prefix = checksumObj.parseFromLayer().empty();
+    if (prefix) {
+        // Must cover everything till the end of the frame
+        auto* lastLayer = m_commsLayers.back();
+        if ((layerKindFunc(lastLayer) != LayerKind::Payload) ||
+            (lastLayer->commsGenLayer().genParseObj().parseName() != checksumObj.parseUntilLayer())) {
+            return strings::genEmptyString();
+        }
+    }
+
+    // The synchronization suffix layers wrapping the checksum one
+    // follow the checksum at the end of the frame.
+    util::GenStringsList lengths;
+    util::GenStringsList suffixLengths;
+    util::GenStringsList checks;
+    for (auto iter = m_commsLayers.begin(); iter != checksumIter; ++iter) {
+        auto* l = *iter;
+        auto layerObj = l->commsGenLayer().genParseObj();
+        auto kind = layerObj.parseKind();
+        if ((kind == LayerKind::Value) && commsdsl::parse::ParseValueLayer(layerObj).parsePseudo()) {
+            continue;
+        }
+
+        if ((kind == LayerKind::Payload) || (!isFixedFunc(l))) {
+            return strings::genEmptyString();
+        }
+
+        bool suffix = false;
+        if (kind == LayerKind::Sync) {
+            auto syncObj = commsdsl::parse::ParseSyncLayer(layerObj);
+            if (syncObj.parseSeekField() || syncObj.parseHasEscField()) {
+                return strings::genEmptyString();
+            }
+
+            suffix = syncObj.parseIsAfterPayload();
+        }
+
+        auto accName = comms::genAccessName(layerObj.parseName());
+        auto len = "Layer_" + accName + "::Field::minLength()";
+        if (suffix) {
+            suffixLengths.push_back(std::move(len));
+        }
+        else {
+            lengths.push_back(std::move(len));
+        }
+
+        checks.push_back(
+            "static_assert(Layer_" + accName + "::Field::minLength() == Layer_" + accName + "::Field::maxLength(), "
+            "\"Layer_" + accName + " field is expected to have fixed length\");");
+    }
+
+    static const std::string Templ =
+        "/// @brief Recalculate the checksum of the already serialized frame in place.\n"
+        "/// @details Expected to be used after the in-place modification of the message\n"
+        "///     payload (see @b patch_* functions of the messages).\n"
+        "/// @param[in, out] buf Buffer containing the single whole frame.\n"
+        "/// @param[in] len Length of the frame.\n"
+        "static comms::ErrorStatus updateChecksum(std::uint8_t* buf, std::size_t len)\n"
+        "{\n"
+        "    #^#CHECKS#$#\n"
+        "    using ChecksumField = typename Layer_#^#CHECKSUM#$#::Field;\n"
+        "    using ChecksumCalc =\n"
+        "        #^#ALG#$#;\n\n"
+        "    static_assert(ChecksumField::minLength() == ChecksumField::maxLength(),\n"
+        "        \"Checksum field is expected to have fixed length\");\n\n"
+        "    static const std::size_t FixedLen = #^#FIXED_LEN#$#;\n"
+        "    static const std::size_t SuffixLen = #^#SUFFIX_LEN#$#;\n"
+        "    if (len < (FixedLen + SuffixLen + ChecksumField::minLength())) {\n"
+        "        return comms::ErrorStatus::NotEnoughData;\n"
+        "    }\n\n"
+        "    #^#POSITIONS#$#\n"
+        "    const std::uint8_t* fromIter = buf + fromOffset;\n"
+        "    ChecksumField field;\n"
+        "    field.setValue(ChecksumCalc()(fromIter, untilOffset - fromOffset));\n"
+        "    auto* checksumIter = buf + checksumOffset;\n"
+        "    return field.write(checksumIter, ChecksumField::minLength());\n"
+        "}\n";
+
+    static const std::string SuffixPositions =
+        "auto fromOffset = FixedLen;\n"
+        "auto checksumOffset = len - (SuffixLen + ChecksumField::minLength());\n"
+        "auto untilOffset = checksumOffset;\n";
+
+    static const std::string PrefixPositions =
+        "auto checksumOffset = FixedLen;\n"
+        "auto fromOffset = checksumOffset + ChecksumField::minLength();\n"
+        "auto untilOffset = len - SuffixLen;\n";
+
+    auto checksumAccName = comms::genAccessName(checksumLayer->commsGenLayer().genParseObj().parseName());
+    util::GenReplacementMap repl = {
+        {"CHECKS", util::genStrListToString(checks, "\n", "\n")},
+        {"CHECKSUM", checksumAccName},
+        {"FIXED_LEN", lengths.empty() ? std::string("0U") : util::genStrListToString(lengths, " + ", "")},
+        {"SUFFIX_LEN", suffixLengths.empty() ? std::string("0U") : util::genStrListToString(suffixLengths, " + ", "")},
+        {"POSITIONS", prefix ? PrefixPositions : SuffixPositions},
+        {"ALG", checksumLayer->commsDefAlg("Layer_" + checksumAccName + "::Field")},
+    };
+
+    return util::genProcessTemplate(Templ, repl);
+}
+
+std::string CommsFrame::commsDefScanInternal() const
+{
+    auto& gen = CommsGenerator::commsCast(genGenerator());
+    if (!gen.commsGetSkipFunctions()) {
+        return strings::genEmptyString();
+    }
+
+    GenStringsList prefixLens;
+    GenStringsList suffixLens;
+    auto* keyLayer = commsScanKeyLayerInternal(prefixLens, suffixLens, false);
+    if (keyLayer == nullptr) {
+        return strings::genEmptyString();
+    }
+
+    static const std::string Templ =
+        "/// @brief Determine the boundary of the first frame in the input buffer\n"
+        "///     without reading the message.\n"
+        "/// @details #^#DETAILS#$#\n"
+        "///     The values of the framing fields are not validated.\n"
+        "/// @param[in] buf Input buffer, expected to start with the frame.\n"
+        "/// @param[in] len Number of bytes available in the buffer.\n"
+        "/// @param[out] frameLen Length of the whole frame, updated only on success.\n"
+        "/// @return comms::ErrorStatus::NotEnoughData in case the buffer doesn't\n"
+        "///     contain the whole frame.\n"
+        "static comms::ErrorStatus scan(const std::uint8_t* buf, std::size_t len, std::size_t& frameLen)\n"
+        "{\n"
+        "    static const std::size_t PrefixLen = #^#PREFIX_LEN#$#;\n"
+        "    static const std::size_t SuffixLen = #^#SUFFIX_LEN#$#;\n"
+        "    if (len < (PrefixLen + SuffixLen)) {\n"
+        "        return comms::ErrorStatus::NotEnoughData;\n"
+        "    }\n\n"
+        "    typename Layer_#^#KEY#$#::Field keyField;\n"
+        "    auto iter = buf + PrefixLen;\n"
+        "    auto es = keyField.read(iter, len - (PrefixLen + SuffixLen));\n"
+        "    if (es != comms::ErrorStatus::Success) {\n"
+        "        return es;\n"
+        "    }\n\n"
+        "    auto headerLen = static_cast<std::size_t>(iter - buf);\n"
+        "    #^#BODY#$#\n"
+        "}\n";
+
+    static const std::string SizeBody =
+        "auto dataLen = static_cast<std::size_t>(keyField.getValue());\n"
+        "if ((len - (headerLen + SuffixLen)) < dataLen) {\n"
+        "    return comms::ErrorStatus::NotEnoughData;\n"
+        "}\n\n"
+        "frameLen = headerLen + dataLen + SuffixLen;\n"
+        "return comms::ErrorStatus::Success;";
+
+    static const std::string IdBody =
+        "std::size_t payloadLen = 0U;\n"
+        "es =\n"
+        "    ScanMsgHelper<0U, std::tuple_size<TAllMessages>::value>::skip(\n"
+        "        keyField.getValue(), buf + headerLen, len - (headerLen + SuffixLen), payloadLen);\n"
+        "if (es != comms::ErrorStatus::Success) {\n"
+        "    return es;\n"
+        "}\n\n"
+        "frameLen = headerLen + payloadLen + SuffixLen;\n"
+        "return comms::ErrorStatus::Success;";
+
+    static const std::string SizeDetails =
+        "Uses the value of the @ref Layer_#^#KEY#$# field.";
+
+    static const std::string IdDetails =
+        "Uses @b skip() of the message identified by the @ref Layer_#^#KEY#$# field.";
+
+    using LayerKind = commsdsl::parse::ParseLayer::ParseKind;
+    bool sizeKey = (keyLayer->commsGenLayer().genParseObj().parseKind() == LayerKind::Size);
+    util::GenReplacementMap repl = {
+        {"KEY", comms::genAccessName(keyLayer->commsGenLayer().genParseObj().parseName())},
+        {"PREFIX_LEN", prefixLens.empty() ? std::string("0U") : util::genStrListToString(prefixLens, " + ", "")},
+        {"SUFFIX_LEN", suffixLens.empty() ? std::string("0U") : util::genStrListToString(suffixLens, " + ", "")},
+        {"BODY", sizeKey ? SizeBody : IdBody},
+    };
+
+    repl["DETAILS"] = util::genProcessTemplate(sizeKey ? SizeDetails : IdDetails, repl);
+    return util::genProcessTemplate(Templ, repl);
+}
+
+std::string CommsFrame::commsDefScanPrivateInternal() const
+{
+    auto& gen = CommsGenerator::commsCast(genGenerator());
+    if (!gen.commsGetSkipFunctions()) {
+        return strings::genEmptyString();
+    }
+
+    GenStringsList prefixLens;
+    GenStringsList suffixLens;
+    auto* keyLayer = commsScanKeyLayerInternal(prefixLens, suffixLens, false);
+    if ((keyLayer == nullptr) ||
+        (keyLayer->commsGenLayer().genParseObj().parseKind() != commsdsl::parse::ParseLayer::ParseKind::Id)) {
+        return strings::genEmptyString();
+    }
+
+    // Messages sharing the same ID are tried one by one until the skip succeeds.
+    // Their skip() performs the full read, the same message is chosen as by
+    // the read of the frame.
+    return
+        "template <std::size_t TIdx, std::size_t TCount>\n"
+        "struct ScanMsgHelper\n"
+        "{\n"
+        "    template <typename TId>\n"
+        "    static comms::ErrorStatus skip(TId id, const std::uint8_t* buf, std::size_t len, std::size_t& consumed)\n"
+        "    {\n"
+        "        using Msg = typename std::tuple_element<TIdx, TAllMessages>::type;\n"
+        "        using NextHelper = ScanMsgHelper<TIdx + 1U, TCount>;\n"
+        "        if (static_cast<TId>(Msg::doGetId()) != id) {\n"
+        "            return NextHelper::skip(id, buf, len, consumed);\n"
+        "        }\n\n"
+        "        auto es = Msg::skip(buf, len, consumed);\n"
+        "        if (es == comms::ErrorStatus::Success) {\n"
+        "            return es;\n"
+        "        }\n\n"
+        "        auto nextEs = NextHelper::skip(id, buf, len, consumed);\n"
+        "        if (nextEs == comms::ErrorStatus::InvalidMsgId) {\n"
+        "            return es;\n"
+        "        }\n\n"
+        "        return nextEs;\n"
+        "    }\n"
+        "};\n\n"
+        "template <std::size_t TCount>\n"
+        "struct ScanMsgHelper<TCount, TCount>\n"
+        "{\n"
+        "    template <typename TId>\n"
+        "    static comms::ErrorStatus skip(TId, const std::uint8_t*, std::size_t, std::size_t&)\n"
+        "    {\n"
+        "        return comms::ErrorStatus::InvalidMsgId;\n"
+        "    }\n"
+        "};\n";
+}
+
+std::size_t CommsFrame::commsLayersLengthInternal(CommsLengthFunc func, std::size_t unknownLen) const
+{
+    using LayerKind = commsdsl::parse::ParseLayer::ParseKind;
+    std::size_t result = 0U;
+    for (auto* l : m_commsLayers) {
+        auto layerObj = l->commsGenLayer().genParseObj();
+        auto kind = layerObj.parseKind();
+        if (kind == LayerKind::Payload) {
+            continue;
+        }
+
+        if ((kind == LayerKind::Value) &&
+            (commsdsl::parse::ParseValueLayer(layerObj).parsePseudo())) {
+            continue;
+        }
+
+        const CommsField* field = l->commsMemberField();
+        if (field == nullptr) {
+            field = l->commsExternalField();
+        }
+
+        if ((field == nullptr) || (field->commsHasCustomLength())) {
+            return unknownLen;
+        }
+
+        result = comms::genAddLength(result, (field->*func)());
+    }
+
+    return result;
+}
+
+std::string CommsFrame::commsDefReadInPlaceInternal() const
+{
+    auto& gen = CommsGenerator::commsCast(genGenerator());
+    if (!gen.commsGetInPlaceStorage()) {
+        return strings::genEmptyString();
+    }
+
+    GenStringsList prefixLens;
+    GenStringsList suffixLens;
+    auto* idLayer = commsScanKeyLayerInternal(prefixLens, suffixLens, true);
+    if (idLayer == nullptr) {
+        return strings::genEmptyString();
+    }
+
+    static const std::string Templ =
+        "/// @brief Read the frame constructing the message in the in-place storage.\n"
+        "/// @details Peeks the value of the @ref Layer_#^#ID#$# field, constructs the\n"
+        "///     message in the storage using its @b emplaceById() member function\n"
+        "///     and reads the whole frame into it. Messages sharing the same ID are\n"
+        "///     tried one by one. No dynamic memory allocation is involved.\n"
+        "/// @tparam TStorage Type of the storage, like @b input::AllMessagesStorage.\n"
+        "/// @param[out] storage Storage of the message.\n"
+        "/// @param[in, out] iter Iterator used for reading, advanced only on success.\n"
+        "/// @param[in] len Number of bytes available for reading.\n"
+        "template <typename TStorage, typename TIter>\n"
+        "comms::ErrorStatus readInPlace(TStorage& storage, TIter& iter, std::size_t len)\n"
+        "{\n"
+        "    static const std::size_t PrefixLen = #^#PREFIX_LEN#$#;\n"
+        "    if (len < PrefixLen) {\n"
+        "        return comms::ErrorStatus::NotEnoughData;\n"
+        "    }\n\n"
+        "    typename Layer_#^#ID#$#::Field idField;\n"
+        "    auto idIter = iter;\n"
+        "    std::advance(idIter, PrefixLen);\n"
+        "    auto es = idField.read(idIter, len - PrefixLen);\n"
+        "    if (es != comms::ErrorStatus::Success) {\n"
+        "        return es;\n"
+        "    }\n\n"
+        "    es = comms::ErrorStatus::InvalidMsgId;\n"
+        "    for (std::size_t idx = 0U; storage.emplaceById(idField.getValue(), idx); ++idx) {\n"
+        "        auto readIter = iter;\n"
+        "        InPlaceReadHelper<TIter> helper(*this, readIter, len);\n"
+        "        es = storage.visit(helper);\n"
+        "        if (es == comms::ErrorStatus::Success) {\n"
+        "            iter = readIter;\n"
+        "            return es;\n"
+        "        }\n"
+        "    }\n\n"
+        "    return es;\n"
+        "}\n";
+
+    util::GenReplacementMap repl = {
+        {"ID", comms::genAccessName(idLayer->commsGenLayer().genParseObj().parseName())},
+        {"PREFIX_LEN", prefixLens.empty() ? std::string("0U") : util::genStrListToString(prefixLens, " + ", "")},
+    };
+
+    return util::genProcessTemplate(Templ, repl);
+}
+
+std::string CommsFrame::commsDefReadInPlacePrivateInternal() const
+{
+    if (commsDefReadInPlaceInternal().empty()) {
+        return strings::genEmptyString();
+    }
+
+    return
+        "template <typename TIter>\n"
+        "struct InPlaceReadHelper\n"
+        "{\n"
+        "    InPlaceReadHelper(Base& frame, TIter& iter, std::size_t len) :\n"
+        "        m_frame(frame),\n"
+        "        m_iter(iter),\n"
+        "        m_len(len)\n"
+        "    {\n"
+        "    }\n\n"
+        "    template <typename TMsg>\n"
+        "    comms::ErrorStatus handle(TMsg& msg)\n"
+        "    {\n"
+        "        return m_frame.read(msg, m_iter, m_len);\n"
+        "    }\n\n"
+        "private:\n"
+        "    Base& m_frame;\n"
+        "    TIter& m_iter;\n"
+        "    std::size_t m_len = 0U;\n"
+        "};\n";
+}
+
+std::string CommsFrame::commsDefResyncInternal() const
+{
+    auto* syncLayer = commsSyncLayerInternal();
+    if (syncLayer == nullptr) {
+        static const std::string NoSyncTempl =
+            "/// @brief Number of bytes to skip to the next frame candidate after the protocol error.\n"
+            "/// @details The frame doesn't start with the fixed synchronization prefix,\n"
+            "///     always reports single byte.\n"
+            "static std::size_t resyncOffset(const std::uint8_t*, std::size_t)\n"
+            "{\n"
+            "    return 1U;\n"
+            "}\n";
+
+        return NoSyncTempl;
+    }
+
+    static const std::string Templ =
+        "/// @brief Number of bytes to skip to the next frame candidate after the protocol error.\n"
+        "/// @details Searches for the value of the @ref Layer_#^#SYNC#$# field starting from the\n"
+        "///     second byte of the buffer instead of re-attempting the frame read at every position.\n"
+        "///     The incomplete prefix at the end of the buffer is reported as the next candidate.\n"
+        "/// @param[in] buf Input buffer, starting at the frame which failed to be read.\n"
+        "/// @param[in] len Length of the input buffer.\n"
+        "/// @return Offset of the next candidate, equals to @b len when none is found.\n"
+        "static std::size_t resyncOffset(const std::uint8_t* buf, std::size_t len)\n"
+        "{\n"
+        "    using SyncField = typename Layer_#^#SYNC#$#::Field;\n"
+        "    static_assert(SyncField::minLength() == SyncField::maxLength(),\n"
+        "        \"Sync field is expected to have fixed length\");\n\n"
+        "    std::uint8_t sync[SyncField::maxLength()] = {0};\n"
+        "    auto* syncIter = &sync[0];\n"
+        "    static_cast<void>(SyncField().write(syncIter, sizeof(sync)));\n\n"
+        "    std::size_t offset = 1U;\n"
+        "    while (offset < len) {\n"
+        "        auto* pos = static_cast<const std::uint8_t*>(std::memchr(buf + offset, sync[0], len - offset));\n"
+        "        if (pos == nullptr) {\n"
+        "            break;\n"
+        "        }\n\n"
+        "        offset = static_cast<std::size_t>(pos - buf);\n"
+        "        if (std::memcmp(pos, &sync[0], std::min(len - offset, sizeof(sync))) == 0) {\n"
+        "            return offset;\n"
+        "        }\n\n"
+        "        ++offset;\n"
+        "    }\n\n"
+        "    return len;\n"
+        "}\n";
+
+    util::GenReplacementMap repl = {
+        {"SYNC", comms::genAccessName(syncLayer->commsGenLayer().genParseObj().parseName())},
+    };
+
+    return util::genProcessTemplate(Templ, repl);
+}
+
+const CommsLayer* CommsFrame::commsSyncLayerInternal() const
+{
+    using LayerKind = commsdsl::parse::ParseLayer::ParseKind;
+
+    // The layers are listed from the outermost one, the checksum and
+    // synchronization layers placed after the payload don't precede the
+    // synchronization prefix.
+    for (auto* l : m_commsLayers) {
+        auto parseObj = l->commsGenLayer().genParseObj();
+        auto kind = parseObj.parseKind();
+        if ((kind == LayerKind::Checksum) &&
+            (!commsdsl::parse::ParseChecksumLayer(parseObj).parseFromLayer().empty())) {
+            continue;
+        }
+
+        if ((kind == LayerKind::Sync) &&
+            (commsdsl::parse::ParseSyncLayer(parseObj).parseIsAfterPayload())) {
+            continue;
+        }
+
+        if (kind != LayerKind::Sync) {
+            return nullptr;
+        }
+
+        const CommsField* field = l->commsMemberField();
+        if (field == nullptr) {
+            field = l->commsExternalField();
+        }
+
+        if ((field == nullptr) ||
+            (field->commsHasCustomLength()) ||
+            (field->commsMinLength() == 0U) ||
+            (field->commsMinLength() != field->commsMaxLength())) {
+            return nullptr;
+        }
+
+        return l;
+    }
+
+    return nullptr;
+}
+
+const CommsLayer* CommsFrame::commsScanKeyLayerInternal(GenStringsList& prefixLens, GenStringsList& suffixLens, bool idKeyOnly) const
+{
+    // The frame length is determined either by the size layer or by skipping
+    // the message payload identified by the ID layer. All the outer layers
+    // are expected to have fixed length. When only the ID layer is requested
+    // the size layer is treated as yet another fixed length outer layer.
+    using LayerKind = commsdsl::parse::ParseLayer::ParseKind;
+    for (auto iter = m_commsLayers.begin(); iter != m_commsLayers.end(); ++iter) {
+        auto* l = *iter;
+        auto layerObj = l->commsGenLayer().genParseObj();
+        auto kind = layerObj.parseKind();
+        if ((kind == LayerKind::Size) && (!idKeyOnly)) {
+            return l;
+        }
+
+        if (kind == LayerKind::Id) {
+            auto nextIter = std::next(iter);
+            if ((!idKeyOnly) &&
+                ((nextIter == m_commsLayers.end()) ||
+                 ((*nextIter)->commsGenLayer().genParseObj().parseKind() != LayerKind::Payload))) {
+                return nullptr;
+            }
+
+            return l;
+        }
+
+        const CommsField* field = l->commsMemberField();
+        if (field == nullptr) {
+            field = l->commsExternalField();
+        }
+
+        if ((field == nullptr) ||
+            field->commsHasCustomLength() ||
+            (field->commsMinLength() != field->commsMaxLength())) {
+            return nullptr;
+        }
+
+        bool suffix = false;
+        if (kind == LayerKind::Sync) {
+            auto syncObj = commsdsl::parse::ParseSyncLayer(layerObj);
+            if (syncObj.parseSeekField() || syncObj.parseHasEscField()) {
+                return nullptr;
+            }
+
+            suffix = syncObj.parseIsAfterPayload();
+        }
+        else if (kind == LayerKind::Checksum) {
+            suffix = !commsdsl::parse::ParseChecksumLayer(layerObj).parseFromLayer().empty();
+        }
+        else if (kind == LayerKind::Value) {
+            if (commsdsl::parse::ParseValueLayer(layerObj).parsePseudo()) {
+                continue;
+            }
+        }
+        else if (kind != LayerKind::Size) {
+            return nullptr;
+        }
+
+        auto len = "Layer_" + comms::genAccessName(layerObj.parseName()) + "::Field::minLength()";
+        if (suffix) {
+            suffixLens.push_back(std::move(len));
+        }
+        else {
+            prefixLens.push_back(std::move(len));
+        }
+    }
+
+    return nullptr;
+}
+
 std::string CommsFrame::commsCustomizationOptionsInternal(
     CommsLayerOptsFunc layerOptsFunc,
     bool hasBase) const
@@ -45,14 +45,21 @@ public:
     std::string commsDefaultOptions() const;
     std::string commsDataViewDefaultOptions() const;
     std::string commsBareMetalDefaultOptions() const;
+    std::string commsHighThroughputDefaultOptions() const;
     std::string commsMsgFactoryDefaultOptions() const;
 
+    std::size_t commsMinLength() const;
+    std::size_t commsMaxLength() const;
+
 protected:
     virtual bool genPrepareImpl() override;
     virtual bool genWriteImpl() const override;
 
 private:
     using CommsLayerOptsFunc = std::string (CommsLayer::*)() const;
+    using GenStringsList = commsdsl::gen::util::GenStringsList;
+
+    using CommsLengthFunc = std::size_t (CommsField::*)() const;
 
     bool commsWriteCommonInternal() const;
     bool commsWriteDefInternal() const;
@@ -67,6 +74,16 @@ private:
     std::string commsDefAccessListInternal() const;
     std::string commsDefProtectedInternal() const;
     std::string commsDefPrivateInternal() const;
+    std::string commsDefUpdateChecksumInternal() const;
+    std::string commsDefLengthsInternal() const;
+    std::string commsDefScanInternal() const;
+    std::string commsDefScanPrivateInternal() const;
+    std::size_t commsLayersLengthInternal(CommsLengthFunc func, std::size_t unknownLen) const;
+    std::string commsDefReadInPlaceInternal() const;
+    std::string commsDefReadInPlacePrivateInternal() const;
+    std::string commsDefResyncInternal() const;
+    const CommsLayer* commsSyncLayerInternal() const;
+    const CommsLayer* commsScanKeyLayerInternal(GenStringsList& prefixLens, GenStringsList& suffixLens, bool idKeyOnly) const;
     std::string commsCustomizationOptionsInternal(
         CommsLayerOptsFunc layerOptsFunc,
         bool hasBase) const;
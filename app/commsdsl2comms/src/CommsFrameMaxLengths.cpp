@@ -0,0 +1,140 @@
+//
+// Copyright 2025 - 2025 (C). Alex Robenko. All rights reserved.
+//
+// SPDX-License-Identifier: Apache-2.0
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "CommsFrameMaxLengths.h"
+
+#include "CommsFrame.h"
+#include "CommsGenerator.h"
+#include "CommsNamespace.h"
+
+#include "commsdsl/gen/comms.h"
+#include "commsdsl/gen/util.h"
+
+#include <algorithm>
+#include <cassert>
+
+namespace util = commsdsl::gen::util;
+namespace comms = commsdsl::gen::comms;
+
+namespace commsdsl2comms
+{
+
+namespace
+{
+
+std::string commsLengthValueInternal(std::size_t value)
+{
+    if (value == comms::genMaxPossibleLength()) {
+        return "unlimited()";
+    }
+
+    return util::genNumToString(value) + 'U';
+}
+
+} // namespace
+
+CommsFrameMaxLengths::CommsFrameMaxLengths(CommsGenerator& generator, const CommsNamespace& parent) :
+    m_commsGenerator(generator),
+    m_parent(parent)
+{
+}
+
+bool CommsFrameMaxLengths::commsWrite() const
+{
+    auto filePath = comms::genHeaderPathForNamespaceMember("FrameMaxLengths", m_commsGenerator, m_parent);
+
+    m_commsGenerator.genLogger().genInfo("Generating " + filePath);
+
+    auto dirPath = util::genPathUp(filePath);
+    assert(!dirPath.empty());
+    if (!m_commsGenerator.genCreateDirectory(dirPath)) {
+        return false;
+    }
+
+    const std::string Templ =
+        "#^#GENERATED#$#\n"
+        "/// @file\n"
+        "/// @brief Contains maximal lengths of the frames.\n\n"
+        "#pragma once\n\n"
+        "#include <cstddef>\n"
+        "#include <limits>\n\n"
+        "#^#NS_BEGIN#$#\n\n"
+        "/// @brief Maximal serialization lengths of the frames, usable for the\n"
+        "///     compile time sizing of the input / output buffers.\n"
+        "/// @details The frames with the unbounded length report @ref unlimited().\n"
+        "struct FrameMaxLengths\n"
+        "{\n"
+        "    /// @brief Value reported for the unbounded length.\n"
+        "    static constexpr std::size_t unlimited()\n"
+        "    {\n"
+        "        return std::numeric_limits<std::size_t>::max();\n"
+        "    }\n\n"
+        "    #^#FUNCS#$#\n"
+        "};\n\n"
+        "#^#NS_END#$#\n";
+
+    util::GenReplacementMap repl = {
+        {"GENERATED", CommsGenerator::commsFileGeneratedComment()},
+        {"FUNCS", commsFuncsInternal()},
+        {"NS_BEGIN", comms::genNamespaceBeginFor(m_parent, m_commsGenerator)},
+        {"NS_END", comms::genNamespaceEndFor(m_parent, m_commsGenerator)},
+    };
+
+    return m_commsGenerator.genWriteFile(filePath, util::genProcessTemplate(Templ, repl, true));
+}
+
+std::string CommsFrameMaxLengths::commsFuncsInternal() const
+{
+    static const std::string Templ =
+        "/// @brief Maximal length of the @ref #^#SCOPE#$# frame.\n"
+        "static constexpr std::size_t #^#NAME#$#()\n"
+        "{\n"
+        "    return #^#VALUE#$#;\n"
+        "}\n";
+
+    static const std::string LargestTempl =
+        "/// @brief Largest of the frames lengths.\n"
+        "static constexpr std::size_t largest()\n"
+        "{\n"
+        "    return #^#VALUE#$#;\n"
+        "}\n";
+
+    util::GenStringsList funcs;
+    std::size_t largest = 0U;
+    for (auto& f : m_parent.genFrames()) {
+        auto* commsFrame = static_cast<const CommsFrame*>(f.get());
+        auto maxLength = commsFrame->commsMaxLength();
+        largest = std::max(largest, maxLength);
+
+        util::GenReplacementMap repl = {
+            {"SCOPE", comms::genScopeFor(*commsFrame, m_commsGenerator)},
+            {"NAME", comms::genAccessName(commsFrame->genParseObj().parseName())},
+            {"VALUE", commsLengthValueInternal(maxLength)},
+        };
+
+        funcs.push_back(util::genProcessTemplate(Templ, repl));
+    }
+
+    util::GenReplacementMap repl = {
+        {"VALUE", commsLengthValueInternal(largest)},
+    };
+
+    funcs.push_back(util::genProcessTemplate(LargestTempl, repl));
+    return util::genStrListToString(funcs, "\n", "");
+}
+
+} // namespace commsdsl2comms
@@ -0,0 +1,41 @@
+//
+// Copyright 2025 - 2025 (C). Alex Robenko. All rights reserved.
+//
+// SPDX-License-Identifier: Apache-2.0
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <string>
+
+namespace commsdsl2comms
+{
+
+class CommsGenerator;
+class CommsNamespace;
+
+class CommsFrameMaxLengths
+{
+public:
+    CommsFrameMaxLengths(CommsGenerator& generator, const CommsNamespace& parent);
+    bool commsWrite() const;
+
+private:
+    std::string commsFuncsInternal() const;
+
+    CommsGenerator& m_commsGenerator;
+    const CommsNamespace& m_parent;
+};
+
+} // namespace commsdsl2comms
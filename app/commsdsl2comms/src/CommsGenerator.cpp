@@ -25,6 +25,7 @@
 #include "CommsDefaultOptions.h"
 #include "CommsDoxygen.h"
 #include "CommsEnumField.h"
+#include "CommsFastChecksum.h"
 #include "CommsFieldBase.h"
 #include "CommsFloatField.h"
 #include "CommsFrame.h"
@@ -33,12 +34,14 @@
 #include "CommsListField.h"
 #include "CommsIdLayer.h"
 #include "CommsInterface.h"
+#include "CommsJsonEncoder.h"
 #include "CommsMessage.h"
 #include "CommsNamespace.h"
 #include "CommsOptionalField.h"
 #include "CommsPayloadLayer.h"
 #include "CommsProgramOptions.h"
 #include "CommsRefField.h"
+#include "CommsReflection.h"
 #include "CommsSchema.h"
 #include "CommsSetField.h"
 #include "CommsSizeLayer.h"
@@ -57,6 +60,8 @@
 #include <iterator>
 #include <filesystem>
 #include <fstream>
+#include <limits>
+#include <stdexcept>
 #include <system_error>
 #include <type_traits>
 
@@ -69,6 +74,38 @@ namespace commsdsl2comms
 
 const std::string CommsMinCommsVersion("5.5.1");
 
+namespace
+{
+
+const std::size_t CommsMaxHotMessages = 8U;
+const std::uintmax_t CommsHotTrafficPercent = 90U;
+
+bool commsIsDecimalInternal(const std::string& str)
+{
+    return
+        (!str.empty()) &&
+        std::all_of(
+            str.begin(), str.end(),
+            [](char ch)
+            {
+                return ('0' <= ch) && (ch <= '9');
+            });
+}
+
+std::string commsTrimInternal(const std::string& str)
+{
+    static const std::string WhiteSpaces(" \t\"");
+    auto first = str.find_first_not_of(WhiteSpaces);
+    if (first == std::string::npos) {
+        return std::string();
+    }
+
+    auto last = str.find_last_not_of(WhiteSpaces);
+    return str.substr(first, (last - first) + 1U);
+}
+
+} // namespace
+
 const std::string& CommsGenerator::commsFileGeneratedComment()
 {
     static const std::string Str =
@@ -106,6 +143,193 @@ void CommsGenerator::commsSetCustomizationLevel(const std::string& value)
     m_customizationLevel = static_cast<CommsCustomizationLevel>(std::distance(std::begin(Map), iter));
 }
 
+CommsGenerator::CommsDispatchStrategy CommsGenerator::commsGetDispatchStrategy() const
+{
+    return m_dispatchStrategy;
+}
+
+void CommsGenerator::commsSetDispatchStrategy(const std::string& value)
+{
+    if (value.empty()) {
+        return;
+    }
+
+    static const std::string Map[] = {
+        /* Auto */ "auto",
+        /* Switch */ "switch",
+        /* Table */ "table",
+        /* Hash */ "hash",
+    };
+    static const std::size_t MapSize = std::extent<decltype(Map)>::value;
+    static_assert(MapSize == static_cast<unsigned>(CommsDispatchStrategy::NumOfValues));
+
+    auto iter = std::find(std::begin(Map), std::end(Map), value);
+    if (iter == std::end(Map)) {
+        genLogger().genWarning("Unknown dispatch strategy \"" + value + "\", using default.");
+        return;
+    }
+
+    m_dispatchStrategy = static_cast<CommsDispatchStrategy>(std::distance(std::begin(Map), iter));
+}
+
+CommsGenerator::CommsMsgFactoryStrategy CommsGenerator::commsGetMsgFactoryStrategy() const
+{
+    return m_msgFactoryStrategy;
+}
+
+void CommsGenerator::commsSetMsgFactoryStrategy(const std::string& value)
+{
+    if (value.empty()) {
+        return;
+    }
+
+    static const std::string Map[] = {
+        /* Auto */ "auto",
+        /* Switch */ "switch",
+        /* Table */ "table",
+    };
+    static const std::size_t MapSize = std::extent<decltype(Map)>::value;
+    static_assert(MapSize == static_cast<unsigned>(CommsMsgFactoryStrategy::NumOfValues));
+
+    auto iter = std::find(std::begin(Map), std::end(Map), value);
+    if (iter == std::end(Map)) {
+        genLogger().genWarning("Unknown message factory strategy \"" + value + "\", using default.");
+        return;
+    }
+
+    m_msgFactoryStrategy = static_cast<CommsMsgFactoryStrategy>(std::distance(std::begin(Map), iter));
+}
+
+bool CommsGenerator::commsGetPoolMsgFactories() const
+{
+    return m_poolMsgFactories;
+}
+
+void CommsGenerator::commsSetPoolMsgFactories(bool value)
+{
+    m_poolMsgFactories = value;
+}
+
+bool CommsGenerator::commsGetFixedLayoutMessages() const
+{
+    return m_fixedLayoutMessages;
+}
+
+void CommsGenerator::commsSetFixedLayoutMessages(bool value)
+{
+    m_fixedLayoutMessages = value;
+}
+
+bool CommsGenerator::commsGetBulkLists() const
+{
+    return m_bulkLists;
+}
+
+void CommsGenerator::commsSetBulkLists(bool value)
+{
+    m_bulkLists = value;
+}
+
+bool CommsGenerator::commsGetLazyMessages() const
+{
+    return m_lazyMessages;
+}
+
+void CommsGenerator::commsSetLazyMessages(bool value)
+{
+    m_lazyMessages = value;
+}
+
+bool CommsGenerator::commsGetPeekFunctions() const
+{
+    return m_peekFunctions;
+}
+
+void CommsGenerator::commsSetPeekFunctions(bool value)
+{
+    m_peekFunctions = value;
+}
+
+bool CommsGenerator::commsGetPatchFunctions() const
+{
+    return m_patchFunctions;
+}
+
+void CommsGenerator::commsSetPatchFunctions(bool value)
+{
+    m_patchFunctions = value;
+}
+
+bool CommsGenerator::commsGetSkipFunctions() const
+{
+    return m_skipFunctions;
+}
+
+void CommsGenerator::commsSetSkipFunctions(bool value)
+{
+    m_skipFunctions = value;
+}
+
+bool CommsGenerator::commsGetLengthBounds() const
+{
+    return m_lengthBounds;
+}
+
+void CommsGenerator::commsSetLengthBounds(bool value)
+{
+    m_lengthBounds = value;
+}
+
+bool CommsGenerator::commsGetInPlaceStorage() const
+{
+    return m_inPlaceStorage;
+}
+
+void CommsGenerator::commsSetInPlaceStorage(bool value)
+{
+    m_inPlaceStorage = value;
+}
+
+bool CommsGenerator::commsGetSinglePassFrameWrite() const
+{
+    return m_singlePassFrameWrite;
+}
+
+void CommsGenerator::commsSetSinglePassFrameWrite(bool value)
+{
+    m_singlePassFrameWrite = value;
+}
+
+bool CommsGenerator::commsGetFastChecksums() const
+{
+    return m_fastChecksums;
+}
+
+void CommsGenerator::commsSetFastChecksums(bool value)
+{
+    m_fastChecksums = value;
+}
+
+bool CommsGenerator::commsGetReflection() const
+{
+    return m_reflection;
+}
+
+void CommsGenerator::commsSetReflection(bool value)
+{
+    m_reflection = value;
+}
+
+bool CommsGenerator::commsGetJsonEncoders() const
+{
+    return m_jsonEncoders;
+}
+
+void CommsGenerator::commsSetJsonEncoders(bool value)
+{
+    m_jsonEncoders = value;
+}
+
 bool CommsGenerator::commsGetMainNamespaceInOptionsForced() const
 {
     return m_mainNamespaceInOptionsForced;
@@ -136,6 +360,72 @@ const CommsGenerator::CommsExtraMessageBundlesList& CommsGenerator::commsExtraMe
     return m_commsExtraMessageBundles;
 }
 
+const std::string& CommsGenerator::commsGetMsgFrequencyProfile() const
+{
+    return m_msgFrequencyProfile;
+}
+
+void CommsGenerator::commsSetMsgFrequencyProfile(const std::string& value)
+{
+    m_msgFrequencyProfile = value;
+}
+
+std::uintmax_t CommsGenerator::commsMsgFrequency(const commsdsl::gen::GenMessage& msg) const
+{
+    auto iter = m_msgFrequencies.find(&msg);
+    if (iter == m_msgFrequencies.end()) {
+        return 0U;
+    }
+
+    return iter->second;
+}
+
+CommsGenerator::GenMessagesAccessList CommsGenerator::commsHotMessages(const GenMessagesAccessList& messages) const
+{
+    // The most frequent messages, which together make up the majority of the traffic.
+    GenMessagesAccessList result;
+    std::uintmax_t total = 0U;
+    for (auto* m : messages) {
+        auto freq = commsMsgFrequency(*m);
+        if (freq == 0U) {
+            continue;
+        }
+
+        // Saturate instead of wrapping around
+        total += std::min(freq, std::numeric_limits<std::uintmax_t>::max() - total);
+        result.push_back(m);
+    }
+
+    std::stable_sort(
+        result.begin(), result.end(),
+        [this](auto* first, auto* second)
+        {
+            return commsMsgFrequency(*second) < commsMsgFrequency(*first);
+        });
+
+    // Rounded up, split into the hundreds and the remainder when the multiplication overflows
+    static const std::uintmax_t MaxDirectTotal = (std::numeric_limits<std::uintmax_t>::max() - 99U) / CommsHotTrafficPercent;
+    std::uintmax_t required = 0U;
+    if (total <= MaxDirectTotal) {
+        required = ((total * CommsHotTrafficPercent) + 99U) / 100U;
+    }
+    else {
+        required = ((total / 100U) * CommsHotTrafficPercent) + ((((total % 100U) * CommsHotTrafficPercent) + 99U) / 100U);
+    }
+
+    std::uintmax_t covered = 0U;
+    for (auto iter = result.begin(); iter != result.end(); ++iter) {
+        covered += commsMsgFrequency(**iter);
+        auto count = static_cast<std::size_t>(std::distance(result.begin(), iter)) + 1U;
+        if ((required <= covered) || (CommsMaxHotMessages <= count)) {
+            result.erase(std::next(iter), result.end());
+            break;
+        }
+    }
+
+    return result;
+}
+
 const std::string& CommsGenerator::commsMinCommsVersion()
 {
     return CommsMinCommsVersion;
@@ -148,7 +438,9 @@ bool CommsGenerator::genPrepareImpl()
     }
 
     return
-        commsPrepareExtraMessageBundlesInternal();
+        commsPrepareExtraMessageBundlesInternal() &&
+        commsPrepareMsgFrequenciesInternal() &&
+        commsPrepareLazyMessagesInternal();
 }
 
 CommsGenerator::GenSchemaPtr CommsGenerator::genCreateSchemaImpl(commsdsl::parse::ParseSchema parseObj, commsdsl::gen::GenElem* parent)
@@ -278,7 +570,10 @@ bool CommsGenerator::genWriteImpl()
         bool result =
             CommsFieldBase::commsWrite(*this) &&
             CommsVersion::commsWrite(*this) &&
-            CommsDefaultOptions::commsWrite(*this);
+            CommsDefaultOptions::commsWrite(*this) &&
+            CommsFastChecksum::commsWrite(*this) &&
+            CommsReflection::commsWrite(*this) &&
+            CommsJsonEncoder::commsWrite(*this);
 
         if (!result) {
             return false;
@@ -297,9 +592,45 @@ CommsGenerator::OptsProcessResult CommsGenerator::genProcessOptionsImpl(const Ge
     auto& opts = CommsProgramOptions::commsCast(options);
     genSetVersionIndependentCodeForced(opts.commsVersionIndependentCodeRequested());
     commsSetCustomizationLevel(opts.commsGetCustomizationLevel());
+    commsSetDispatchStrategy(opts.commsGetDispatchStrategy());
+    commsSetMsgFactoryStrategy(opts.commsGetMsgFactoryStrategy());
+    commsSetPoolMsgFactories(opts.commsPoolMsgFactoriesRequested());
+    commsSetFixedLayoutMessages(opts.commsFixedLayoutMessagesRequested());
+    commsSetBulkLists(opts.commsBulkListsRequested());
+    commsSetLazyMessages(opts.commsLazyMessagesRequested());
+    commsSetPeekFunctions(opts.commsPeekFunctionsRequested());
+    commsSetPatchFunctions(opts.commsPatchFunctionsRequested());
+    commsSetSkipFunctions(opts.commsSkipFunctionsRequested());
+    commsSetLengthBounds(opts.commsLengthBoundsRequested());
+    commsSetInPlaceStorage(opts.commsInPlaceStorageRequested());
+    commsSetSinglePassFrameWrite(opts.commsSinglePassFrameWriteRequested());
+    commsSetFastChecksums(opts.commsFastChecksumsRequested());
+    commsSetReflection(opts.commsReflectionRequested());
+    commsSetJsonEncoders(opts.commsJsonEncodersRequested());
     commsSetExtraInputBundles(opts.commsGetExtraInputBundles());
+    commsSetMsgFrequencyProfile(opts.commsGetMsgFrequencyProfile());
     commsSetMainNamespaceInOptionsForced(opts.commsIsMainNamespaceInOptionsForced());
 
+    if (opts.commsHasFixedRemoteVersion()) {
+        auto version = opts.commsGetFixedRemoteVersion();
+        if (opts.genHasForcedSchemaVersion() && (opts.genGetForcedSchemaVersion() != version)) {
+            genLogger().genError("The forced schema version doesn't match the fixed remote version.");
+            return OptsProcessResult_Failure;
+        }
+
+        if ((opts.genGetMinRemoteVersion() != 0U) && (opts.genGetMinRemoteVersion() != version)) {
+            genLogger().genError("The minimal remote version doesn't match the fixed remote version.");
+            return OptsProcessResult_Failure;
+        }
+
+        // The fields introduced after or removed by the fixed version are dropped,
+        // the rest are not optional and no version information is kept.
+        genForceSchemaVersion(version);
+        genSetMinRemoteVersion(version);
+        genSetVersionIndependentCodeForced(true);
+        genSetMissingFieldsDropped(true);
+    }
+
     return OptsProcessResult_Continue;
 }
 
@@ -353,6 +684,127 @@ bool CommsGenerator::commsPrepareExtraMessageBundlesInternal()
     return true;
 }
 
+bool CommsGenerator::commsPrepareMsgFrequenciesInternal()
+{
+    if (m_msgFrequencyProfile.empty()) {
+        return true;
+    }
+
+    std::ifstream stream(m_msgFrequencyProfile);
+    if (!stream) {
+        genLogger().genError("Failed to read messages frequency profile file " + m_msgFrequencyProfile);
+        return false;
+    }
+
+    std::string contents(std::istreambuf_iterator<char>(stream), (std::istreambuf_iterator<char>()));
+    auto lines = util::genStrSplitByAnyChar(contents, "\n\r");
+    auto allMessages = genGetAllMessages();
+    bool firstLine = true;
+    for (auto& l : lines) {
+        auto line = commsTrimInternal(l);
+        if (line.empty() || (line[0] == '#')) {
+            continue;
+        }
+
+        bool headerAllowed = firstLine;
+        firstLine = false;
+
+        auto tokens = util::genStrSplitByAnyChar(line, ",;\t");
+        if (tokens.size() != 2U) {
+            genLogger().genError("Invalid line \"" + line + "\" in messages frequency profile file " + m_msgFrequencyProfile);
+            return false;
+        }
+
+        auto key = commsTrimInternal(tokens[0]);
+        auto countStr = commsTrimInternal(tokens[1]);
+        if (!commsIsDecimalInternal(countStr)) {
+            if (headerAllowed) {
+                continue;
+            }
+
+            genLogger().genError("Invalid count in line \"" + line + "\" in messages frequency profile file " + m_msgFrequencyProfile);
+            return false;
+        }
+
+        std::uintmax_t count = 0U;
+        bool isId = commsIsDecimalInternal(key);
+        std::uintmax_t id = 0U;
+        try {
+            count = static_cast<std::uintmax_t>(std::stoull(countStr));
+            if (isId) {
+                id = static_cast<std::uintmax_t>(std::stoull(key));
+            }
+        }
+        catch (const std::out_of_range&) {
+            genLogger().genError("Too big value in line \"" + line + "\" in messages frequency profile file " + m_msgFrequencyProfile);
+            return false;
+        }
+
+        GenMessagesAccessList messages;
+        std::copy_if(
+            allMessages.begin(), allMessages.end(), std::back_inserter(messages),
+            [isId, id, &key](auto* m)
+            {
+                auto parseObj = m->genParseObj();
+                if (isId) {
+                    return parseObj.parseId() == id;
+                }
+
+                return (parseObj.parseExternalRef(false) == key) || (parseObj.parseExternalRef(true) == key);
+            });
+
+        if (messages.empty()) {
+            genLogger().genWarning("Unknown message \"" + key + "\" in messages frequency profile, ignored.");
+            continue;
+        }
+
+        for (auto* m : messages) {
+            auto& freq = m_msgFrequencies[m];
+            freq += std::min(count, std::numeric_limits<std::uintmax_t>::max() - freq);
+        }
+    }
+
+    return true;
+}
+
+bool CommsGenerator::commsPrepareLazyMessagesInternal()
+{
+    if (!m_lazyMessages) {
+        return true;
+    }
+
+    // The lazy messages consume the whole provided payload,
+    // it must be delimited by the size layer.
+    using LayerKind = commsdsl::parse::ParseLayer::ParseKind;
+    auto allFrames = genGetAllFrames();
+    for (auto* f : allFrames) {
+        auto& layers = f->genLayers();
+        bool hasSize =
+            std::any_of(
+                layers.begin(), layers.end(),
+                [](auto& l)
+                {
+                    auto layerObj = l->genParseObj();
+                    if (layerObj.parseKind() == LayerKind::Size) {
+                        return true;
+                    }
+
+                    return
+                        (layerObj.parseKind() == LayerKind::Custom) &&
+                        (commsdsl::parse::ParseCustomLayer(layerObj).parseSemanticLayerType() == LayerKind::Size);
+                });
+
+        if (!hasSize) {
+            genLogger().genError(
+                "The lazy messages require the payload to be delimited by the size layer, "
+                "which the \"" + f->genParseObj().parseExternalRef(false) + "\" frame doesn't have.");
+            return false;
+        }
+    }
+
+    return true;
+}
+
 bool CommsGenerator::commsWriteExtraFilesInternal() const
 {
     const std::vector<std::string> ReservedExt = {
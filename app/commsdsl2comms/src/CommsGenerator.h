@@ -18,6 +18,11 @@
 
 #include "commsdsl/gen/GenGenerator.h"
 
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
 namespace commsdsl2comms
 {
 
@@ -46,6 +51,23 @@ public:
         NumOfValues
     };
 
+    enum class CommsDispatchStrategy
+    {
+        Auto,
+        Switch,
+        Table,
+        Hash,
+        NumOfValues
+    };
+
+    enum class CommsMsgFactoryStrategy
+    {
+        Auto,
+        Switch,
+        Table,
+        NumOfValues
+    };
+
     static const CommsGenerator& commsCast(const commsdsl::gen::GenGenerator& ref)
     {
         return static_cast<const CommsGenerator&>(ref);
@@ -55,6 +77,51 @@ public:
     CommsCustomizationLevel commsGetCustomizationLevel() const;
     void commsSetCustomizationLevel(const std::string& opt);
 
+    CommsDispatchStrategy commsGetDispatchStrategy() const;
+    void commsSetDispatchStrategy(const std::string& opt);
+
+    CommsMsgFactoryStrategy commsGetMsgFactoryStrategy() const;
+    void commsSetMsgFactoryStrategy(const std::string& opt);
+
+    bool commsGetPoolMsgFactories() const;
+    void commsSetPoolMsgFactories(bool value);
+
+    bool commsGetFixedLayoutMessages() const;
+    void commsSetFixedLayoutMessages(bool value);
+
+    bool commsGetBulkLists() const;
+    void commsSetBulkLists(bool value);
+
+    bool commsGetLazyMessages() const;
+    void commsSetLazyMessages(bool value);
+
+    bool commsGetPeekFunctions() const;
+    void commsSetPeekFunctions(bool value);
+
+    bool commsGetPatchFunctions() const;
+    void commsSetPatchFunctions(bool value);
+
+    bool commsGetSkipFunctions() const;
+    void commsSetSkipFunctions(bool value);
+
+    bool commsGetLengthBounds() const;
+    void commsSetLengthBounds(bool value);
+
+    bool commsGetInPlaceStorage() const;
+    void commsSetInPlaceStorage(bool value);
+
+    bool commsGetSinglePassFrameWrite() const;
+    void commsSetSinglePassFrameWrite(bool value);
+
+    bool commsGetFastChecksums() const;
+    void commsSetFastChecksums(bool value);
+
+    bool commsGetReflection() const;
+    void commsSetReflection(bool value);
+
+    bool commsGetJsonEncoders() const;
+    void commsSetJsonEncoders(bool value);
+
     bool commsGetMainNamespaceInOptionsForced() const;
     void commsSetMainNamespaceInOptionsForced(bool value);
     bool commsHasMainNamespaceInOptions() const;
@@ -63,6 +130,11 @@ public:
     void commsSetExtraInputBundles(const std::vector<std::string>& inputBundles);
     const CommsExtraMessageBundlesList& commsExtraMessageBundles() const;
 
+    const std::string& commsGetMsgFrequencyProfile() const;
+    void commsSetMsgFrequencyProfile(const std::string& value);
+    std::uintmax_t commsMsgFrequency(const commsdsl::gen::GenMessage& msg) const;
+    GenMessagesAccessList commsHotMessages(const GenMessagesAccessList& messages) const;
+
     static const std::string& commsMinCommsVersion();
 
 protected:
@@ -100,13 +172,32 @@ protected:
 
 private:
     bool commsPrepareExtraMessageBundlesInternal();
+    bool commsPrepareMsgFrequenciesInternal();
+    bool commsPrepareLazyMessagesInternal();
     bool commsWriteExtraFilesInternal() const;
 
     static const CommsCustomizationLevel DefaultCustomizationLevel = CommsCustomizationLevel::Limited;
     CommsCustomizationLevel m_customizationLevel = DefaultCustomizationLevel;
+    CommsDispatchStrategy m_dispatchStrategy = CommsDispatchStrategy::Switch;
+    CommsMsgFactoryStrategy m_msgFactoryStrategy = CommsMsgFactoryStrategy::Switch;
     std::vector<std::string> m_extraInputBundles;
     CommsExtraMessageBundlesList m_commsExtraMessageBundles;
+    std::string m_msgFrequencyProfile;
+    std::map<const commsdsl::gen::GenMessage*, std::uintmax_t> m_msgFrequencies;
     bool m_mainNamespaceInOptionsForced = false;
+    bool m_poolMsgFactories = false;
+    bool m_fixedLayoutMessages = false;
+    bool m_bulkLists = false;
+    bool m_lazyMessages = false;
+    bool m_peekFunctions = false;
+    bool m_patchFunctions = false;
+    bool m_skipFunctions = false;
+    bool m_lengthBounds = false;
+    bool m_inPlaceStorage = false;
+    bool m_singlePassFrameWrite = false;
+    bool m_fastChecksums = false;
+    bool m_reflection = false;
+    bool m_jsonEncoders = false;
 };
 
 } // namespace commsdsl2comms
@@ -98,6 +98,11 @@ CommsIdLayer::GenStringsList CommsIdLayer::commsExtraBareMetalDefaultOptionsImpl
         };
 }
 
+CommsIdLayer::GenStringsList CommsIdLayer::commsExtraHighThroughputDefaultOptionsImpl() const
+{
+    return commsExtraMsgFactoryDefaultOptionsImpl();
+}
+
 CommsIdLayer::GenStringsList CommsIdLayer::commsExtraMsgFactoryDefaultOptionsImpl() const
 {
     return
@@ -43,6 +43,7 @@ protected:
     virtual bool commsDefHasInputMessagesImpl() const override;
     virtual bool commsIsCustomizableImpl() const override;
     virtual GenStringsList commsExtraBareMetalDefaultOptionsImpl() const override;
+    virtual GenStringsList commsExtraHighThroughputDefaultOptionsImpl() const override;
     virtual GenStringsList commsExtraMsgFactoryDefaultOptionsImpl() const override;
 };
 
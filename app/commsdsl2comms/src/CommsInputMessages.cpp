@@ -27,7 +27,7 @@
 #include <algorithm>
 #include <cassert>
 #include <functional>
-#include <fstream>
+#include <vector>
 
 namespace comms = commsdsl::gen::comms;
 namespace strings = commsdsl::gen::strings;
@@ -43,6 +43,238 @@ const std::string ClientInputSuffixStr = "ClientInputMessages";
 const std::string ServerInputSuffixStr = "ServerInputMessages";
 
 using CheckFunction = std::function<bool (const commsdsl::gen::GenMessage&)>;
+using MessagesList = std::vector<const commsdsl::gen::GenMessage*>;
+
+std::string storageInternal(
+    const std::string& name,
+    CommsGenerator& generator,
+    const MessagesList& messages)
+{
+    if ((!generator.commsGetInPlaceStorage()) || messages.empty()) {
+        return strings::genEmptyString();
+    }
+
+    static const std::string Templ =
+        "/// @brief In-place storage of any message from the @ref #^#NAME#$# bundle.\n"
+        "/// @details Holds the message object by value, no dynamic memory allocation\n"
+        "///     is involved. The stored message is accessed via @ref visit(), which\n"
+        "///     uses the real message type and doesn't require virtual functions.\n"
+        "/// @tparam TBase Base class of all the messages.\n"
+        "/// @tparam TOpt Protocol definition options.\n"
+        "template <typename TBase, typename TOpt = #^#OPTIONS#$#>\n"
+        "class #^#NAME#$#Storage\n"
+        "{\n"
+        "public:\n"
+        "    /// @brief Bundle of the stored messages.\n"
+        "    using Messages = #^#NAME#$#<TBase, TOpt>;\n\n"
+        "    /// @brief Value of @ref index() when no message is stored.\n"
+        "    static const std::size_t NoMessageIdx = std::tuple_size<Messages>::value;\n\n"
+        "    #^#NAME#$#Storage() = default;\n"
+        "    #^#NAME#$#Storage(const #^#NAME#$#Storage&) = delete;\n\n"
+        "    ~#^#NAME#$#Storage()\n"
+        "    {\n"
+        "        reset();\n"
+        "    }\n\n"
+        "    #^#NAME#$#Storage& operator=(const #^#NAME#$#Storage&) = delete;\n\n"
+        "    /// @brief Check whether no message is stored.\n"
+        "    bool empty() const\n"
+        "    {\n"
+        "        return m_idx == NoMessageIdx;\n"
+        "    }\n\n"
+        "    /// @brief Index of the stored message in the @ref Messages bundle.\n"
+        "    std::size_t index() const\n"
+        "    {\n"
+        "        return m_idx;\n"
+        "    }\n\n"
+        "    /// @brief Construct the message with the provided index in the @ref Messages bundle.\n"
+        "    /// @details The previously stored message is destructed.\n"
+        "    template <std::size_t TIdx>\n"
+        "    typename std::tuple_element<TIdx, Messages>::type& emplace()\n"
+        "    {\n"
+        "        using MsgType = typename std::tuple_element<TIdx, Messages>::type;\n"
+        "        reset();\n"
+        "        auto* msg = new (&m_data) MsgType;\n"
+        "        m_idx = TIdx;\n"
+        "        return *msg;\n"
+        "    }\n\n"
+        "    /// @brief Access the stored message with the provided index in the @ref Messages bundle.\n"
+        "    /// @pre @ref index() == TIdx\n"
+        "    template <std::size_t TIdx>\n"
+        "    typename std::tuple_element<TIdx, Messages>::type& get()\n"
+        "    {\n"
+        "        using MsgType = typename std::tuple_element<TIdx, Messages>::type;\n"
+        "        COMMS_ASSERT(m_idx == TIdx);\n"
+        "        return *(reinterpret_cast<MsgType*>(&m_data));\n"
+        "    }\n\n"
+        "    /// @brief Construct the message with the provided numeric ID.\n"
+        "    /// @param[in] id Numeric message ID.\n"
+        "    /// @param[in] idx Index of the message among messages with the same ID.\n"
+        "    /// @return @b true in case the message has been constructed, @b false in case\n"
+        "    ///     the bundle doesn't contain such message, the storage is emptied then.\n"
+        "    template <typename TId>\n"
+        "    bool emplaceById(TId id, std::size_t idx = 0U)\n"
+        "    {\n"
+        "        switch (static_cast<std::intmax_t>(id)) {\n"
+        "        #^#EMPLACE_CASES#$#\n"
+        "        default:\n"
+        "            break;\n"
+        "        }\n\n"
+        "        reset();\n"
+        "        return false;\n"
+        "    }\n\n"
+        "    /// @brief Destruct the stored message.\n"
+        "    void reset()\n"
+        "    {\n"
+        "        switch (m_idx) {\n"
+        "        #^#RESET_CASES#$#\n"
+        "        default:\n"
+        "            break;\n"
+        "        }\n\n"
+        "        m_idx = NoMessageIdx;\n"
+        "    }\n\n"
+        "    /// @brief Pass the stored message to the appropriate @b handle() member\n"
+        "    ///     function of the handler, similar to the @b dispatchMessage().\n"
+        "    /// @details Every @b handle() function must return the @b same type.\n"
+        "    /// @pre @ref empty() == false\n"
+        "    template <typename THandler>\n"
+        "    auto visit(THandler& handler) -> decltype(handler.handle(std::declval<typename std::tuple_element<0U, Messages>::type&>()))\n"
+        "    {\n"
+        "        COMMS_ASSERT(!empty());\n"
+        "        #^#VISIT#$#\n"
+        "    }\n\n"
+        "    /// @brief Construct the message with the provided numeric ID and read its contents.\n"
+        "    /// @details Messages sharing the same ID are tried one by one until the read\n"
+        "    ///     succeeds. The storage remains empty when none of them does.\n"
+        "    /// @param[in] id Numeric message ID.\n"
+        "    /// @param[in, out] iter Iterator used for reading, advanced only on success.\n"
+        "    /// @param[in] len Number of bytes available for reading.\n"
+        "    template <typename TId, typename TIter>\n"
+        "    comms::ErrorStatus read(TId id, TIter& iter, std::size_t len)\n"
+        "    {\n"
+        "        auto es = comms::ErrorStatus::InvalidMsgId;\n"
+        "        for (std::size_t idx = 0U; emplaceById(id, idx); ++idx) {\n"
+        "            auto readIter = iter;\n"
+        "            ReadHelper<TIter> helper(readIter, len);\n"
+        "            es = visit(helper);\n"
+        "            if (es == comms::ErrorStatus::Success) {\n"
+        "                iter = readIter;\n"
+        "                return es;\n"
+        "            }\n"
+        "        }\n\n"
+        "        return es;\n"
+        "    }\n\n"
+        "private:\n"
+        "    template <typename TIter>\n"
+        "    struct ReadHelper\n"
+        "    {\n"
+        "        ReadHelper(TIter& iter, std::size_t len) :\n"
+        "            m_iter(iter),\n"
+        "            m_len(len)\n"
+        "        {\n"
+        "        }\n\n"
+        "        template <typename TMsg>\n"
+        "        comms::ErrorStatus handle(TMsg& msg)\n"
+        "        {\n"
+        "            return msg.doRead(m_iter, m_len);\n"
+        "        }\n\n"
+        "    private:\n"
+        "        TIter& m_iter;\n"
+        "        std::size_t m_len = 0U;\n"
+        "    };\n\n"
+        "    using Data = typename comms::util::TupleAsAlignedUnion<Messages>::Type;\n\n"
+        "    Data m_data;\n"
+        "    std::size_t m_idx = NoMessageIdx;\n"
+        "};\n";
+
+    static const std::string EmplaceTempl =
+        "if (idx == #^#IDX#$#) {\n"
+        "    emplace<#^#MSG_IDX#$#>();\n"
+        "    return true;\n"
+        "}";
+
+    static const std::string EmplaceCaseTempl =
+        "case #^#ID#$#:\n"
+        "    #^#EMPLACES#$#\n"
+        "    break;";
+
+    static const std::string ResetTempl =
+        "case #^#MSG_IDX#$#:\n"
+        "{\n"
+        "    using MsgType = typename std::tuple_element<#^#MSG_IDX#$#, Messages>::type;\n"
+        "    get<#^#MSG_IDX#$#>().~MsgType();\n"
+        "    break;\n"
+        "}";
+
+    static const std::string VisitCaseTempl =
+        "case #^#MSG_IDX#$#:\n"
+        "    return handler.handle(get<#^#MSG_IDX#$#>());";
+
+    static const std::string VisitTempl =
+        "switch (m_idx) {\n"
+        "#^#CASES#$#\n"
+        "default:\n"
+        "    break;\n"
+        "}\n\n"
+        "return handler.handle(get<#^#LAST_IDX#$#>());";
+
+    util::GenStringsList emplaceCases;
+    util::GenStringsList resetCases;
+    util::GenStringsList visitCases;
+    util::GenStringsList sameIdEmplaces;
+    std::size_t sameIdCount = 0U;
+    for (std::size_t idx = 0U; idx < messages.size(); ++idx) {
+        auto* m = messages[idx];
+        auto msgIdxStr = util::genNumToString(idx) + 'U';
+        util::GenReplacementMap repl = {
+            {"IDX", util::genNumToString(sameIdCount) + 'U'},
+            {"MSG_IDX", msgIdxStr},
+        };
+
+        sameIdEmplaces.push_back(util::genProcessTemplate(EmplaceTempl, repl));
+        resetCases.push_back(util::genProcessTemplate(ResetTempl, repl));
+        if ((idx + 1U) < messages.size()) {
+            visitCases.push_back(util::genProcessTemplate(VisitCaseTempl, repl));
+        }
+
+        auto id = m->genParseObj().parseId();
+        if (((idx + 1U) < messages.size()) &&
+            (messages[idx + 1U]->genParseObj().parseId() == id)) {
+            ++sameIdCount;
+            continue;
+        }
+
+        util::GenReplacementMap caseRepl = {
+            {"ID", util::genNumToStringWithHexComment(id)},
+            {"EMPLACES", util::genStrListToString(sameIdEmplaces, "\n", "")},
+        };
+
+        emplaceCases.push_back(util::genProcessTemplate(EmplaceCaseTempl, caseRepl));
+
+        sameIdEmplaces.clear();
+        sameIdCount = 0U;
+    }
+
+    std::string visit = "return handler.handle(get<0U>());";
+    if (!visitCases.empty()) {
+        util::GenReplacementMap visitRepl = {
+            {"CASES", util::genStrListToString(visitCases, "\n", "")},
+            {"LAST_IDX", util::genNumToString(messages.size() - 1U) + 'U'},
+        };
+
+        visit = util::genProcessTemplate(VisitTempl, visitRepl);
+    }
+
+    util::GenReplacementMap repl = {
+        {"NAME", name},
+        {"OPTIONS", comms::genScopeForOptions(strings::genDefaultOptionsClassStr(), generator)},
+        {"EMPLACE_CASES", util::genStrListToString(emplaceCases, "\n", "")},
+        {"RESET_CASES", util::genStrListToString(resetCases, "\n", "")},
+        {"VISIT", std::move(visit)},
+    };
+
+    return util::genProcessTemplate(Templ, repl);
+}
+
 bool writeFileInternal(
     const std::string& name,
     const std::string& desc,
@@ -59,12 +291,6 @@ bool writeFileInternal(
         return false;
     }
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        generator.genLogger().genError("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
-
     auto allMessages = parent.genGetAllMessagesIdSorted();
     util::GenStringsList includes = {
         "<tuple>",
@@ -73,6 +299,7 @@ bool writeFileInternal(
 
     util::GenStringsList scopes;
     util::GenStringsList aliases;
+    MessagesList messages;
 
     for (auto* m : allMessages) {
         assert(m != nullptr);
@@ -80,6 +307,8 @@ bool writeFileInternal(
             continue;
         }
 
+        messages.push_back(m);
+
         auto scopeStr = comms::genScopeFor(*m, generator);
         auto aliasStr =
             "using prefix_ ## " + comms::genClassName(m->genParseObj().parseName()) + " ## suffix_ = " + scopeStr + "<interface_, opts_>;";
@@ -106,6 +335,7 @@ bool writeFileInternal(
         "        #^#MESSAGES#$#\n"
         "    >;\n\n"
         "#^#EXTEND#$#\n"
+        "#^#STORAGE#$#\n"
         "#^#APPEND#$#\n"
         "} // namespace input\n\n"
         "#^#NS_END#$#\n"
@@ -124,6 +354,20 @@ bool writeFileInternal(
         "    #^#PROT_PREFIX#$#_ALIASES_FOR_#^#MACRO_NAME#$#(prefix_, suffix_, interface_, #^#OPTIONS#$#)\n"
         ;
 
+    auto storage = storageInternal(name, generator, messages);
+    if (!storage.empty()) {
+        includes.insert(includes.end(), {
+            "<cstddef>",
+            "<cstdint>",
+            "<new>",
+            "<type_traits>",
+            "<utility>",
+            "comms/Assert.h",
+            "comms/ErrorStatus.h",
+            "comms/util/Tuple.h"
+        });
+    }
+
     comms::genPrepareIncludeStatement(includes);
     bool classExtended = false;
     util::GenReplacementMap repl = {
@@ -141,15 +385,14 @@ bool writeFileInternal(
         {"ALIASES", util::genStrListToString(aliases, " \\\n", "\n")},
         {"DESC", desc},
         {"LOW_DESC", util::genStrToLower(desc)},
+        {"STORAGE", std::move(storage)},
     };
 
     if (classExtended) {
         repl["ORIG"] = strings::genOrigSuffixStr();
     }
 
-    stream << util::genProcessTemplate(Templ, repl, true);
-    stream.flush();
-    return stream.good();
+    return generator.genWriteFile(filePath, util::genProcessTemplate(Templ, repl, true));
 }
 
 } // namespace
@@ -25,7 +25,6 @@
 
 #include <algorithm>
 #include <cassert>
-#include <fstream>
 #include <iterator>
 
 namespace comms = commsdsl::gen::comms;
@@ -232,12 +231,6 @@ bool CommsInterface::commsWriteCommonInternal() const
         return false;
     }
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        gen.genLogger().genError("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
-
     static const std::string Templ =
         "#^#GENERATED#$#\n"
         "/// @file\n"
@@ -267,9 +260,7 @@ bool CommsInterface::commsWriteCommonInternal() const
         {"CODE", commsCommonFieldsCodeInternal()}
     };
 
-    stream << util::genProcessTemplate(Templ, repl, true);
-    stream.flush();
-    return stream.good();
+    return gen.genWriteFile(filePath, util::genProcessTemplate(Templ, repl, true));
 }
 
 bool CommsInterface::commsWriteDefInternal() const
@@ -287,15 +278,7 @@ bool CommsInterface::commsWriteDefInternal() const
                 return false;
             }
 
-            std::ofstream stream(filePath);
-            if (!stream) {
-                logger.genError("Failed to open \"" + filePath + "\" for writing.");
-                return false;
-            }
-
-            stream << content;
-            stream.flush();
-            return stream.good();
+            return gen.genWriteFile(filePath, content);
         };
 
     auto genFilePath = comms::genHeaderPathFor(*this, gen);
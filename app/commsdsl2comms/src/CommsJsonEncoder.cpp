@@ -0,0 +1,642 @@
+//
+// Copyright 2025 - 2025 (C). Alex Robenko. All rights reserved.
+//
+// SPDX-License-Identifier: Apache-2.0
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "CommsJsonEncoder.h"
+
+#include "CommsGenerator.h"
+#include "CommsMessage.h"
+#include "CommsSchema.h"
+
+#include "commsdsl/gen/GenBitfieldField.h"
+#include "commsdsl/gen/GenBundleField.h"
+#include "commsdsl/gen/GenListField.h"
+#include "commsdsl/gen/GenOptionalField.h"
+#include "commsdsl/gen/GenVariantField.h"
+#include "commsdsl/gen/comms.h"
+#include "commsdsl/gen/strings.h"
+#include "commsdsl/gen/util.h"
+
+#include <cassert>
+
+namespace comms = commsdsl::gen::comms;
+namespace strings = commsdsl::gen::strings;
+namespace util = commsdsl::gen::util;
+
+namespace commsdsl2comms
+{
+
+namespace
+{
+
+using ParseField = commsdsl::parse::ParseField;
+using GenField = commsdsl::gen::GenField;
+using GenFieldsList = GenField::GenFieldsList;
+
+const std::string CommsJsonWriterName("JsonWriter");
+
+const GenField& commsOptionalMemberInternal(const GenField& field)
+{
+    auto& optField = static_cast<const commsdsl::gen::GenOptionalField&>(field);
+    auto* mem = optField.genMemberField();
+    if (mem == nullptr) {
+        mem = optField.genExternalField();
+    }
+
+    assert(mem != nullptr);
+    return *mem;
+}
+
+// Both JSON and text keys are prepared at generation time
+std::string commsKeyInternal(const GenField& field)
+{
+    auto& name = field.genParseObj().parseName();
+    return "out.key(\"\\\"" + name + "\\\":\", \"" + name + "=\");";
+}
+
+std::string commsValueCodeInternal(const GenField& field, const std::string& expr, unsigned& varIdx);
+
+std::string commsMemberCodeInternal(const GenField& field, const std::string& expr, unsigned& varIdx)
+{
+    // Missing optional fields are omitted
+    util::GenStringsList conds;
+    auto valueExpr = expr;
+    if (comms::genIsVersionOptionalField(field, field.genGenerator())) {
+        conds.push_back(valueExpr + ".doesExist()");
+        valueExpr += ".field()";
+    }
+
+    auto* valueField = &CommsField::commsResolvedField(field);
+    if (valueField->genParseObj().parseKind() == ParseField::ParseKind::Optional) {
+        conds.push_back(valueExpr + ".doesExist()");
+        valueExpr += ".field()";
+        valueField = &commsOptionalMemberInternal(*valueField);
+    }
+
+    auto code = commsKeyInternal(field) + '\n' + commsValueCodeInternal(*valueField, valueExpr, varIdx);
+    if (conds.empty()) {
+        return code;
+    }
+
+    static const std::string Templ =
+        "if (#^#COND#$#) {\n"
+        "    #^#CODE#$#\n"
+        "}";
+
+    util::GenReplacementMap repl = {
+        {"COND", util::genStrListToString(conds, " && ", "")},
+        {"CODE", std::move(code)},
+    };
+
+    return util::genProcessTemplate(Templ, repl);
+}
+
+std::string commsMembersCodeInternal(const GenFieldsList& members, const std::string& expr, unsigned& varIdx)
+{
+    static const std::string Templ =
+        "out.beginObject();\n"
+        "#^#MEMBERS#$#\n"
+        "out.endObject();";
+
+    util::GenStringsList membersCode;
+    for (auto& m : members) {
+        auto accName = comms::genAccessName(m->genParseObj().parseName());
+        membersCode.push_back(commsMemberCodeInternal(*m, expr + ".field_" + accName + "()", varIdx));
+    }
+
+    util::GenReplacementMap repl = {
+        {"MEMBERS", util::genStrListToString(membersCode, "\n", "")},
+    };
+
+    return util::genProcessTemplate(Templ, repl);
+}
+
+std::string commsListCodeInternal(const GenField& field, const std::string& expr, unsigned& varIdx)
+{
+    auto& listField = static_cast<const commsdsl::gen::GenListField&>(field);
+    auto* elem = listField.genMemberElementField();
+    if (elem == nullptr) {
+        elem = listField.genExternalElementField();
+    }
+
+    assert(elem != nullptr);
+    auto elemVar = "elem" + std::to_string(++varIdx);
+
+    static const std::string Templ =
+        "out.beginArray();\n"
+        "for (auto& #^#ELEM#$# : #^#EXPR#$#.value()) {\n"
+        "    out.element();\n"
+        "    #^#VALUE#$#\n"
+        "}\n"
+        "out.endArray();";
+
+    util::GenReplacementMap repl = {
+        {"ELEM", elemVar},
+        {"EXPR", expr},
+        {"VALUE", commsValueCodeInternal(CommsField::commsResolvedField(*elem), elemVar, varIdx)},
+    };
+
+    return util::genProcessTemplate(Templ, repl);
+}
+
+std::string commsOptionalCodeInternal(const GenField& field, const std::string& expr, unsigned& varIdx)
+{
+    static const std::string Templ =
+        "if (#^#EXPR#$#.doesExist()) {\n"
+        "    #^#VALUE#$#\n"
+        "}\n"
+        "else {\n"
+        "    out.writeNull();\n"
+        "}";
+
+    util::GenReplacementMap repl = {
+        {"EXPR", expr},
+        {"VALUE", commsValueCodeInternal(CommsField::commsResolvedField(commsOptionalMemberInternal(field)), expr + ".field()", varIdx)},
+    };
+
+    return util::genProcessTemplate(Templ, repl);
+}
+
+std::string commsVariantCodeInternal(const GenField& field, const std::string& expr, unsigned& varIdx)
+{
+    auto& members = static_cast<const commsdsl::gen::GenVariantField&>(field).genMembers();
+    if (members.empty()) {
+        return "out.beginObject();\nout.endObject();";
+    }
+
+    auto typeName = "Variant" + std::to_string(++varIdx);
+
+    static const std::string Templ =
+        "out.beginObject();\n"
+        "{\n"
+        "    using #^#TYPE#$# = typename std::decay<decltype(#^#EXPR#$#)>::type;\n"
+        "    switch (#^#EXPR#$#.currentField()) {\n"
+        "        #^#CASES#$#\n"
+        "        default: break;\n"
+        "    }\n"
+        "}\n"
+        "out.endObject();";
+
+    static const std::string CaseTempl =
+        "case #^#TYPE#$#::FieldIdx_#^#NAME#$#:\n"
+        "    #^#CODE#$#\n"
+        "    break;";
+
+    util::GenStringsList cases;
+    for (auto& m : members) {
+        auto accName = comms::genAccessName(m->genParseObj().parseName());
+        util::GenReplacementMap caseRepl = {
+            {"TYPE", typeName},
+            {"NAME", accName},
+            {"CODE", commsMemberCodeInternal(*m, expr + ".accessField_" + accName + "()", varIdx)},
+        };
+
+        cases.push_back(util::genProcessTemplate(CaseTempl, caseRepl));
+    }
+
+    util::GenReplacementMap repl = {
+        {"TYPE", typeName},
+        {"EXPR", expr},
+        {"CASES", util::genStrListToString(cases, "\n", "")},
+    };
+
+    return util::genProcessTemplate(Templ, repl);
+}
+
+std::string commsValueCodeInternal(const GenField& field, const std::string& expr, unsigned& varIdx)
+{
+    auto kind = field.genParseObj().parseKind();
+    switch (kind) {
+        case ParseField::ParseKind::Int:
+        case ParseField::ParseKind::Set:
+            return "out.writeInt(" + expr + ".value());";
+        case ParseField::ParseKind::Enum:
+            return "out.writeEnum(" + expr + ".value(), " + expr + ".valueName());";
+        case ParseField::ParseKind::Float:
+            return "out.writeFloat(static_cast<double>(" + expr + ".value()));";
+        case ParseField::ParseKind::String:
+            return "out.writeString(" + expr + ".value());";
+        case ParseField::ParseKind::Data:
+            return "out.writeHex(" + expr + ".value());";
+        case ParseField::ParseKind::Bitfield:
+            return commsMembersCodeInternal(static_cast<const commsdsl::gen::GenBitfieldField&>(field).genMembers(), expr, varIdx);
+        case ParseField::ParseKind::Bundle:
+            return commsMembersCodeInternal(static_cast<const commsdsl::gen::GenBundleField&>(field).genMembers(), expr, varIdx);
+        case ParseField::ParseKind::List:
+            return commsListCodeInternal(field, expr, varIdx);
+        case ParseField::ParseKind::Optional:
+            return commsOptionalCodeInternal(field, expr, varIdx);
+        case ParseField::ParseKind::Variant:
+            return commsVariantCodeInternal(field, expr, varIdx);
+        case ParseField::ParseKind::Ref:
+            return commsValueCodeInternal(CommsField::commsResolvedField(field), expr, varIdx);
+        default:
+            break;
+    }
+
+    [[maybe_unused]] static constexpr bool Should_not_happen = false;
+    assert(Should_not_happen);
+    return "out.writeNull();";
+}
+
+} // namespace
+
+bool CommsJsonEncoder::commsWrite(CommsGenerator& generator)
+{
+    if (!generator.commsGetJsonEncoders()) {
+        return true;
+    }
+
+    auto& thisSchema = static_cast<const CommsSchema&>(generator.genCurrentSchema());
+    if ((!generator.genIsCurrentProtocolSchema()) && (!thisSchema.commsHasAnyGeneratedCode())) {
+        return true;
+    }
+
+    CommsJsonEncoder obj(generator);
+    return obj.commsWriteInternal();
+}
+
+bool CommsJsonEncoder::commsWriteMessage(const CommsGenerator& generator, const CommsMessage& msg)
+{
+    if (!generator.commsGetJsonEncoders()) {
+        return true;
+    }
+
+    CommsJsonEncoder obj(generator);
+    return obj.commsWriteMessageInternal(msg);
+}
+
+bool CommsJsonEncoder::commsWriteInternal() const
+{
+    auto filePath = comms::genHeaderPathRoot(CommsJsonWriterName, m_commsGenerator);
+    m_commsGenerator.genLogger().genInfo("Generating " + filePath);
+
+    auto dirPath = util::genPathUp(filePath);
+    assert(!dirPath.empty());
+    if (!m_commsGenerator.genCreateDirectory(dirPath)) {
+        return false;
+    }
+
+    const std::string Templ =
+        "#^#GENERATED#$#\n"
+        "/// @file\n"
+        "/// @brief Contains definition of @ref #^#PROT_NAMESPACE#$#::JsonWriter class.\n\n"
+        "#pragma once\n\n"
+        "#include <clocale>\n"
+        "#include <cmath>\n"
+        "#include <cstddef>\n"
+        "#include <cstdint>\n"
+        "#include <cstdio>\n"
+        "#include <cstring>\n"
+        "#include <type_traits>\n\n"
+        "namespace #^#PROT_NAMESPACE#$#\n"
+        "{\n\n"
+        "/// @brief Writer of the JSON or compact text representation of the messages\n"
+        "///     into the caller provided buffer.\n"
+        "/// @details Used by the generated message encoders, doesn't allocate any memory\n"
+        "///     and doesn't use streams. The compact text format contains space separated\n"
+        "///     @b name=value pairs without the top level braces.\n"
+        "class JsonWriter\n"
+        "{\n"
+        "public:\n"
+        "    /// @brief Output format.\n"
+        "    enum class Format : std::uint8_t\n"
+        "    {\n"
+        "        Json, ///< JSON object\n"
+        "        Text, ///< Compact text\n"
+        "        NumOfValues ///< Limit for the values\n"
+        "    };\n\n"
+        "    /// @brief Constructor\n"
+        "    JsonWriter(char* buf, std::size_t bufSize, Format format) :\n"
+        "        m_buf(buf),\n"
+        "        m_bufSize(bufSize),\n"
+        "        m_format(format)\n"
+        "    {\n"
+        "    }\n\n"
+        "    /// @brief Number of written characters, 0 when the buffer is too small.\n"
+        "    std::size_t finish() const\n"
+        "    {\n"
+        "        return m_overflow ? 0U : m_len;\n"
+        "    }\n\n"
+        "    /// @brief Write the key (name) of the next value.\n"
+        "    /// @param[in] jsonKey Quoted JSON key including the trailing colon.\n"
+        "    /// @param[in] textKey Text key including the trailing equal sign.\n"
+        "    template <std::size_t TJsonLen, std::size_t TTextLen>\n"
+        "    void key(const char (&jsonKey)[TJsonLen], const char (&textKey)[TTextLen])\n"
+        "    {\n"
+        "        separator();\n"
+        "        if (m_format == Format::Json) {\n"
+        "            writeRaw(jsonKey, TJsonLen - 1U);\n"
+        "            return;\n"
+        "        }\n\n"
+        "        writeRaw(textKey, TTextLen - 1U);\n"
+        "    }\n\n"
+        "    /// @brief Prepare for the next array element.\n"
+        "    void element()\n"
+        "    {\n"
+        "        separator();\n"
+        "    }\n\n"
+        "    /// @brief Open object.\n"
+        "    void beginObject()\n"
+        "    {\n"
+        "        if ((m_format == Format::Json) || (0U < m_depth)) {\n"
+        "            writeChar('{');\n"
+        "        }\n\n"
+        "        ++m_depth;\n"
+        "        m_needSep = false;\n"
+        "    }\n\n"
+        "    /// @brief Close object.\n"
+        "    void endObject()\n"
+        "    {\n"
+        "        --m_depth;\n"
+        "        if ((m_format == Format::Json) || (0U < m_depth)) {\n"
+        "            writeChar('}');\n"
+        "        }\n\n"
+        "        m_needSep = true;\n"
+        "    }\n\n"
+        "    /// @brief Open array.\n"
+        "    void beginArray()\n"
+        "    {\n"
+        "        writeChar('[');\n"
+        "        ++m_depth;\n"
+        "        m_needSep = false;\n"
+        "    }\n\n"
+        "    /// @brief Close array.\n"
+        "    void endArray()\n"
+        "    {\n"
+        "        --m_depth;\n"
+        "        writeChar(']');\n"
+        "        m_needSep = true;\n"
+        "    }\n\n"
+        "    /// @brief Write @b null value.\n"
+        "    void writeNull()\n"
+        "    {\n"
+        "        writeRaw(\"null\", 4U);\n"
+        "        m_needSep = true;\n"
+        "    }\n\n"
+        "    /// @brief Write integral value.\n"
+        "    template <typename T>\n"
+        "    void writeInt(T value)\n"
+        "    {\n"
+        "        writeIntInternal(value, typename std::is_signed<T>::type());\n"
+        "        m_needSep = true;\n"
+        "    }\n\n"
+        "    /// @brief Write enum value.\n"
+        "    /// @details Written as the name when it is known, as the number otherwise.\n"
+        "    template <typename T>\n"
+        "    void writeEnum(T value, const char* name)\n"
+        "    {\n"
+        "        if (name == nullptr) {\n"
+        "            writeInt(static_cast<typename std::underlying_type<T>::type>(value));\n"
+        "            return;\n"
+        "        }\n\n"
+        "        if (m_format == Format::Json) {\n"
+        "            writeChar('\\\"');\n"
+        "        }\n\n"
+        "        writeRaw(name, std::strlen(name));\n\n"
+        "        if (m_format == Format::Json) {\n"
+        "            writeChar('\\\"');\n"
+        "        }\n\n"
+        "        m_needSep = true;\n"
+        "    }\n\n"
+        "    /// @brief Write floating point value, @b null for NaN and infinity.\n"
+        "    /// @details Always uses @b '.' as a decimal separator regardless of the current C locale.\n"
+        "    void writeFloat(double value)\n"
+        "    {\n"
+        "        if (!std::isfinite(value)) {\n"
+        "            writeNull();\n"
+        "            return;\n"
+        "        }\n\n"
+        "        char str[32] = {0};\n"
+        "        auto len = static_cast<std::size_t>(std::snprintf(str, sizeof(str), \"%.17g\", value));\n"
+        "        auto* point = std::localeconv()->decimal_point;\n"
+        "        auto pointLen = std::strlen(point);\n"
+        "        auto* pointPos = (pointLen == 0U) ? nullptr : std::strstr(str, point);\n"
+        "        if ((pointPos != nullptr) && ((pointLen != 1U) || (*point != '.'))) {\n"
+        "            *pointPos = '.';\n"
+        "            std::memmove(pointPos + 1, pointPos + pointLen, static_cast<std::size_t>(&str[len] - (pointPos + pointLen)) + 1U);\n"
+        "            len -= (pointLen - 1U);\n"
+        "        }\n\n"
+        "        writeRaw(str, len);\n"
+        "        m_needSep = true;\n"
+        "    }\n\n"
+        "    /// @brief Write quoted and escaped string.\n"
+        "    template <typename TStr>\n"
+        "    void writeString(const TStr& str)\n"
+        "    {\n"
+        "        static const char Hex[] = \"0123456789abcdef\";\n"
+        "        writeChar('\\\"');\n"
+        "        for (auto ch : str) {\n"
+        "            auto byte = static_cast<std::uint8_t>(ch);\n"
+        "            if ((byte == '\\\"') || (byte == '\\\\')) {\n"
+        "                char escaped[] = {'\\\\', static_cast<char>(byte)};\n"
+        "                writeRaw(escaped, sizeof(escaped));\n"
+        "                continue;\n"
+        "            }\n\n"
+        "            if (byte < 0x20) {\n"
+        "                char escaped[] = {'\\\\', 'u', '0', '0', Hex[byte >> 4U], Hex[byte & 0xfU]};\n"
+        "                writeRaw(escaped, sizeof(escaped));\n"
+        "                continue;\n"
+        "            }\n\n"
+        "            writeChar(static_cast<char>(byte));\n"
+        "        }\n"
+        "        writeChar('\\\"');\n"
+        "        m_needSep = true;\n"
+        "    }\n\n"
+        "    /// @brief Write raw data as hexadecimal string.\n"
+        "    template <typename TData>\n"
+        "    void writeHex(const TData& data)\n"
+        "    {\n"
+        "        static const char Hex[] = \"0123456789abcdef\";\n"
+        "        if (m_format == Format::Json) {\n"
+        "            writeChar('\\\"');\n"
+        "        }\n\n"
+        "        for (auto ch : data) {\n"
+        "            auto byte = static_cast<std::uint8_t>(ch);\n"
+        "            char digits[] = {Hex[byte >> 4U], Hex[byte & 0xfU]};\n"
+        "            writeRaw(digits, sizeof(digits));\n"
+        "        }\n\n"
+        "        if (m_format == Format::Json) {\n"
+        "            writeChar('\\\"');\n"
+        "        }\n\n"
+        "        m_needSep = true;\n"
+        "    }\n\n"
+        "private:\n"
+        "    void separator()\n"
+        "    {\n"
+        "        if (m_needSep) {\n"
+        "            writeChar((m_format == Format::Json) ? ',' : ' ');\n"
+        "        }\n\n"
+        "        m_needSep = false;\n"
+        "    }\n\n"
+        "    void writeChar(char ch)\n"
+        "    {\n"
+        "        if (m_bufSize <= m_len) {\n"
+        "            m_overflow = true;\n"
+        "            return;\n"
+        "        }\n\n"
+        "        m_buf[m_len] = ch;\n"
+        "        ++m_len;\n"
+        "    }\n\n"
+        "    void writeRaw(const char* str, std::size_t len)\n"
+        "    {\n"
+        "        if ((m_bufSize - m_len) < len) {\n"
+        "            m_overflow = true;\n"
+        "            return;\n"
+        "        }\n\n"
+        "        std::memcpy(m_buf + m_len, str, len);\n"
+        "        m_len += len;\n"
+        "    }\n\n"
+        "    template <typename T>\n"
+        "    void writeIntInternal(T value, std::true_type)\n"
+        "    {\n"
+        "        if (value < 0) {\n"
+        "            writeChar('-');\n"
+        "            writeUnsignedInternal(0U - static_cast<std::uintmax_t>(value));\n"
+        "            return;\n"
+        "        }\n\n"
+        "        writeUnsignedInternal(static_cast<std::uintmax_t>(value));\n"
+        "    }\n\n"
+        "    template <typename T>\n"
+        "    void writeIntInternal(T value, std::false_type)\n"
+        "    {\n"
+        "        writeUnsignedInternal(static_cast<std::uintmax_t>(value));\n"
+        "    }\n\n"
+        "    void writeUnsignedInternal(std::uintmax_t value)\n"
+        "    {\n"
+        "        char digits[24] = {0};\n"
+        "        auto pos = sizeof(digits);\n"
+        "        do {\n"
+        "            --pos;\n"
+        "            digits[pos] = static_cast<char>('0' + (value % 10U));\n"
+        "            value /= 10U;\n"
+        "        } while (value != 0U);\n\n"
+        "        writeRaw(&digits[pos], sizeof(digits) - pos);\n"
+        "    }\n\n"
+        "    char* m_buf = nullptr;\n"
+        "    std::size_t m_bufSize = 0U;\n"
+        "    std::size_t m_len = 0U;\n"
+        "    unsigned m_depth = 0U;\n"
+        "    Format m_format = Format::Json;\n"
+        "    bool m_needSep = false;\n"
+        "    bool m_overflow = false;\n"
+        "};\n\n"
+        "} // namespace #^#PROT_NAMESPACE#$#\n";
+
+    util::GenReplacementMap repl = {
+        {"GENERATED", CommsGenerator::commsFileGeneratedComment()},
+        {"PROT_NAMESPACE", m_commsGenerator.genCurrentSchema().genMainNamespace()},
+    };
+
+    return m_commsGenerator.genWriteFile(filePath, util::genProcessTemplate(Templ, repl, true));
+}
+
+bool CommsJsonEncoder::commsWriteMessageInternal(const CommsMessage& msg) const
+{
+    auto className = comms::genClassName(msg.genParseObj().parseName()) + "Json";
+    auto filePath = msg.commsSiblingHeaderPath(className);
+
+    m_commsGenerator.genLogger().genInfo("Generating " + filePath);
+
+    auto dirPath = util::genPathUp(filePath);
+    assert(!dirPath.empty());
+    if (!m_commsGenerator.genCreateDirectory(dirPath)) {
+        return false;
+    }
+
+    const std::string Templ =
+        "#^#GENERATED#$#\n"
+        "/// @file\n"
+        "/// @brief Contains JSON and compact text encoder of @ref #^#SCOPE#$# message.\n\n"
+        "#pragma once\n\n"
+        "#^#INCLUDES#$#\n"
+        "#^#NS_BEGIN#$#\n"
+        "/// @brief JSON and compact text encoder of @ref #^#SCOPE#$# message.\n"
+        "struct #^#CLASS_NAME#$#\n"
+        "{\n"
+        "    /// @brief Write JSON representation of the message fields into the provided buffer.\n"
+        "    /// @tparam TMsg Any variant of the @ref #^#SCOPE#$# class.\n"
+        "    /// @return Number of written characters, 0 when the buffer is too small.\n"
+        "    template <typename TMsg>\n"
+        "    static std::size_t writeJson(const TMsg& msg, char* buf, std::size_t bufSize)\n"
+        "    {\n"
+        "        #^#WRITER#$# out(buf, bufSize, #^#WRITER#$#::Format::Json);\n"
+        "        write(msg, out);\n"
+        "        return out.finish();\n"
+        "    }\n\n"
+        "    /// @brief Write compact text representation of the message fields into the provided buffer.\n"
+        "    /// @tparam TMsg Any variant of the @ref #^#SCOPE#$# class.\n"
+        "    /// @return Number of written characters, 0 when the buffer is too small.\n"
+        "    template <typename TMsg>\n"
+        "    static std::size_t writeText(const TMsg& msg, char* buf, std::size_t bufSize)\n"
+        "    {\n"
+        "        #^#WRITER#$# out(buf, bufSize, #^#WRITER#$#::Format::Text);\n"
+        "        write(msg, out);\n"
+        "        return out.finish();\n"
+        "    }\n\n"
+        "    /// @brief Write the message fields using the provided writer.\n"
+        "    template <typename TMsg>\n"
+        "    static void write(const TMsg& msg, #^#WRITER#$#& out)\n"
+        "    {\n"
+        "        #^#BODY#$#\n"
+        "    }\n"
+        "};\n\n"
+        "#^#NS_END#$#\n";
+
+    auto& gen = m_commsGenerator;
+    util::GenStringsList fieldsCode;
+    unsigned varIdx = 0U;
+    for (auto* f : msg.commsFields()) {
+        auto& genField = f->commsGenField();
+        auto accName = comms::genAccessName(genField.genParseObj().parseName());
+        fieldsCode.push_back(commsMemberCodeInternal(genField, "msg.field_" + accName + "()", varIdx));
+    }
+
+    std::string body;
+    if (fieldsCode.empty()) {
+        body =
+            "static_cast<void>(msg);\n"
+            "out.beginObject();\n"
+            "out.endObject();";
+    }
+    else {
+        body =
+            "out.beginObject();\n" +
+            util::genStrListToString(fieldsCode, "\n", "\n") +
+            "out.endObject();";
+    }
+
+    util::GenStringsList includes = {
+        "<cstddef>",
+        "<type_traits>",
+        comms::genRelHeaderForRoot(CommsJsonWriterName, gen),
+    };
+    comms::genPrepareIncludeStatement(includes);
+
+    util::GenReplacementMap repl = {
+        {"GENERATED", CommsGenerator::commsFileGeneratedComment()},
+        {"SCOPE", comms::genScopeFor(msg, gen)},
+        {"INCLUDES", util::genStrListToString(includes, "\n", "\n")},
+        {"NS_BEGIN", comms::genNamespaceBeginFor(msg, gen)},
+        {"NS_END", comms::genNamespaceEndFor(msg, gen)},
+        {"CLASS_NAME", className},
+        {"WRITER", comms::genScopeForRoot(CommsJsonWriterName, gen)},
+        {"BODY", std::move(body)},
+    };
+
+    return gen.genWriteFile(filePath, util::genProcessTemplate(Templ, repl, true));
+}
+
+} // namespace commsdsl2comms
@@ -123,6 +123,20 @@ std::string CommsLayer::commsDefType(const CommsLayer* prevLayer, bool& hasInput
         "using #^#CLASS_NAME#$# =\n"
         "    #^#BASE#$#;\n";
 
+    static const std::string ClassTempl =
+        "#^#MEMBERS#$#\n"
+        "#^#DOC#$#\n"
+        "#^#TEMPL_PARAMS#$#\n"
+        "class #^#CLASS_NAME#$# : public\n"
+        "    #^#BASE#$#\n"
+        "{\n"
+        "    using Base =\n"
+        "        #^#BASE#$#;\n"
+        "public:\n"
+        "    #^#PUBLIC#$#\n"
+        "#^#PRIVATE#$#\n"
+        "};\n";
+
     std::string prevName;
     if (prevLayer != nullptr) {
         prevName = comms::genClassName(prevLayer->commsGenLayer().genParseObj().parseName());
@@ -145,7 +159,27 @@ std::string CommsLayer::commsDefType(const CommsLayer* prevLayer, bool& hasInput
         repl["TEMPL_PARAMS"] = "template <typename TMessage, typename TAllMessages>";
     }
 
-    return util::genProcessTemplate(Templ, repl);
+    auto publicCode = commsDefPublicCodeImpl();
+    if (publicCode.empty()) {
+        return util::genProcessTemplate(Templ, repl);
+    }
+
+    repl["PUBLIC"] = std::move(publicCode);
+    auto privateCode = commsDefPrivateCodeImpl();
+    if (!privateCode.empty()) {
+        static const std::string PrivateTempl =
+            "\n"
+            "private:\n"
+            "    #^#CODE#$#";
+
+        util::GenReplacementMap privateRepl = {
+            {"CODE", std::move(privateCode)},
+        };
+
+        repl["PRIVATE"] = util::genProcessTemplate(PrivateTempl, privateRepl);
+    }
+
+    return util::genProcessTemplate(ClassTempl, repl);
 }
 
 bool CommsLayer::commsIsCustomizable() const
@@ -208,6 +242,17 @@ std::string CommsLayer::commsBareMetalDefaultOptions() const
         );
 }
 
+std::string CommsLayer::commsHighThroughputDefaultOptions() const
+{
+    return
+        commsCustomizationOptionsInternal(
+            &CommsField::commsHighThroughputDefaultOptions,
+            &CommsLayer::commsExtraHighThroughputDefaultOptionsInternal,
+            true,
+            commsCustomFieldHighThroughputOptsImpl()
+        );
+}
+
 std::string CommsLayer::commsMsgFactoryDefaultOptions() const
 {
     return
@@ -260,6 +305,11 @@ CommsLayer::GenStringsList CommsLayer::commsExtraBareMetalDefaultOptionsImpl() c
     return GenStringsList();
 }
 
+CommsLayer::GenStringsList CommsLayer::commsExtraHighThroughputDefaultOptionsImpl() const
+{
+    return GenStringsList();
+}
+
 CommsLayer::GenStringsList CommsLayer::commsExtraMsgFactoryDefaultOptionsImpl() const
 {
     return GenStringsList();
@@ -285,6 +335,11 @@ std::string CommsLayer::commsCustomFieldBareMetalOptsImpl() const
     return std::string();
 }
 
+std::string CommsLayer::commsCustomFieldHighThroughputOptsImpl() const
+{
+    return std::string();
+}
+
 std::string CommsLayer::commsExtraMemberFieldsDefsImpl() const
 {
     return std::string();
@@ -295,6 +350,16 @@ std::string CommsLayer::commsExtraMemberFieldsCommonCodeImpl() const
     return std::string();
 }
 
+std::string CommsLayer::commsDefPublicCodeImpl() const
+{
+    return std::string();
+}
+
+std::string CommsLayer::commsDefPrivateCodeImpl() const
+{
+    return std::string();
+}
+
 std::string CommsLayer::commsDefFieldType() const
 {
     if (m_commsExternalField != nullptr) {
@@ -532,6 +597,11 @@ CommsLayer::GenStringsList CommsLayer::commsExtraBareMetalDefaultOptionsInternal
     return commsExtraBareMetalDefaultOptionsImpl();
 }
 
+CommsLayer::GenStringsList CommsLayer::commsExtraHighThroughputDefaultOptionsInternal() const
+{
+    return commsExtraHighThroughputDefaultOptionsImpl();
+}
+
 CommsLayer::GenStringsList CommsLayer::commsExtraMsgFactoryDefaultOptionsInternal() const
 {
     return commsExtraMsgFactoryDefaultOptionsImpl();
@@ -63,6 +63,7 @@ public:
     std::string commsDefaultOptions() const;
     std::string commsDataViewDefaultOptions() const;
     std::string commsBareMetalDefaultOptions() const;
+    std::string commsHighThroughputDefaultOptions() const;
     std::string commsMsgFactoryDefaultOptions() const;
 
     const GenLayer& commsGenLayer() const
@@ -94,13 +95,17 @@ protected:
     virtual bool commsIsCustomizableImpl() const;
     virtual GenStringsList commsExtraDataViewDefaultOptionsImpl() const;
     virtual GenStringsList commsExtraBareMetalDefaultOptionsImpl() const;
+    virtual GenStringsList commsExtraHighThroughputDefaultOptionsImpl() const;
     virtual GenStringsList commsExtraMsgFactoryDefaultOptionsImpl() const;
     virtual std::string commsCustomDefMembersCodeImpl() const;
     virtual std::string commsCustomFieldOptsImpl() const;
     virtual std::string commsCustomFieldDataViewOptsImpl() const;
     virtual std::string commsCustomFieldBareMetalOptsImpl() const;
+    virtual std::string commsCustomFieldHighThroughputOptsImpl() const;
     virtual std::string commsExtraMemberFieldsDefsImpl() const;
     virtual std::string commsExtraMemberFieldsCommonCodeImpl() const;
+    virtual std::string commsDefPublicCodeImpl() const;
+    virtual std::string commsDefPrivateCodeImpl() const;
 
     std::string commsDefFieldType() const;
     std::string commsDefExtraOpts() const;
@@ -120,6 +125,7 @@ private:
 
     GenStringsList commsExtraDataViewDefaultOptionsInternal() const;
     GenStringsList commsExtraBareMetalDefaultOptionsInternal() const;
+    GenStringsList commsExtraHighThroughputDefaultOptionsInternal() const;
     GenStringsList commsExtraMsgFactoryDefaultOptionsInternal() const;
 
     GenLayer& m_genLayer;
@@ -185,6 +185,13 @@ CommsListField::CommsIncludesList CommsListField::commsDefIncludesImpl() const
     if (!obj.parseDetachedElemLengthPrefixFieldName().empty()) {
         result.push_back("comms/Assert.h");
     }
+
+    if (commsIsBulkInternal()) {
+        result.insert(result.end(), {
+            "<type_traits>",
+            "<vector>"
+        });
+    }
     return result;
 }
 
@@ -452,6 +459,225 @@ std::string CommsListField::commsDefBundledRefreshFuncBodyImpl(const CommsFields
     return util::genProcessTemplate(Templ, finalRepl);
 }
 
+std::string CommsListField::commsDefPrivateCodeImpl() const
+{
+    if (!commsIsBulkInternal()) {
+        return strings::genEmptyString();
+    }
+
+    static const std::string Templ =
+        "using BulkElement = typename Base::ValueType::value_type;\n\n"
+        "// The options may change the storage type or disable read / write\n"
+        "// of the elements without status, use the default implementation in such case.\n"
+        "using BulkReadTag =\n"
+        "    std::integral_constant<\n"
+        "        bool,\n"
+        "        std::is_same<typename Base::ValueType, std::vector<BulkElement> >::value &&\n"
+        "        (BulkElement::minLength() == BulkElement::maxLength()) &&\n"
+        "        (0U < BulkElement::minLength()) &&\n"
+        "        BulkElement::hasReadNoStatus()\n"
+        "    >;\n\n"
+        "template <typename TIter>\n"
+        "comms::ErrorStatus readBulkInternal(TIter& iter, std::size_t len, std::true_type)\n"
+        "{\n"
+        "    #^#READ_PREFIX#$#\n"
+        "    if ((len / BulkElement::minLength()) < count) {\n"
+        "        return comms::ErrorStatus::NotEnoughData;\n"
+        "    }\n\n"
+        "    auto& elems = Base::value();\n"
+        "    elems.resize(count);\n"
+        "    for (auto& elem : elems) {\n"
+        "        elem.readNoStatus(iter);\n"
+        "    }\n"
+        "    return comms::ErrorStatus::Success;\n"
+        "}\n\n"
+        "template <typename TIter>\n"
+        "comms::ErrorStatus readBulkInternal(TIter& iter, std::size_t len, std::false_type)\n"
+        "{\n"
+        "    return Base::read(iter, len);\n"
+        "}\n"
+        "#^#WRITE#$#\n"
+        ;
+
+    static const std::string WriteTempl =
+        "\n"
+        "using BulkWriteTag =\n"
+        "    std::integral_constant<\n"
+        "        bool,\n"
+        "        std::is_same<typename Base::ValueType, std::vector<BulkElement> >::value &&\n"
+        "        (BulkElement::minLength() == BulkElement::maxLength()) &&\n"
+        "        (0U < BulkElement::minLength()) &&\n"
+        "        BulkElement::hasWriteNoStatus()\n"
+        "    >;\n\n"
+        "template <typename TIter>\n"
+        "comms::ErrorStatus writeBulkInternal(TIter& iter, std::size_t len, std::true_type) const\n"
+        "{\n"
+        "    if (len < Base::length()) {\n"
+        "        return comms::ErrorStatus::BufferOverflow;\n"
+        "    }\n\n"
+        "    #^#WRITE_PREFIX#$#\n"
+        "    for (auto& elem : Base::value()) {\n"
+        "        elem.writeNoStatus(iter);\n"
+        "    }\n"
+        "    return comms::ErrorStatus::Success;\n"
+        "}\n\n"
+        "template <typename TIter>\n"
+        "comms::ErrorStatus writeBulkInternal(TIter& iter, std::size_t len, std::false_type) const\n"
+        "{\n"
+        "    return Base::write(iter, len);\n"
+        "}";
+
+    util::GenReplacementMap repl = {
+        {"READ_PREFIX", commsDefBulkReadPrefixInternal()},
+    };
+
+    if (commsIsBulkWriteInternal()) {
+        util::GenReplacementMap writeRepl = {
+            {"WRITE_PREFIX", commsDefBulkWritePrefixInternal()},
+        };
+
+        repl["WRITE"] = util::genProcessTemplate(WriteTempl, writeRepl);
+    }
+
+    return util::genProcessTemplate(Templ, repl);
+}
+
+std::string CommsListField::commsDefReadFuncBodyImpl() const
+{
+    if (!commsIsBulkInternal()) {
+        return strings::genEmptyString();
+    }
+
+    return "return readBulkInternal(iter, len, BulkReadTag());";
+}
+
+std::string CommsListField::commsDefWriteFuncBodyImpl() const
+{
+    if (!commsIsBulkWriteInternal()) {
+        return strings::genEmptyString();
+    }
+
+    return "return writeBulkInternal(iter, len, BulkWriteTag());";
+}
+
+std::string CommsListField::commsDefSkipFuncBodyImpl() const
+{
+    auto obj = genListFieldParseObj();
+    if ((m_commsExternalElemLengthPrefixField != nullptr) ||
+        (m_commsMemberElemLengthPrefixField != nullptr) ||
+        (m_commsExternalTermSuffixField != nullptr) ||
+        (m_commsMemberTermSuffixField != nullptr) ||
+        (!obj.parseDetachedCountPrefixFieldName().empty()) ||
+        (!obj.parseDetachedLengthPrefixFieldName().empty()) ||
+        (!obj.parseDetachedElemLengthPrefixFieldName().empty()) ||
+        (!obj.parseDetachedTermSuffixFieldName().empty())) {
+        return strings::genEmptyString();
+    }
+
+    static const std::string PrefixReadTempl =
+        "#^#PREFIX_TYPE#$# prefix;\n"
+        "auto iter = buf;\n"
+        "auto es = prefix.read(iter, len);\n"
+        "if (es != comms::ErrorStatus::Success) {\n"
+        "    return es;\n"
+        "}\n\n"
+        "auto prefixLen = static_cast<std::size_t>(iter - buf);\n";
+
+    if ((m_commsMemberLengthPrefixField != nullptr) || (m_commsExternalLengthPrefixField != nullptr)) {
+        static const std::string Templ =
+            "#^#PREFIX_READ#$#\n"
+            "auto serLen = static_cast<std::size_t>(prefix.getValue());\n"
+            "if ((len - prefixLen) < serLen) {\n"
+            "    return comms::ErrorStatus::NotEnoughData;\n"
+            "}\n\n"
+            "consumed = prefixLen + serLen;\n"
+            "return comms::ErrorStatus::Success;";
+
+        util::GenReplacementMap prefixRepl = {
+            {"PREFIX_TYPE", commsPrefixTypeInternal(m_commsMemberLengthPrefixField, m_commsExternalLengthPrefixField)},
+        };
+
+        util::GenReplacementMap repl = {
+            {"PREFIX_READ", util::genProcessTemplate(PrefixReadTempl, prefixRepl)},
+        };
+
+        return util::genProcessTemplate(Templ, repl);
+    }
+
+    std::string countStr;
+    auto fixedCount = obj.parseFixedCount();
+    if (fixedCount != 0U) {
+        countStr =
+            "static const std::size_t prefixLen = 0U;\n"
+            "static const std::size_t count = " + util::genNumToString(static_cast<std::uintmax_t>(fixedCount)) + "U;\n";
+    }
+    else if ((m_commsMemberCountPrefixField != nullptr) || (m_commsExternalCountPrefixField != nullptr)) {
+        util::GenReplacementMap prefixRepl = {
+            {"PREFIX_TYPE", commsPrefixTypeInternal(m_commsMemberCountPrefixField, m_commsExternalCountPrefixField)},
+        };
+
+        countStr =
+            util::genProcessTemplate(PrefixReadTempl, prefixRepl) +
+            "auto count = static_cast<std::size_t>(prefix.getValue());\n";
+    }
+    else {
+        // The list consumes all the remaining data
+        return
+            "static_cast<void>(buf);\n"
+            "consumed = len;\n"
+            "return comms::ErrorStatus::Success;";
+    }
+
+    auto* elemField = m_commsMemberElementField;
+    if (elemField == nullptr) {
+        elemField = m_commsExternalElementField;
+    }
+
+    assert(elemField != nullptr);
+    if (elemField->commsHasFixedLayout() && (elemField->commsMinLength() != 0U)) {
+        static const std::string Templ =
+            "using Element = typename Base::ValueType::value_type;\n"
+            "#^#COUNT#$#\n"
+            "#^#UNUSED#$#\n"
+            "if (((len - prefixLen) / Element::minLength()) < count) {\n"
+            "    return comms::ErrorStatus::NotEnoughData;\n"
+            "}\n\n"
+            "consumed = prefixLen + (count * Element::minLength());\n"
+            "return comms::ErrorStatus::Success;";
+
+        util::GenReplacementMap repl = {
+            {"COUNT", std::move(countStr)},
+        };
+
+        if (fixedCount != 0U) {
+            repl["UNUSED"] = "static_cast<void>(buf);";
+        }
+
+        return util::genProcessTemplate(Templ, repl);
+    }
+
+    static const std::string Templ =
+        "using Element = typename Base::ValueType::value_type;\n"
+        "#^#COUNT#$#\n"
+        "auto total = prefixLen;\n"
+        "for (std::size_t idx = 0U; idx < count; ++idx) {\n"
+        "    std::size_t elemLen = 0U;\n"
+        "    auto elemEs = Element::skip(buf + total, len - total, elemLen);\n"
+        "    if (elemEs != comms::ErrorStatus::Success) {\n"
+        "        return elemEs;\n"
+        "    }\n\n"
+        "    total += elemLen;\n"
+        "}\n\n"
+        "consumed = total;\n"
+        "return comms::ErrorStatus::Success;";
+
+    util::GenReplacementMap repl = {
+        {"COUNT", std::move(countStr)},
+    };
+
+    return util::genProcessTemplate(Templ, repl);
+}
+
 bool CommsListField::commsIsLimitedCustomizableImpl() const
 {
     return true;
@@ -535,6 +761,21 @@ CommsListField::GenStringsList CommsListField::commsExtraBareMetalDefaultOptions
         };
 }
 
+CommsListField::GenStringsList CommsListField::commsExtraHighThroughputDefaultOptionsImpl() const
+{
+    // Use fixed storage only when the schema defines its size,
+    // the arbitrary limit may truncate valid input.
+    auto obj = genListFieldParseObj();
+    if (obj.parseFixedCount() == 0U) {
+        return CommsBase::commsExtraHighThroughputDefaultOptionsImpl();
+    }
+
+    return
+        GenStringsList{
+            "comms::option::app::SequenceFixedSizeUseFixedSizeStorage"
+        };
+}
+
 std::size_t CommsListField::commsMaxLengthImpl() const
 {
     auto obj = genListFieldParseObj();
@@ -563,6 +804,14 @@ std::string CommsListField::commsDefFieldOptsInternal() const
     commsAddTermSuffixOptInternal(opts);
     commsAddLengthForcingOptInternal(opts);
 
+    if (commsIsBulkInternal()) {
+        util::genAddToStrList("comms::option::def::HasCustomRead", opts);
+    }
+
+    if (commsIsBulkWriteInternal()) {
+        util::genAddToStrList("comms::option::def::HasCustomWrite", opts);
+    }
+
     return util::genStrListToString(opts, ",\n", "");
 }
 
@@ -605,19 +854,9 @@ void CommsListField::commsAddCountPrefixOptInternal(GenStringsList& opts) const
         return;
     }
 
-    std::string prefixName;
-    if (m_commsMemberCountPrefixField != nullptr) {
-        prefixName = "typename " + comms::genClassName(genName()) + strings::genMembersSuffixStr();
-        if (comms::genIsGlobalField(*this)) {
-            prefixName += "<TOpt>";
-        }
-
-        prefixName += "::" + comms::genClassName(m_commsMemberCountPrefixField->commsGenField().genName());
-    }
-    else {
-        assert(m_commsExternalCountPrefixField != nullptr);
-        prefixName = comms::genScopeFor(m_commsExternalCountPrefixField->commsGenField(), genGenerator(), true, true);
-        prefixName += "<TOpt> ";
+    auto prefixName = commsPrefixTypeInternal(m_commsMemberCountPrefixField, m_commsExternalCountPrefixField);
+    if (m_commsMemberCountPrefixField == nullptr) {
+        prefixName += ' ';
     }
 
     opts.push_back("comms::option::def::SequenceSizeFieldPrefix<" + prefixName + '>');
@@ -629,19 +868,9 @@ void CommsListField::commsAddLengthPrefixOptInternal(GenStringsList& opts) const
         return;
     }
 
-    std::string prefixName;
-    if (m_commsMemberLengthPrefixField != nullptr) {
-        prefixName = "typename " + comms::genClassName(genName()) + strings::genMembersSuffixStr();
-        if (comms::genIsGlobalField(*this)) {
-            prefixName += "<TOpt>";
-        }
-
-        prefixName += "::" + comms::genClassName(m_commsMemberLengthPrefixField->commsGenField().genName());
-    }
-    else {
-        assert(m_commsExternalLengthPrefixField != nullptr);
-        prefixName = comms::genScopeFor(m_commsExternalLengthPrefixField->commsGenField(), genGenerator(), true, true);
-        prefixName += "<TOpt> ";
+    auto prefixName = commsPrefixTypeInternal(m_commsMemberLengthPrefixField, m_commsExternalLengthPrefixField);
+    if (m_commsMemberLengthPrefixField == nullptr) {
+        prefixName += ' ';
     }
 
     opts.push_back("comms::option::def::SequenceSerLengthFieldPrefix<" + prefixName + '>');
@@ -716,4 +945,142 @@ void CommsListField::commsAddLengthForcingOptInternal(GenStringsList& opts) cons
     }
 }
 
+std::string CommsListField::commsPrefixTypeInternal(const CommsField* memberField, const CommsField* externalField) const
+{
+    if (memberField != nullptr) {
+        auto prefixName = "typename " + comms::genClassName(genName()) + strings::genMembersSuffixStr();
+        if (comms::genIsGlobalField(*this)) {
+            prefixName += "<TOpt>";
+        }
+
+        prefixName += "::" + comms::genClassName(memberField->commsGenField().genName());
+        return prefixName;
+    }
+
+    assert(externalField != nullptr);
+    return comms::genScopeFor(externalField->commsGenField(), genGenerator(), true, true) + "<TOpt>";
+}
+
+bool CommsListField::commsIsBulkInternal() const
+{
+    if (!CommsGenerator::commsCast(genGenerator()).commsGetBulkLists()) {
+        return false;
+    }
+
+    // The run of elements with fixed length is processed in one go,
+    // the lists requiring per element processing are excluded.
+    auto* elemField = m_commsMemberElementField;
+    if (elemField == nullptr) {
+        elemField = m_commsExternalElementField;
+    }
+
+    if ((elemField == nullptr) ||
+        (!elemField->commsHasFixedLayout()) ||
+        (elemField->commsMinLength() == 0U) ||
+        (m_commsExternalElemLengthPrefixField != nullptr) ||
+        (m_commsMemberElemLengthPrefixField != nullptr) ||
+        (m_commsExternalTermSuffixField != nullptr) ||
+        (m_commsMemberTermSuffixField != nullptr) ||
+        commsIsFailOnInvalid()) {
+        return false;
+    }
+
+    auto obj = genListFieldParseObj();
+    return
+        obj.parseDetachedCountPrefixFieldName().empty() &&
+        obj.parseDetachedLengthPrefixFieldName().empty() &&
+        obj.parseDetachedElemLengthPrefixFieldName().empty();
+}
+
+bool CommsListField::commsIsBulkWriteInternal() const
+{
+    // The fixed size lists may require padding, use the default write
+    return commsIsBulkInternal() && (genListFieldParseObj().parseFixedCount() == 0U);
+}
+
+std::string CommsListField::commsDefBulkReadPrefixInternal() const
+{
+    auto fixedCount = genListFieldParseObj().parseFixedCount();
+    if (fixedCount != 0U) {
+        return "std::size_t count = " + util::genNumToString(static_cast<std::uintmax_t>(fixedCount)) + "U;\n";
+    }
+
+    static const std::string PrefixReadTempl =
+        "#^#PREFIX_TYPE#$# prefix;\n"
+        "auto es = prefix.read(iter, len);\n"
+        "if (es != comms::ErrorStatus::Success) {\n"
+        "    return es;\n"
+        "}\n\n"
+        "len -= prefix.length();\n";
+
+    if ((m_commsMemberCountPrefixField != nullptr) || (m_commsExternalCountPrefixField != nullptr)) {
+        util::GenReplacementMap repl = {
+            {"PREFIX_TYPE", commsPrefixTypeInternal(m_commsMemberCountPrefixField, m_commsExternalCountPrefixField)},
+        };
+
+        return
+            util::genProcessTemplate(PrefixReadTempl, repl) +
+            "auto count = static_cast<std::size_t>(prefix.getValue());\n";
+    }
+
+    if ((m_commsMemberLengthPrefixField != nullptr) || (m_commsExternalLengthPrefixField != nullptr)) {
+        static const std::string Templ =
+            "#^#PREFIX_READ#$#\n"
+            "// Report the same error as the default implementation\n"
+            "auto serLen = static_cast<std::size_t>(prefix.getValue());\n"
+            "if ((len < serLen) || ((serLen % BulkElement::minLength()) != 0U)) {\n"
+            "    return comms::ErrorStatus::InvalidMsgData;\n"
+            "}\n\n"
+            "len = serLen;\n"
+            "auto count = serLen / BulkElement::minLength();\n";
+
+        util::GenReplacementMap prefixRepl = {
+            {"PREFIX_TYPE", commsPrefixTypeInternal(m_commsMemberLengthPrefixField, m_commsExternalLengthPrefixField)},
+        };
+
+        util::GenReplacementMap repl = {
+            {"PREFIX_READ", util::genProcessTemplate(PrefixReadTempl, prefixRepl)},
+        };
+
+        return util::genProcessTemplate(Templ, repl);
+    }
+
+    return
+        "if ((len % BulkElement::minLength()) != 0U) {\n"
+        "    return comms::ErrorStatus::NotEnoughData;\n"
+        "}\n\n"
+        "auto count = len / BulkElement::minLength();\n";
+}
+
+std::string CommsListField::commsDefBulkWritePrefixInternal() const
+{
+    static const std::string Templ =
+        "#^#PREFIX_TYPE#$# prefix;\n"
+        "prefix.setValue(#^#VALUE#$#);\n"
+        "auto es = prefix.write(iter, len);\n"
+        "if (es != comms::ErrorStatus::Success) {\n"
+        "    return es;\n"
+        "}\n";
+
+    if ((m_commsMemberCountPrefixField != nullptr) || (m_commsExternalCountPrefixField != nullptr)) {
+        util::GenReplacementMap repl = {
+            {"PREFIX_TYPE", commsPrefixTypeInternal(m_commsMemberCountPrefixField, m_commsExternalCountPrefixField)},
+            {"VALUE", "Base::value().size()"},
+        };
+
+        return util::genProcessTemplate(Templ, repl);
+    }
+
+    if ((m_commsMemberLengthPrefixField != nullptr) || (m_commsExternalLengthPrefixField != nullptr)) {
+        util::GenReplacementMap repl = {
+            {"PREFIX_TYPE", commsPrefixTypeInternal(m_commsMemberLengthPrefixField, m_commsExternalLengthPrefixField)},
+            {"VALUE", "Base::value().size() * BulkElement::minLength()"},
+        };
+
+        return util::genProcessTemplate(Templ, repl);
+    }
+
+    return strings::genEmptyString();
+}
+
 } // namespace commsdsl2comms
@@ -49,10 +49,15 @@ protected:
     virtual std::string commsDefBaseClassImpl() const override;
     virtual std::string commsDefBundledReadPrepareFuncBodyImpl(const CommsFieldsList& siblings) const override;
     virtual std::string commsDefBundledRefreshFuncBodyImpl(const CommsFieldsList& siblings) const override;
+    virtual std::string commsDefPrivateCodeImpl() const override;
+    virtual std::string commsDefReadFuncBodyImpl() const override;
+    virtual std::string commsDefWriteFuncBodyImpl() const override;
+    virtual std::string commsDefSkipFuncBodyImpl() const override;
     virtual bool commsIsLimitedCustomizableImpl() const override;
     virtual bool commsIsVersionDependentImpl() const override;
     virtual std::string commsMembersCustomizationOptionsBodyImpl(CommsFieldOptsFunc fieldOptsFunc) const override;
     virtual GenStringsList commsExtraBareMetalDefaultOptionsImpl() const override;
+    virtual GenStringsList commsExtraHighThroughputDefaultOptionsImpl() const override;
     virtual std::size_t commsMaxLengthImpl() const override;
     virtual std::string commsSizeAccessStrImpl(const std::string& accStr, const std::string& prefix) const override;
 
@@ -66,6 +71,11 @@ private:
     void commsAddElemLengthPrefixOptInternal(GenStringsList& opts) const;
     void commsAddTermSuffixOptInternal(GenStringsList& opts) const;
     void commsAddLengthForcingOptInternal(GenStringsList& opts) const;
+    std::string commsPrefixTypeInternal(const CommsField* memberField, const CommsField* externalField) const;
+    bool commsIsBulkInternal() const;
+    bool commsIsBulkWriteInternal() const;
+    std::string commsDefBulkReadPrefixInternal() const;
+    std::string commsDefBulkWritePrefixInternal() const;
 
     CommsField* m_commsExternalElementField = nullptr;
     CommsField* m_commsMemberElementField = nullptr;
@@ -18,7 +18,9 @@
 
 #include "CommsField.h"
 #include "CommsGenerator.h"
+#include "CommsJsonEncoder.h"
 #include "CommsOptionalField.h"
+#include "CommsReflection.h"
 #include "CommsSchema.h"
 
 #include "commsdsl/gen/comms.h"
@@ -27,7 +29,6 @@
 
 #include <algorithm>
 #include <cassert>
-#include <fstream>
 #include <iterator>
 #include <numeric>
 #include <utility>
@@ -227,6 +228,30 @@ std::string CommsMessage::commsBareMetalDefaultOptions() const
     return commsCustomizationOptionsInternal(&CommsField::commsBareMetalDefaultOptions, nullptr, true);
 }
 
+std::string CommsMessage::commsHighThroughputDefaultOptions() const
+{
+    return commsCustomizationOptionsInternal(&CommsField::commsHighThroughputDefaultOptions, nullptr, true);
+}
+
+std::size_t CommsMessage::commsMinLength() const
+{
+    // The custom length calculation may report any value
+    if (m_customCode.m_hasLength || commsHasCustomFieldsLengthInternal()) {
+        return 0U;
+    }
+
+    return commsFieldsLengthInternal(&CommsField::commsMinLength);
+}
+
+std::size_t CommsMessage::commsMaxLength() const
+{
+    if (m_customCode.m_hasLength || commsHasCustomFieldsLengthInternal()) {
+        return comms::genMaxPossibleLength();
+    }
+
+    return commsFieldsLengthInternal(&CommsField::commsMaxLength);
+}
+
 bool CommsMessage::genPrepareImpl()
 {
     if (!GenBase::genPrepareImpl()) {
@@ -281,6 +306,7 @@ bool CommsMessage::genPrepareImpl()
     }
 
     commsPrepareConstructCodeInternal();
+    commsPreparePresenceGroupsInternal();
     return true;
 }
 
@@ -288,7 +314,9 @@ bool CommsMessage::genWriteImpl() const
 {
     return
         commsWriteCommonInternal() &&
-        commsWriteDefInternal();
+        commsWriteDefInternal() &&
+        CommsReflection::commsWriteMessage(CommsGenerator::commsCast(genGenerator()), *this) &&
+        CommsJsonEncoder::commsWriteMessage(CommsGenerator::commsCast(genGenerator()), *this);
 }
 
 bool CommsMessage::commsCopyCodeFromInternal()
@@ -584,12 +612,6 @@ bool CommsMessage::commsWriteCommonInternal() const
         return false;
     }
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        logger.genError("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
-
     static const std::string Templ =
         "#^#GENERATED#$#\n"
         "/// @file\n"
@@ -619,9 +641,7 @@ bool CommsMessage::commsWriteCommonInternal() const
         {"BODY", commsCommonBodyInternal()},
     };
 
-    stream << util::genProcessTemplate(Templ, repl, true);
-    stream.flush();
-    return stream.good();
+    return gen.genWriteFile(filePath, util::genProcessTemplate(Templ, repl, true));
 }
 
 bool CommsMessage::commsWriteDefInternal() const
@@ -633,15 +653,7 @@ bool CommsMessage::commsWriteDefInternal() const
             auto& logger = gen.genLogger();
             logger.genInfo("Generating " + filePath);
 
-            std::ofstream stream(filePath);
-            if (!stream) {
-                logger.genError("Failed to open \"" + filePath + "\" for writing.");
-                return false;
-            }
-
-            stream << content;
-            stream.flush();
-            return stream.good();
+            return gen.genWriteFile(filePath, content);
         };
 
     auto genFilePath = comms::genHeaderPathFor(*this, gen);
@@ -742,14 +754,25 @@ std::string CommsMessage::commsCommonIncludesInternal() const
         includes.reserve(includes.size() + fIncludes.size());
         std::move(fIncludes.begin(), fIncludes.end(), std::back_inserter(includes));
     }
+
+    if (CommsGenerator::commsCast(genGenerator()).commsGetLengthBounds()) {
+        includes.push_back("<cstddef>");
+        if (commsMaxLength() == comms::genMaxPossibleLength()) {
+            includes.push_back("<limits>");
+        }
+    }
+
     comms::genPrepareIncludeStatement(includes);
     return util::genStrListToString(includes, "\n", "\n");
 }
 
 std::string CommsMessage::commsCommonBodyInternal() const
 {
-    // Body contains only name for now
-    return commsCommonNameFuncInternal();
+    if (!CommsGenerator::commsCast(genGenerator()).commsGetLengthBounds()) {
+        return commsCommonNameFuncInternal();
+    }
+
+    return commsCommonNameFuncInternal() + '\n' + commsCommonLengthFuncsInternal();
 }
 
 std::string CommsMessage::commsCommonNameFuncInternal() const
@@ -769,6 +792,57 @@ std::string CommsMessage::commsCommonNameFuncInternal() const
     return util::genProcessTemplate(Templ, repl);
 }
 
+std::string CommsMessage::commsCommonLengthFuncsInternal() const
+{
+    static const std::string Templ =
+        "/// @brief Minimal serialization length of the @ref #^#SCOPE#$# message payload.\n"
+        "static constexpr std::size_t minLength()\n"
+        "{\n"
+        "    return #^#MIN_LEN#$#;\n"
+        "}\n\n"
+        "/// @brief Maximal serialization length of the @ref #^#SCOPE#$# message payload.\n"
+        "/// @details Reports @b std::numeric_limits<std::size_t>::max() for the unbounded length.\n"
+        "static constexpr std::size_t maxLength()\n"
+        "{\n"
+        "    return #^#MAX_LEN#$#;\n"
+        "}\n";
+
+    auto maxLength = commsMaxLength();
+    util::GenReplacementMap repl = {
+        {"SCOPE", comms::genScopeFor(*this, genGenerator())},
+        {"MIN_LEN", util::genNumToString(commsMinLength()) + 'U'},
+        {"MAX_LEN", util::genNumToString(maxLength) + 'U'},
+    };
+
+    if (maxLength == comms::genMaxPossibleLength()) {
+        repl["MAX_LEN"] = "std::numeric_limits<std::size_t>::max()";
+    }
+
+    return util::genProcessTemplate(Templ, repl);
+}
+
+bool CommsMessage::commsHasCustomFieldsLengthInternal() const
+{
+    return
+        std::any_of(
+            m_commsFields.begin(), m_commsFields.end(),
+            [](auto* f)
+            {
+                return f->commsHasCustomLength();
+            });
+}
+
+std::size_t CommsMessage::commsFieldsLengthInternal(CommsLengthFunc func) const
+{
+    return
+        std::accumulate(
+            m_commsFields.begin(), m_commsFields.end(), std::size_t(0),
+            [func](std::size_t soFar, auto* f)
+            {
+                return comms::genAddLength(soFar, (f->*func)());
+            });
+}
+
 std::string CommsMessage::commsCommonFieldsCodeInternal() const
 {
     static const std::string Templ =
@@ -821,6 +895,32 @@ std::string CommsMessage::commsDefIncludesInternal() const
         includes.reserve(includes.size() + fIncludes.size());
         std::move(fIncludes.begin(), fIncludes.end(), std::back_inserter(includes));
     }
+
+    if (commsHasFixedLayoutReadWriteInternal()) {
+        includes.push_back("<type_traits>");
+    }
+
+    if (commsHasFixedOffsetFuncsInternal()) {
+        util::genAddToStrList("<cstdint>", includes);
+    }
+
+    if (std::any_of(m_presenceGroups.begin(), m_presenceGroups.end(), [](std::size_t count) { return count > 0U; })) {
+        util::genAddToStrList("<cstdint>", includes);
+    }
+
+    if (CommsGenerator::commsCast(genGenerator()).commsGetSkipFunctions()) {
+        util::genAddToStrList("<cstddef>", includes);
+        util::genAddToStrList("<cstdint>", includes);
+    }
+
+    if (commsIsLazyInternal()) {
+        util::genAddToStrList("<algorithm>", includes);
+        util::genAddToStrList("<bitset>", includes);
+        util::genAddToStrList("<cstddef>", includes);
+        util::genAddToStrList("<cstdint>", includes);
+        util::genAddToStrList("<type_traits>", includes);
+    }
+
     comms::genPrepareIncludeStatement(includes);
     return util::genStrListToString(includes, "\n", "\n");
 }
@@ -967,7 +1067,7 @@ std::string CommsMessage::commsDefExtraOptionsInternal() const
                 return !code.empty();
             });
 
-    if (m_customCode.m_hasRefresh || hasGeneratedRefresh) {
+    if (m_customCode.m_hasRefresh || hasGeneratedRefresh || commsIsLazyInternal()) {
         util::genAddToStrList("comms::option::def::HasCustomRefresh", opts);
     }
 
@@ -994,6 +1094,8 @@ std::string CommsMessage::commsDefPublicInternal() const
         "    #^#LENGTH#$#\n"
         "    #^#VALID#$#\n"
         "    #^#REFRESH#$#\n"
+        "    #^#PEEK#$#\n"
+        "    #^#SKIP#$#\n"
     ;
 
     auto inputCodePrefix = comms::genInputCodeAbsPathFor(*this, genGenerator());
@@ -1005,12 +1107,19 @@ std::string CommsMessage::commsDefPublicInternal() const
         {"EXTRA", m_customCode.m_public},
         {"NAME", commsDefNameFuncInternal()},
         {"READ", commsDefReadFuncInternal()},
-        {"WRITE", m_customCode.m_write},
+        {"WRITE", commsDefWriteFuncInternal()},
         {"LENGTH", m_customCode.m_length},
         {"VALID", commsDefValidFuncInternal()},
         {"REFRESH", commsDefRefreshFuncInternal()},
+        {"PEEK", commsDefFixedOffsetFuncsInternal()},
+        {"SKIP", commsDefSkipFuncInternal()},
     };
 
+    if (commsIsLazyInternal()) {
+        repl["ACCESS"] = commsDefLazyAccessInternal();
+        repl["READ"] = commsDefLazyFuncsInternal();
+    }
+
     return util::genProcessTemplate(Templ, repl);
 }
 
@@ -1036,11 +1145,28 @@ std::string CommsMessage::commsDefPrivateInternal() const
 {
     assert(m_bundledReadPrepareCodes.size() == m_commsFields.size());
     assert(m_bundledRefreshCodes.size() == m_commsFields.size());
+    assert(m_presenceGroups.size() == m_commsFields.size());
     util::GenStringsList reads;
     util::GenStringsList refreshes;
+    std::size_t groupStart = 0U;
+    std::size_t groupEnd = 0U;
     for (auto idx = 0U; idx < m_commsFields.size(); ++idx) {
+        if (m_presenceGroups[idx] > 0U) {
+            groupStart = idx;
+            groupEnd = idx + m_presenceGroups[idx];
+        }
+
         auto& readCode = m_bundledReadPrepareCodes[idx];
-        auto& refreshCode = m_bundledRefreshCodes[idx];
+        auto refreshCode = m_bundledRefreshCodes[idx];
+
+        if (idx < groupEnd) {
+            // The members of the presence group are refreshed using the group's presence mask
+            auto* optField = static_cast<const CommsOptionalField*>(&m_commsFields[idx]->commsGenField());
+            auto firstAccName = comms::genAccessName(m_commsFields[groupStart]->commsGenField().genParseObj().parseName());
+            refreshCode =
+                "return updatePresenceInternal(" + optField->commsPresenceFieldAccess() +
+                ", (presence_" + firstAccName + "() & (1U << " + std::to_string(idx - groupStart) + ")) != 0U);";
+        }
 
         if (readCode.empty() && refreshCode.empty()) {
             continue;
@@ -1082,7 +1208,13 @@ std::string CommsMessage::commsDefPrivateInternal() const
     bool hasPrivateConstruct =
         (!m_internalConstruct.empty()) && (m_extraCustomCode.m_hasConstruct || m_customCode.m_hasConstructBody);
 
-    if (reads.empty() && refreshes.empty() && m_customCode.m_private.empty() && (!hasPrivateConstruct)) {
+    auto presence = commsDefPresenceFuncsInternal();
+    auto fixedLayout = commsDefFixedLayoutPrivateInternal();
+    auto lazy = commsDefLazyPrivateInternal();
+    auto peek = commsDefFixedOffsetPrivateInternal();
+
+    if (reads.empty() && refreshes.empty() && presence.empty() && fixedLayout.empty() && lazy.empty() && peek.empty() &&
+        m_customCode.m_private.empty() && (!hasPrivateConstruct)) {
         return strings::genEmptyString();
     }
 
@@ -1091,6 +1223,10 @@ std::string CommsMessage::commsDefPrivateInternal() const
         "    #^#CONSTRUCT#$#\n"
         "    #^#READS#$#\n"
         "    #^#REFRESHES#$#\n"
+        "    #^#PRESENCE#$#\n"
+        "    #^#FIXED_LAYOUT#$#\n"
+        "    #^#LAZY#$#\n"
+        "    #^#PEEK#$#\n"
         "    #^#CUSTOM#$#\n"
     ;
 
@@ -1098,6 +1234,10 @@ std::string CommsMessage::commsDefPrivateInternal() const
         {"CONSTRUCT", commsDefPrivateConstructInternal()},
         {"READS", util::genStrListToString(reads, "\n", "")},
         {"REFRESHES", util::genStrListToString(refreshes, "\n", "")},
+        {"PRESENCE", std::move(presence)},
+        {"FIXED_LAYOUT", std::move(fixedLayout)},
+        {"LAZY", std::move(lazy)},
+        {"PEEK", std::move(peek)},
         {"CUSTOM", m_customCode.m_private}
     };
 
@@ -1196,15 +1336,7 @@ std::string CommsMessage::commsDefFieldsAliasesInternal() const
 
 std::string CommsMessage::commsDefLengthCheckInternal() const
 {
-    bool hasCustomLength =
-        std::any_of(
-            m_commsFields.begin(), m_commsFields.end(),
-            [](auto* f)
-            {
-                return f->commsHasCustomLength();
-            });
-
-    if (hasCustomLength) {
+    if (commsHasCustomFieldsLengthInternal()) {
         return strings::genEmptyString();
     }
 
@@ -1216,20 +1348,8 @@ std::string CommsMessage::commsDefLengthCheckInternal() const
         "#^#MAX_LEN_ASSERT#$#\n"
     ;
 
-    auto minLength =
-        std::accumulate(
-            m_commsFields.begin(), m_commsFields.end(), std::size_t(0),
-            [](std::size_t soFar, auto* f)
-            {
-                return comms::genAddLength(soFar, f->commsMinLength());
-            });
-    auto maxLength =
-        std::accumulate(
-            m_commsFields.begin(), m_commsFields.end(), std::size_t(0),
-            [](std::size_t soFar, auto* f)
-            {
-                return comms::genAddLength(soFar, f->commsMaxLength());
-            });
+    auto minLength = commsFieldsLengthInternal(&CommsField::commsMinLength);
+    auto maxLength = commsFieldsLengthInternal(&CommsField::commsMaxLength);
 
     util::GenReplacementMap repl = {
         {"MIN_LEN_VAL", util::genNumToString(minLength)},
@@ -1299,13 +1419,21 @@ std::string CommsMessage::commsDefReadFuncInternal() const
             "    break;\n"
             "}\n";
 
+        assert(m_presenceGroups.size() == m_commsFields.size());
+        std::size_t groupEnd = 0U;
         for (auto idx = 0U; idx < m_commsFields.size(); ++idx) {
-            if (m_bundledReadPrepareCodes[idx].empty()) {
+            if ((idx < groupEnd) || m_bundledReadPrepareCodes[idx].empty()) {
                 continue;
             }
 
             auto accName = comms::genAccessName(m_commsFields[idx]->commsGenField().genParseObj().parseName());
             auto prepStr = "readPrepare_" + accName + "();\n";
+            if (m_presenceGroups[idx] > 0U) {
+                // The whole group is prepared at once
+                prepStr = "refreshPresence_" + accName + "(presence_" + accName + "());\n";
+                groupEnd = idx + m_presenceGroups[idx];
+            }
+
             if (idx == 0U) {
                 reads.push_back(std::move(prepStr));
                 continue;
@@ -1331,6 +1459,9 @@ std::string CommsMessage::commsDefReadFuncInternal() const
         }
 
         if (readCond.empty() && reads.empty()) {
+            if ((!m_customCode.m_hasRead) && commsHasFixedLayoutReadWriteInternal()) {
+                origCode = commsDefFixedLayoutReadFuncInternal();
+            }
             break;
         }
 
@@ -1420,6 +1551,828 @@ std::string CommsMessage::commsDefReadFuncInternal() const
     return util::genProcessTemplate(Templ, repl);
 }
 
+std::string CommsMessage::commsDefWriteFuncInternal() const
+{
+    std::string origCode;
+    if ((!m_customCode.m_hasWrite) && commsHasFixedLayoutReadWriteInternal()) {
+        origCode = commsDefFixedLayoutWriteFuncInternal();
+    }
+
+    static const std::string Templ =
+       "#^#ORIG#$#\n"
+       "#^#CUSTOM#$#\n"
+    ;
+
+    util::GenReplacementMap repl = {
+        {"ORIG", std::move(origCode)},
+        {"CUSTOM", m_customCode.m_write},
+    };
+
+    return util::genProcessTemplate(Templ, repl);
+}
+
+std::string CommsMessage::commsDefFixedLayoutReadFuncInternal() const
+{
+    static const std::string Templ =
+        "/// @brief Generated read functionality.\n"
+        "/// @details All the fields have fixed serialisation length, the\n"
+        "///     available length is checked only once before the read.\n"
+        "template <typename TIter>\n"
+        "comms::ErrorStatus doRead(TIter& iter, std::size_t len)\n"
+        "{\n"
+        "    return doReadFixedLayoutInternal(iter, len, FixedLayoutReadTag());\n"
+        "}\n";
+
+    return Templ;
+}
+
+std::string CommsMessage::commsDefFixedLayoutWriteFuncInternal() const
+{
+    static const std::string Templ =
+        "/// @brief Generated write functionality.\n"
+        "/// @details All the fields have fixed serialisation length, the\n"
+        "///     available length is checked only once before the write.\n"
+        "template <typename TIter>\n"
+        "comms::ErrorStatus doWrite(TIter& iter, std::size_t len) const\n"
+        "{\n"
+        "    return doWriteFixedLayoutInternal(iter, len, FixedLayoutWriteTag());\n"
+        "}\n";
+
+    return Templ;
+}
+
+std::string CommsMessage::commsDefFixedLayoutPrivateInternal() const
+{
+    if (!commsHasFixedLayoutReadWriteInternal()) {
+        return strings::genEmptyString();
+    }
+
+    bool hasRead = (!m_customCode.m_hasRead);
+    bool hasWrite = (!m_customCode.m_hasWrite);
+    if ((!hasRead) && (!hasWrite)) {
+        return strings::genEmptyString();
+    }
+
+    util::GenStringsList readChecks;
+    util::GenStringsList writeChecks;
+    util::GenStringsList reads;
+    util::GenStringsList writes;
+    for (auto* f : m_commsFields) {
+        auto accName = comms::genAccessName(f->commsGenField().genParseObj().parseName());
+        readChecks.push_back("Field_" + accName + "::hasReadNoStatus()");
+        writeChecks.push_back("Field_" + accName + "::hasWriteNoStatus()");
+        reads.push_back("field_" + accName + "().readNoStatus(iter);");
+        writes.push_back("field_" + accName + "().writeNoStatus(iter);");
+    }
+
+    util::GenStringsList elems;
+    if (hasRead) {
+        static const std::string Templ =
+            "// The options may disable the read without status,\n"
+            "// use the default read in such case.\n"
+            "using FixedLayoutReadTag =\n"
+            "    std::integral_constant<\n"
+            "        bool,\n"
+            "        (Base::doMinLength() == Base::doMaxLength()) &&\n"
+            "        #^#CHECKS#$#\n"
+            "    >;\n\n"
+            "template <typename TIter>\n"
+            "comms::ErrorStatus doReadFixedLayoutInternal(TIter& iter, std::size_t len, std::true_type)\n"
+            "{\n"
+            "    if (len < Base::doMinLength()) {\n"
+            "        return comms::ErrorStatus::NotEnoughData;\n"
+            "    }\n\n"
+            "    #^#READS#$#\n"
+            "    return comms::ErrorStatus::Success;\n"
+            "}\n\n"
+            "template <typename TIter>\n"
+            "comms::ErrorStatus doReadFixedLayoutInternal(TIter& iter, std::size_t len, std::false_type)\n"
+            "{\n"
+            "    return Base::doRead(iter, len);\n"
+            "}\n";
+
+        util::GenReplacementMap repl = {
+            {"CHECKS", util::genStrListToString(readChecks, " &&\n", "")},
+            {"READS", util::genStrListToString(reads, "\n", "")},
+        };
+
+        elems.push_back(util::genProcessTemplate(Templ, repl));
+    }
+
+    if (hasWrite) {
+        static const std::string Templ =
+            "// The options may disable the write without status,\n"
+            "// use the default write in such case.\n"
+            "using FixedLayoutWriteTag =\n"
+            "    std::integral_constant<\n"
+            "        bool,\n"
+            "        (Base::doMinLength() == Base::doMaxLength()) &&\n"
+            "        #^#CHECKS#$#\n"
+            "    >;\n\n"
+            "template <typename TIter>\n"
+            "comms::ErrorStatus doWriteFixedLayoutInternal(TIter& iter, std::size_t len, std::true_type) const\n"
+            "{\n"
+            "    if (len < Base::doMinLength()) {\n"
+            "        return comms::ErrorStatus::BufferOverflow;\n"
+            "    }\n\n"
+            "    #^#WRITES#$#\n"
+            "    return comms::ErrorStatus::Success;\n"
+            "}\n\n"
+            "template <typename TIter>\n"
+            "comms::ErrorStatus doWriteFixedLayoutInternal(TIter& iter, std::size_t len, std::false_type) const\n"
+            "{\n"
+            "    return Base::doWrite(iter, len);\n"
+            "}\n";
+
+        util::GenReplacementMap repl = {
+            {"CHECKS", util::genStrListToString(writeChecks, " &&\n", "")},
+            {"WRITES", util::genStrListToString(writes, "\n", "")},
+        };
+
+        elems.push_back(util::genProcessTemplate(Templ, repl));
+    }
+
+    return util::genStrListToString(elems, "\n", "");
+}
+
+bool CommsMessage::commsIsFixedLayoutInternal() const
+{
+    auto obj = genParseObj();
+    if (m_commsFields.empty() ||
+        obj.parseIsFailOnInvalid() ||
+        obj.parseReadCond().parseValid() ||
+        (!commsHasOrigCode(obj.parseReadOverride())) ||
+        (!commsHasOrigCode(obj.parseWriteOverride()))) {
+        return false;
+    }
+
+    bool hasReadPrepare =
+        std::any_of(
+            m_bundledReadPrepareCodes.begin(), m_bundledReadPrepareCodes.end(),
+            [](const std::string& code)
+            {
+                return !code.empty();
+            });
+
+    if (hasReadPrepare) {
+        return false;
+    }
+
+    return
+        std::all_of(
+            m_commsFields.begin(), m_commsFields.end(),
+            [](auto* f)
+            {
+                return f->commsHasFixedLayout();
+            });
+}
+
+bool CommsMessage::commsHasFixedLayoutReadWriteInternal() const
+{
+    auto& gen = CommsGenerator::commsCast(genGenerator());
+    return gen.commsGetFixedLayoutMessages() && commsIsFixedLayoutInternal();
+}
+
+std::string CommsMessage::commsDefLazyAccessInternal() const
+{
+    static const std::string Templ =
+        "/// @brief Indices of the fields.\n"
+        "enum FieldIdx\n"
+        "{\n"
+        "    #^#INDICES#$#\n"
+        "    FieldIdx_numOfValues ///< number of available fields\n"
+        "};\n\n"
+        "/// @brief Access to all the fields.\n"
+        "/// @details Decodes all the fields and disables the write of the recorded\n"
+        "///     payload as-is. Must be used instead of @b Base::fields().\n"
+        "typename Base::AllFields& fields()\n"
+        "{\n"
+        "    lazyMaterializeAllInternal();\n"
+        "    m_lazyModified = true;\n"
+        "    return Base::fields();\n"
+        "}\n\n"
+        "/// @brief Const access to all the fields.\n"
+        "/// @details Decodes all the fields.\n"
+        "const typename Base::AllFields& fields() const\n"
+        "{\n"
+        "    lazyMaterializeAllInternal();\n"
+        "    return Base::fields();\n"
+        "}\n\n"
+        "#^#ACCESS#$#\n";
+
+    static const std::string FieldTempl =
+        "/// @brief Type of the @ref #^#FIELDS#$#::#^#CLASS_NAME#$# field.\n"
+        "using Field_#^#NAME#$# = typename std::tuple_element<FieldIdx_#^#NAME#$#, typename Base::AllFields>::type;\n\n"
+        "/// @brief Access to the @ref #^#FIELDS#$#::#^#CLASS_NAME#$# field.\n"
+        "/// @details The field is decoded on the first access. The non-const access\n"
+        "///     disables the write of the recorded payload as-is.\n"
+        "Field_#^#NAME#$#& field_#^#NAME#$#()\n"
+        "{\n"
+        "    lazyMaterializeInternal(FieldIdx_#^#NAME#$#);\n"
+        "    m_lazyModified = true;\n"
+        "    return std::get<FieldIdx_#^#NAME#$#>(Base::fields());\n"
+        "}\n\n"
+        "/// @brief Const access to the @ref #^#FIELDS#$#::#^#CLASS_NAME#$# field.\n"
+        "/// @details The field is decoded on the first access, which updates the\n"
+        "///     internal state of the message. Hence the concurrent const access\n"
+        "///     to the same message object requires external synchronization.\n"
+        "const Field_#^#NAME#$#& field_#^#NAME#$#() const\n"
+        "{\n"
+        "    lazyMaterializeInternal(FieldIdx_#^#NAME#$#);\n"
+        "    return std::get<FieldIdx_#^#NAME#$#>(Base::fields());\n"
+        "}\n";
+
+    util::GenStringsList indices;
+    util::GenStringsList access;
+    auto fieldsName = comms::genClassName(genParseObj().parseName()) + strings::genFieldsSuffixStr();
+    for (auto* f : m_commsFields) {
+        auto& name = f->commsGenField().genParseObj().parseName();
+        auto accName = comms::genAccessName(name);
+        indices.push_back("FieldIdx_" + accName + ", ///< index of @ref " + fieldsName + "::" + comms::genClassName(name) + " field");
+
+        util::GenReplacementMap repl = {
+            {"FIELDS", fieldsName},
+            {"CLASS_NAME", comms::genClassName(name)},
+            {"NAME", accName},
+        };
+
+        access.push_back(util::genProcessTemplate(FieldTempl, repl));
+    }
+
+    util::GenReplacementMap repl = {
+        {"INDICES", util::genStrListToString(indices, "\n", "")},
+        {"ACCESS", util::genStrListToString(access, "\n", "")},
+    };
+
+    return util::genProcessTemplate(Templ, repl);
+}
+
+std::string CommsMessage::commsDefLazyFuncsInternal() const
+{
+    static const std::string Templ =
+        "/// @brief Generated read functionality.\n"
+        "/// @details Records the payload without decoding the fields, they are\n"
+        "///     decoded on the first access. The input buffer must outlive the message\n"
+        "///     or @ref lazyMaterialize() must be called before its release.\n"
+        "///     The whole (delimited by the frame) payload is consumed.\n"
+        "///     Only the minimal length is checked, the errors of the fields\n"
+        "///     decoding are reported by @ref lazyMaterialize().\n"
+        "///     Applicable only to the byte pointer iterators, others use\n"
+        "///     the default read.\n"
+        "template <typename TIter>\n"
+        "comms::ErrorStatus doRead(TIter& iter, std::size_t len)\n"
+        "{\n"
+        "    return doReadLazyInternal(iter, len, LazyReadTag<TIter>());\n"
+        "}\n\n"
+        "/// @brief Generated write functionality.\n"
+        "/// @details Writes the recorded payload as-is when the fields haven't been\n"
+        "///     accessed for modification.\n"
+        "template <typename TIter>\n"
+        "comms::ErrorStatus doWrite(TIter& iter, std::size_t len) const\n"
+        "{\n"
+        "    if ((m_lazyData == nullptr) || m_lazyModified) {\n"
+        "        lazyMaterializeAllInternal();\n"
+        "        return Base::doWrite(iter, len);\n"
+        "    }\n\n"
+        "    if (len < m_lazyLen) {\n"
+        "        return comms::ErrorStatus::BufferOverflow;\n"
+        "    }\n\n"
+        "    iter = std::copy(m_lazyData, m_lazyData + m_lazyLen, iter);\n"
+        "    return comms::ErrorStatus::Success;\n"
+        "}\n\n"
+        "/// @brief Generated length calculation functionality.\n"
+        "std::size_t doLength() const\n"
+        "{\n"
+        "    if ((m_lazyData != nullptr) && (!m_lazyModified)) {\n"
+        "        return m_lazyLen;\n"
+        "    }\n\n"
+        "    lazyMaterializeAllInternal();\n"
+        "    return Base::doLength();\n"
+        "}\n\n"
+        "/// @brief Generated validity check functionality.\n"
+        "bool doValid() const\n"
+        "{\n"
+        "    lazyMaterializeAllInternal();\n"
+        "    return Base::doValid();\n"
+        "}\n\n"
+        "/// @brief Generated refresh functionality.\n"
+        "bool doRefresh()\n"
+        "{\n"
+        "    lazyMaterializeAllInternal();\n"
+        "    return Base::doRefresh();\n"
+        "}\n\n"
+        "/// @brief Decode all the fields that haven't been accessed yet.\n"
+        "/// @details Releases the reference to the input buffer. Needs to be\n"
+        "///     called before using functionality of the COMMS library which\n"
+        "///     accesses the fields via base class (like comparison operators).\n"
+        "/// @return Status of the first failed field decoding if any.\n"
+        "comms::ErrorStatus lazyMaterialize()\n"
+        "{\n"
+        "    lazyMaterializeAllInternal();\n"
+        "    return m_lazyStatus;\n"
+        "}\n";
+
+    return Templ;
+}
+
+std::string CommsMessage::commsDefLazyPrivateInternal() const
+{
+    if (!commsIsLazyInternal()) {
+        return strings::genEmptyString();
+    }
+
+    static const std::string Templ =
+        "template <typename TIter>\n"
+        "using LazyReadTag =\n"
+        "    std::integral_constant<\n"
+        "        bool,\n"
+        "        std::is_pointer<TIter>::value &&\n"
+        "        std::is_convertible<TIter, const std::uint8_t*>::value\n"
+        "    >;\n\n"
+        "// Number of leading fields with offsets known at compile time\n"
+        "static const std::size_t LazyFixedCount = #^#FIXED_COUNT#$#;\n\n"
+        "template <typename TIter>\n"
+        "comms::ErrorStatus doReadLazyInternal(TIter& iter, std::size_t len, std::true_type)\n"
+        "{\n"
+        "    if (len < Base::doMinLength()) {\n"
+        "        return comms::ErrorStatus::NotEnoughData;\n"
+        "    }\n\n"
+        "    m_lazyData = iter;\n"
+        "    m_lazyLen = std::min(len, Base::doMaxLength());\n"
+        "    m_lazyNextIdx = LazyFixedCount;\n"
+        "    m_lazyNextOffset = lazyFixedOffsetInternal(LazyFixedCount);\n"
+        "    m_lazyDecoded.reset();\n"
+        "    m_lazyStatus = comms::ErrorStatus::Success;\n"
+        "    m_lazyModified = false;\n"
+        "    iter += m_lazyLen;\n"
+        "    return comms::ErrorStatus::Success;\n"
+        "}\n\n"
+        "template <typename TIter>\n"
+        "comms::ErrorStatus doReadLazyInternal(TIter& iter, std::size_t len, std::false_type)\n"
+        "{\n"
+        "    m_lazyData = nullptr;\n"
+        "    return Base::doRead(iter, len);\n"
+        "}\n\n"
+        "static std::size_t lazyFixedOffsetInternal(std::size_t idx)\n"
+        "{\n"
+        "    switch (idx) {\n"
+        "        #^#FIXED_OFFSETS#$#\n"
+        "        default: break;\n"
+        "    }\n"
+        "    return 0U;\n"
+        "}\n\n"
+        "// Returns number of consumed bytes. Invoked from the const accessors,\n"
+        "// updates the mutable state and the fields of the (non-const) message\n"
+        "// object which haven't been decoded yet.\n"
+        "std::size_t lazyReadFieldInternal(std::size_t idx, std::size_t offset) const\n"
+        "{\n"
+        "    m_lazyDecoded.set(idx);\n"
+        "    auto& fields = const_cast<typename Base::AllFields&>(Base::fields());\n"
+        "    const std::uint8_t* iter = m_lazyData + offset;\n"
+        "    auto len = m_lazyLen - offset;\n"
+        "    auto es = comms::ErrorStatus::Success;\n"
+        "    switch (idx) {\n"
+        "        #^#READS#$#\n"
+        "        default: break;\n"
+        "    }\n\n"
+        "    if (es != comms::ErrorStatus::Success) {\n"
+        "        // The rest of the fields remain default constructed\n"
+        "        m_lazyStatus = es;\n"
+        "        m_lazyDecoded.set();\n"
+        "        m_lazyNextIdx = FieldIdx_numOfValues;\n"
+        "    }\n\n"
+        "    return static_cast<std::size_t>(iter - (m_lazyData + offset));\n"
+        "}\n\n"
+        "void lazyMaterializeInternal(std::size_t idx) const\n"
+        "{\n"
+        "    if ((m_lazyData == nullptr) || m_lazyDecoded[idx]) {\n"
+        "        return;\n"
+        "    }\n\n"
+        "    if (idx < LazyFixedCount) {\n"
+        "        lazyReadFieldInternal(idx, lazyFixedOffsetInternal(idx));\n"
+        "        return;\n"
+        "    }\n\n"
+        "    // The offsets of the following fields are known only after\n"
+        "    // the previous ones have been decoded.\n"
+        "    while (m_lazyNextIdx <= idx) {\n"
+        "        auto consumed = lazyReadFieldInternal(m_lazyNextIdx, m_lazyNextOffset);\n"
+        "        m_lazyNextOffset += consumed;\n"
+        "        ++m_lazyNextIdx;\n"
+        "    }\n"
+        "}\n\n"
+        "void lazyMaterializeAllInternal() const\n"
+        "{\n"
+        "    if (m_lazyData == nullptr) {\n"
+        "        return;\n"
+        "    }\n\n"
+        "    for (std::size_t idx = 0U; idx < static_cast<std::size_t>(FieldIdx_numOfValues); ++idx) {\n"
+        "        lazyMaterializeInternal(idx);\n"
+        "    }\n\n"
+        "    m_lazyData = nullptr;\n"
+        "}\n\n"
+        "mutable const std::uint8_t* m_lazyData = nullptr;\n"
+        "std::size_t m_lazyLen = 0U;\n"
+        "mutable std::size_t m_lazyNextIdx = 0U;\n"
+        "mutable std::size_t m_lazyNextOffset = 0U;\n"
+        "mutable std::bitset<FieldIdx_numOfValues> m_lazyDecoded;\n"
+        "mutable comms::ErrorStatus m_lazyStatus = comms::ErrorStatus::Success;\n"
+        "bool m_lazyModified = false;\n";
+
+    util::GenStringsList offsets;
+    util::GenStringsList reads;
+    auto fixedCount = commsFixedOffsetFieldsCountInternal();
+    for (auto idx = 0U; idx < m_commsFields.size(); ++idx) {
+        auto accName = comms::genAccessName(m_commsFields[idx]->commsGenField().genParseObj().parseName());
+        reads.push_back("case FieldIdx_" + accName + ": es = std::get<FieldIdx_" + accName + ">(fields).read(iter, len); break;");
+
+        if (idx <= fixedCount) {
+            offsets.push_back("case FieldIdx_" + accName + ": return " + commsDefFieldOffsetInternal(idx) + ";");
+        }
+    }
+
+    if (fixedCount == m_commsFields.size()) {
+        // All the fields are fixed, the offset past the last one
+        offsets.push_back("case FieldIdx_numOfValues: return " + commsDefFieldOffsetInternal(fixedCount) + ";");
+    }
+
+    util::GenReplacementMap repl = {
+        {"FIXED_COUNT", util::genNumToString(fixedCount) + 'U'},
+        {"FIXED_OFFSETS", util::genStrListToString(offsets, "\n", "")},
+        {"READS", util::genStrListToString(reads, "\n", "")},
+    };
+
+    return util::genProcessTemplate(Templ, repl);
+}
+
+bool CommsMessage::commsIsLazyInternal() const
+{
+    auto& gen = CommsGenerator::commsCast(genGenerator());
+    if ((!gen.commsGetLazyMessages()) ||
+        m_commsFields.empty() ||
+        commsIsFixedLayoutInternal()) {
+        return false;
+    }
+
+    auto obj = genParseObj();
+    if (obj.parseIsFailOnInvalid() ||
+        obj.parseReadCond().parseValid() ||
+        obj.parseValidCond().parseValid() ||
+        m_customCode.m_hasRead ||
+        m_customCode.m_hasWrite ||
+        m_customCode.m_hasRefresh ||
+        m_customCode.m_hasLength ||
+        m_customCode.m_hasValid ||
+        (!obj.parseAliases().empty())) {
+        return false;
+    }
+
+    auto hasCode =
+        [](const GenStringsList& codes)
+        {
+            return
+                std::any_of(
+                    codes.begin(), codes.end(),
+                    [](const std::string& code)
+                    {
+                        return !code.empty();
+                    });
+        };
+
+    if (hasCode(m_bundledReadPrepareCodes) || hasCode(m_bundledRefreshCodes)) {
+        return false;
+    }
+
+    // The fields which fail the read on invalid value are expected to
+    // reject the message during the read.
+    return
+        std::none_of(
+            m_commsFields.begin(), m_commsFields.end(),
+            [](auto* f)
+            {
+                return f->commsIsVersionDependent() || f->commsIsFailOnInvalid();
+            });
+}
+
+std::string CommsMessage::commsDefFixedOffsetFuncsInternal() const
+{
+    static const std::string PeekTempl =
+        "/// @brief Extract the @ref #^#FIELDS#$#::#^#CLASS_NAME#$# field from the\n"
+        "///     raw payload without constructing and reading the message.\n"
+        "/// @param[in] payload Pointer to the beginning of the message payload.\n"
+        "/// @param[in] len Length of the payload.\n"
+        "/// @param[out] es Optional status of the field read.\n"
+        "/// @return Field object, default constructed in case of the read failure.\n"
+        "static Field_#^#NAME#$# peek_#^#NAME#$#(const std::uint8_t* payload, std::size_t len, comms::ErrorStatus* es = nullptr)\n"
+        "{\n"
+        "    return peekFieldInternal<Field_#^#NAME#$#>(payload, len, #^#OFFSET#$#, es);\n"
+        "}\n";
+
+    static const std::string PatchTempl =
+        "/// @brief Update the @ref #^#FIELDS#$#::#^#CLASS_NAME#$# field inside the\n"
+        "///     already serialized payload without reading and writing the whole message.\n"
+        "/// @details Use @b updateChecksum() function of the frame to recalculate\n"
+        "///     the enclosing checksum (if any) afterwards.\n"
+        "/// @param[in, out] payload Pointer to the beginning of the message payload.\n"
+        "/// @param[in] len Length of the payload.\n"
+        "/// @param[in] value New value of the field.\n"
+        "static comms::ErrorStatus patch_#^#NAME#$#(std::uint8_t* payload, std::size_t len, const typename Field_#^#NAME#$#::ValueType& value)\n"
+        "{\n"
+        "    Field_#^#NAME#$# field;\n"
+        "    field.value() = value;\n"
+        "    return patchFieldInternal(payload, len, #^#OFFSET#$#, field);\n"
+        "}\n";
+
+    if (!commsHasFixedOffsetFuncsInternal()) {
+        return strings::genEmptyString();
+    }
+
+    auto& gen = CommsGenerator::commsCast(genGenerator());
+    util::GenStringsList funcs;
+    auto fieldsName = comms::genClassName(genParseObj().parseName()) + strings::genFieldsSuffixStr();
+    auto fixedCount = commsFixedOffsetFieldsCountInternal();
+    for (auto idx = 0U; idx < fixedCount; ++idx) {
+        auto& name = m_commsFields[idx]->commsGenField().genParseObj().parseName();
+        util::GenReplacementMap repl = {
+            {"FIELDS", fieldsName},
+            {"CLASS_NAME", comms::genClassName(name)},
+            {"NAME", comms::genAccessName(name)},
+            {"OFFSET", commsDefFieldOffsetInternal(idx)},
+        };
+
+        if (gen.commsGetPeekFunctions()) {
+            funcs.push_back(util::genProcessTemplate(PeekTempl, repl));
+        }
+
+        if (gen.commsGetPatchFunctions() && (0U < m_commsFields[idx]->commsMinLength())) {
+            funcs.push_back(util::genProcessTemplate(PatchTempl, repl));
+        }
+    }
+
+    return util::genStrListToString(funcs, "\n", "");
+}
+
+std::string CommsMessage::commsDefFixedOffsetPrivateInternal() const
+{
+    // The lazy messages use the same offsets
+    if ((!commsHasFixedOffsetFuncsInternal()) && (!commsIsLazyInternal())) {
+        return strings::genEmptyString();
+    }
+
+    auto fixedCount = commsFixedOffsetFieldsCountInternal();
+    if (fixedCount == 0U) {
+        return strings::genEmptyString();
+    }
+
+    static const std::string Templ =
+        "// The offsets of the leading fields are known at compile time\n"
+        "#^#CHECKS#$#\n\n"
+        "#^#PEEK#$#\n"
+        "#^#PATCH#$#\n";
+
+    static const std::string PatchTempl =
+        "template <typename TField>\n"
+        "static comms::ErrorStatus patchFieldInternal(std::uint8_t* payload, std::size_t len, std::size_t offset, const TField& field)\n"
+        "{\n"
+        "    if ((len < offset) || ((len - offset) < TField::minLength())) {\n"
+        "        return comms::ErrorStatus::BufferOverflow;\n"
+        "    }\n\n"
+        "    auto* iter = payload + offset;\n"
+        "    return field.write(iter, len - offset);\n"
+        "}\n";
+
+    static const std::string PeekTempl =
+        "template <typename TField>\n"
+        "static TField peekFieldInternal(const std::uint8_t* payload, std::size_t len, std::size_t offset, comms::ErrorStatus* es)\n"
+        "{\n"
+        "    TField field;\n"
+        "    auto status = comms::ErrorStatus::NotEnoughData;\n"
+        "    if (offset <= len) {\n"
+        "        auto* iter = payload + offset;\n"
+        "        status = field.read(iter, len - offset);\n"
+        "    }\n\n"
+        "    if (status != comms::ErrorStatus::Success) {\n"
+        "        field = TField();\n"
+        "    }\n\n"
+        "    if (es != nullptr) {\n"
+        "        *es = status;\n"
+        "    }\n\n"
+        "    return field;\n"
+        "}\n";
+
+    util::GenStringsList checks;
+    for (auto idx = 0U; idx < fixedCount; ++idx) {
+        auto accName = comms::genAccessName(m_commsFields[idx]->commsGenField().genParseObj().parseName());
+        checks.push_back(
+            "static_assert(Field_" + accName + "::minLength() == Field_" + accName + "::maxLength(), "
+            "\"Field_" + accName + " is expected to have fixed length\");");
+    }
+
+    util::GenReplacementMap repl = {
+        {"CHECKS", util::genStrListToString(checks, "\n", "")},
+    };
+
+    auto& gen = CommsGenerator::commsCast(genGenerator());
+    if (gen.commsGetPeekFunctions()) {
+        repl["PEEK"] = PeekTempl;
+    }
+
+    if (gen.commsGetPatchFunctions()) {
+        repl["PATCH"] = PatchTempl;
+    }
+
+    return util::genProcessTemplate(Templ, repl);
+}
+
+std::size_t CommsMessage::commsFixedOffsetFieldsCount() const
+{
+    return commsFixedOffsetFieldsCountInternal();
+}
+
+std::string CommsMessage::commsSiblingHeaderPath(const std::string& className) const
+{
+    // Extra per message headers reside next to the message definition
+    auto& gen = static_cast<const CommsGenerator&>(genGenerator());
+    return
+        gen.genGetOutputDir() + '/' + strings::genIncludeDirStr() + '/' +
+        util::genPathUp(comms::genRelHeaderPathFor(*this, gen)) + '/' + className + strings::genCppHeaderSuffixStr();
+}
+
+bool CommsMessage::commsHasFixedOffsetFuncsInternal() const
+{
+    auto& gen = CommsGenerator::commsCast(genGenerator());
+    return
+        (gen.commsGetPeekFunctions() || gen.commsGetPatchFunctions()) &&
+        (commsFixedOffsetFieldsCountInternal() > 0U);
+}
+
+std::size_t CommsMessage::commsFixedOffsetFieldsCountInternal() const
+{
+    if (m_customCode.m_hasRead ||
+        (!commsHasOrigCode(genParseObj().parseReadOverride()))) {
+        return 0U;
+    }
+
+    assert(m_bundledReadPrepareCodes.size() == m_commsFields.size());
+    std::size_t result = 0U;
+    for (; result < m_commsFields.size(); ++result) {
+        auto* f = m_commsFields[result];
+        bool fixedLength =
+            m_bundledReadPrepareCodes[result].empty() &&
+            (!f->commsIsVersionDependent()) &&
+            (!f->commsHasCustomLength()) &&
+            (f->commsMinLength() == f->commsMaxLength());
+
+        if (!fixedLength) {
+            break;
+        }
+    }
+
+    return result;
+}
+
+std::string CommsMessage::commsDefFieldOffsetInternal(std::size_t idx) const
+{
+    assert(idx <= m_commsFields.size());
+    if (idx == 0U) {
+        return "0U";
+    }
+
+    util::GenStringsList lengths;
+    for (auto prevIdx = 0U; prevIdx < idx; ++prevIdx) {
+        auto accName = comms::genAccessName(m_commsFields[prevIdx]->commsGenField().genParseObj().parseName());
+        lengths.push_back("Field_" + accName + "::minLength()");
+    }
+
+    return util::genStrListToString(lengths, " + ", "");
+}
+
+std::string CommsMessage::commsDefSkipFuncInternal() const
+{
+    auto& gen = CommsGenerator::commsCast(genGenerator());
+    if (!gen.commsGetSkipFunctions()) {
+        return strings::genEmptyString();
+    }
+
+    static const std::string Templ =
+        "/// @brief Determine serialization length of the message payload from the\n"
+        "///     raw input buffer.\n"
+        "/// @details Skips over the fields using their @b skip() functions without\n"
+        "///     constructing the message object where possible. The field values\n"
+        "///     are validated only when invalid ones fail the read. The messages\n"
+        "///     sharing the same numeric ID are always fully read.\n"
+        "/// @param[in] buf Pointer to the beginning of the message payload.\n"
+        "/// @param[in] len Number of bytes available in the buffer.\n"
+        "/// @param[out] consumed Number of bytes occupied by the payload, updated only on success.\n"
+        "static comms::ErrorStatus skip(const std::uint8_t* buf, std::size_t len, std::size_t& consumed)\n"
+        "{\n"
+        "    #^#BODY#$#\n"
+        "}\n";
+
+    util::GenReplacementMap repl = {
+        {"BODY", commsDefSkipFuncBodyInternal()},
+    };
+
+    return util::genProcessTemplate(Templ, repl);
+}
+
+std::string CommsMessage::commsDefSkipFuncBodyInternal() const
+{
+    if (m_commsFields.empty()) {
+        return
+            "static_cast<void>(buf);\n"
+            "static_cast<void>(len);\n"
+            "consumed = 0U;\n"
+            "return comms::ErrorStatus::Success;";
+    }
+
+    auto obj = genParseObj();
+    bool hasReadPrepare =
+        std::any_of(
+            m_bundledReadPrepareCodes.begin(), m_bundledReadPrepareCodes.end(),
+            [](const std::string& code)
+            {
+                return !code.empty();
+            });
+
+    bool versionDependent =
+        std::any_of(
+            m_commsFields.begin(), m_commsFields.end(),
+            [](auto* f)
+            {
+                return f->commsIsVersionDependent();
+            });
+
+    auto allMessages = genGenerator().genSchemaOf(*this).genGetAllMessages();
+    auto id = obj.parseId();
+    bool sharedId =
+        std::any_of(
+            allMessages.begin(), allMessages.end(),
+            [this, id](auto* m)
+            {
+                return (m != this) && (m->genParseObj().parseId() == id);
+            });
+
+    // Messages sharing the same numeric ID are distinguished by the read
+    // failure, use the full read in such case as well.
+    if (sharedId ||
+        m_customCode.m_hasRead ||
+        (!commsHasOrigCode(obj.parseReadOverride())) ||
+        m_extraCustomCode.m_hasExtend ||
+        obj.parseIsFailOnInvalid() ||
+        obj.parseReadCond().parseValid() ||
+        hasReadPrepare ||
+        versionDependent) {
+        static const std::string ReadTempl =
+            "#^#CLASS_NAME#$##^#SUFFIX#$# msg;\n"
+            "auto iter = buf;\n"
+            "auto es = msg.doRead(iter, len);\n"
+            "if (es == comms::ErrorStatus::Success) {\n"
+            "    consumed = static_cast<std::size_t>(iter - buf);\n"
+            "}\n\n"
+            "return es;";
+
+        util::GenReplacementMap readRepl = {
+            {"CLASS_NAME", comms::genClassName(obj.parseName())},
+        };
+
+        if (m_extraCustomCode.m_hasExtend) {
+            readRepl["SUFFIX"] = strings::genOrigSuffixStr();
+        }
+
+        return util::genProcessTemplate(ReadTempl, readRepl);
+    }
+
+    static const std::string FieldTempl =
+        "es = Field_#^#NAME#$#::skip(buf + total, len - total, fieldLen);\n"
+        "if (es != comms::ErrorStatus::Success) {\n"
+        "    return es;\n"
+        "}\n\n"
+        "total += fieldLen;\n";
+
+    util::GenStringsList skips;
+    for (auto* f : m_commsFields) {
+        util::GenReplacementMap fieldRepl = {
+            {"NAME", comms::genAccessName(f->commsGenField().genParseObj().parseName())},
+        };
+
+        skips.push_back(util::genProcessTemplate(FieldTempl, fieldRepl));
+    }
+
+    static const std::string Templ =
+        "std::size_t total = 0U;\n"
+        "std::size_t fieldLen = 0U;\n"
+        "auto es = comms::ErrorStatus::Success;\n"
+        "#^#SKIPS#$#\n"
+        "consumed = total;\n"
+        "return es;";
+
+    util::GenReplacementMap repl = {
+        {"SKIPS", util::genStrListToString(skips, "\n", "")},
+    };
+
+    return util::genProcessTemplate(Templ, repl);
+}
+
 std::string CommsMessage::commsDefRefreshFuncInternal() const
 {
     std::string origCode;
@@ -1429,14 +2382,22 @@ std::string CommsMessage::commsDefRefreshFuncInternal() const
         }
 
         assert(m_commsFields.size() == m_bundledRefreshCodes.size());
+        assert(m_commsFields.size() == m_presenceGroups.size());
         util::GenStringsList fields;
+        std::size_t groupEnd = 0U;
         for (auto idx = 0U; idx < m_commsFields.size(); ++idx) {
             auto& code = m_bundledRefreshCodes[idx];
-            if (code.empty()) {
+            if ((idx < groupEnd) || code.empty()) {
                 continue;
             }
 
             auto accName = comms::genAccessName(m_commsFields[idx]->commsGenField().genParseObj().parseName());
+            if (m_presenceGroups[idx] > 0U) {
+                fields.push_back("updated = refreshPresence_" + accName + "(presence_" + accName + "()) || updated;");
+                groupEnd = idx + m_presenceGroups[idx];
+                continue;
+            }
+
             fields.push_back("updated = refresh_" + accName + "() || updated;");
         }
 
@@ -1768,4 +2729,158 @@ void CommsMessage::commsPrepareConstructCodeInternal()
     m_internalConstruct = util::genStrListToString(code, "", "");
 }
 
+void CommsMessage::commsPreparePresenceGroupsInternal()
+{
+    // Consecutive optional fields, which conditions reference only the fields
+    // before the first one of them, have their modes updated at once.
+    static const std::size_t MaxGroupSize = 32U;
+
+    assert(m_bundledReadPrepareCodes.size() == m_commsFields.size());
+    assert(m_bundledRefreshCodes.size() == m_commsFields.size());
+    m_presenceGroups.assign(m_commsFields.size(), 0U);
+
+    auto condOptionalFunc =
+        [this](std::size_t idx) -> const CommsOptionalField*
+        {
+            if (m_bundledReadPrepareCodes[idx].empty() || m_bundledRefreshCodes[idx].empty()) {
+                return nullptr;
+            }
+
+            auto& genField = m_commsFields[idx]->commsGenField();
+            if (genField.genParseObj().parseKind() != commsdsl::parse::ParseField::ParseKind::Optional) {
+                return nullptr;
+            }
+
+            return static_cast<const CommsOptionalField*>(&genField);
+        };
+
+    auto fieldIdxFunc =
+        [this](const std::string& name)
+        {
+            auto iter =
+                std::find_if(
+                    m_commsFields.begin(), m_commsFields.end(),
+                    [&name](auto* f)
+                    {
+                        return f->commsGenField().genParseObj().parseName() == name;
+                    });
+
+            return static_cast<std::size_t>(std::distance(m_commsFields.begin(), iter));
+        };
+
+    std::size_t start = 0U;
+    while (start < m_commsFields.size()) {
+        std::size_t count = 0U;
+        while (((start + count) < m_commsFields.size()) && (count < MaxGroupSize)) {
+            auto* optField = condOptionalFunc(start + count);
+            if ((optField == nullptr) || optField->commsPresenceCond(m_commsFields).empty()) {
+                break;
+            }
+
+            auto refs = optField->commsPresenceSiblingRefs();
+            bool dependsOnGroup =
+                std::any_of(
+                    refs.begin(), refs.end(),
+                    [start, &fieldIdxFunc](const std::string& name)
+                    {
+                        return start <= fieldIdxFunc(name);
+                    });
+
+            if (dependsOnGroup) {
+                break;
+            }
+
+            ++count;
+        }
+
+        if (count < 2U) {
+            ++start;
+            continue;
+        }
+
+        m_presenceGroups[start] = count;
+        start += count;
+    }
+}
+
+std::string CommsMessage::commsDefPresenceFuncsInternal() const
+{
+    static const std::string Templ =
+        "std::uint32_t presence_#^#ACC_NAME#$#() const\n"
+        "{\n"
+        "    std::uint32_t mask = 0U;\n"
+        "    #^#CONDS#$#\n"
+        "    return mask;\n"
+        "}\n\n"
+        "bool refreshPresence_#^#ACC_NAME#$#(std::uint32_t mask)\n"
+        "{\n"
+        "    bool updated = false;\n"
+        "    #^#UPDATES#$#\n"
+        "    return updated;\n"
+        "}\n";
+
+    static const std::string CondTempl =
+        "if (#^#COND#$#) {\n"
+        "    mask |= (1U << #^#BIT#$#);\n"
+        "}\n";
+
+    static const std::string UpdateTempl =
+        "updated = updatePresenceInternal(#^#FIELD#$#, (mask & (1U << #^#BIT#$#)) != 0U) || updated;";
+
+    static const std::string UpdateFuncStr =
+        "template <typename TField>\n"
+        "static bool updatePresenceInternal(TField& field, bool exists)\n"
+        "{\n"
+        "    auto mode = exists ? comms::field::OptionalMode::Exists : comms::field::OptionalMode::Missing;\n"
+        "    if (field.getMode() == mode) {\n"
+        "        return false;\n"
+        "    }\n\n"
+        "    field.setMode(mode);\n"
+        "    return true;\n"
+        "}\n";
+
+    assert(m_presenceGroups.size() == m_commsFields.size());
+    util::GenStringsList funcs;
+    for (auto idx = 0U; idx < m_commsFields.size(); ++idx) {
+        auto count = m_presenceGroups[idx];
+        if (count == 0U) {
+            continue;
+        }
+
+        util::GenStringsList conds;
+        util::GenStringsList updates;
+        for (auto bit = 0U; bit < count; ++bit) {
+            auto* optField = static_cast<const CommsOptionalField*>(&m_commsFields[idx + bit]->commsGenField());
+
+            util::GenReplacementMap condRepl = {
+                {"COND", optField->commsPresenceCond(m_commsFields)},
+                {"BIT", std::to_string(bit)},
+            };
+
+            util::GenReplacementMap updateRepl = {
+                {"FIELD", optField->commsPresenceFieldAccess()},
+                {"BIT", std::to_string(bit)},
+            };
+
+            conds.push_back(util::genProcessTemplate(CondTempl, condRepl));
+            updates.push_back(util::genProcessTemplate(UpdateTempl, updateRepl));
+        }
+
+        util::GenReplacementMap repl = {
+            {"ACC_NAME", comms::genAccessName(m_commsFields[idx]->commsGenField().genParseObj().parseName())},
+            {"CONDS", util::genStrListToString(conds, "\n", "")},
+            {"UPDATES", util::genStrListToString(updates, "\n", "")},
+        };
+
+        funcs.push_back(util::genProcessTemplate(Templ, repl));
+    }
+
+    if (funcs.empty()) {
+        return strings::genEmptyString();
+    }
+
+    funcs.push_back(UpdateFuncStr);
+    return util::genStrListToString(funcs, "\n", "");
+}
+
 } // namespace commsdsl2comms
@@ -53,6 +53,12 @@ public:
     std::string commsServerDefaultOptions() const;
     std::string commsDataViewDefaultOptions() const;
     std::string commsBareMetalDefaultOptions() const;
+    std::string commsHighThroughputDefaultOptions() const;
+
+    std::size_t commsMinLength() const;
+    std::size_t commsMaxLength() const;
+    std::size_t commsFixedOffsetFieldsCount() const;
+    std::string commsSiblingHeaderPath(const std::string& className) const;
 
 protected:
     virtual bool genPrepareImpl() override;
@@ -61,6 +67,7 @@ protected:
 private:
     using CommsFieldOptsFunc = std::string (CommsField::*)() const;
     using CommsExtraMessageOptsFunc = GenStringsList (CommsMessage::*)() const;
+    using CommsLengthFunc = std::size_t (CommsField::*)() const;
 
     struct CommsCustomCode
     {
@@ -121,6 +128,9 @@ private:
     std::string commsCommonIncludesInternal() const;
     std::string commsCommonBodyInternal() const;
     std::string commsCommonNameFuncInternal() const;
+    std::string commsCommonLengthFuncsInternal() const;
+    bool commsHasCustomFieldsLengthInternal() const;
+    std::size_t commsFieldsLengthInternal(CommsLengthFunc func) const;
     std::string commsCommonFieldsCodeInternal() const;
     std::string commsDefIncludesInternal() const;
     std::string commsDefConstructInternal() const;
@@ -139,6 +149,23 @@ private:
     std::string commsDefLengthCheckInternal() const;
     std::string commsDefNameFuncInternal() const;
     std::string commsDefReadFuncInternal() const;
+    std::string commsDefWriteFuncInternal() const;
+    std::string commsDefFixedLayoutReadFuncInternal() const;
+    std::string commsDefFixedLayoutWriteFuncInternal() const;
+    std::string commsDefFixedLayoutPrivateInternal() const;
+    bool commsIsFixedLayoutInternal() const;
+    bool commsHasFixedLayoutReadWriteInternal() const;
+    std::string commsDefLazyAccessInternal() const;
+    std::string commsDefLazyFuncsInternal() const;
+    std::string commsDefLazyPrivateInternal() const;
+    bool commsIsLazyInternal() const;
+    std::string commsDefFixedOffsetFuncsInternal() const;
+    std::string commsDefFixedOffsetPrivateInternal() const;
+    bool commsHasFixedOffsetFuncsInternal() const;
+    std::size_t commsFixedOffsetFieldsCountInternal() const;
+    std::string commsDefSkipFuncInternal() const;
+    std::string commsDefSkipFuncBodyInternal() const;
+    std::string commsDefFieldOffsetInternal(std::size_t idx) const;
     std::string commsDefRefreshFuncInternal() const;
     std::string commsDefPrivateConstructInternal() const;
     bool commsIsCustomizableInternal() const;
@@ -153,10 +180,13 @@ private:
     GenStringsList commsClientExtraCustomizationOptionsInternal() const;
     GenStringsList commsServerExtraCustomizationOptionsInternal() const;
     void commsPrepareConstructCodeInternal();
+    void commsPreparePresenceGroupsInternal();
+    std::string commsDefPresenceFuncsInternal() const;
 
     CommsFieldsList m_commsFields;
     commsdsl::gen::util::GenStringsList m_bundledReadPrepareCodes;
     commsdsl::gen::util::GenStringsList m_bundledRefreshCodes;
+    std::vector<std::size_t> m_presenceGroups;
     std::string m_internalConstruct;
     CommsCustomCode m_customCode;
     CommsExtraCustomCode m_extraCustomCode;
@@ -26,8 +26,8 @@
 #include <algorithm>
 #include <cassert>
 #include <functional>
-#include <fstream>
 #include <map>
+#include <vector>
 
 namespace comms = commsdsl::gen::comms;
 namespace strings = commsdsl::gen::strings;
@@ -45,12 +45,27 @@ const std::string CommsDynMemStr = "DynMem";
 const std::string CommsInPlaceStr = "InPlace";
 const std::string CommsDynMemAllocPolicyStr("dynamic");
 const std::string CommsInPlacePolicyStr("in place");
+const std::string CommsPoolStr = "Pool";
+const std::string CommsPoolPolicyStr("pool");
 const std::string CommsAllMessagesDesc("all the");
 const std::string CommsClientDesc("the client input");
 const std::string CommsServerDesc("the server input");
 
 using GenMessagesAccessList = std::vector<const commsdsl::gen::GenMessage*>;
 using CommsMessagesMap = std::map<std::uintmax_t, GenMessagesAccessList>;
+using CommsSignedMessagesMap = std::map<std::intmax_t, const GenMessagesAccessList*>;
+
+const std::size_t CommsMinTableFactoryIds = 8U;
+const std::size_t CommsDefaultPoolCapacity = 16U;
+
+enum class CommsFactoryKind
+{
+    DynMem,
+    InPlace,
+    Pool
+};
+
+const std::uintmax_t CommsMaxDenseFactoryTableSize = 0x10000U;
 
 using CommsCheckFunction = std::function<bool (const commsdsl::gen::GenMessage&)>;
 using CommsCodeFunction = std::function<std::string (const commsdsl::gen::GenMessage&, const CommsGenerator&, int)>;
@@ -106,6 +121,7 @@ std::string commsGetMsgAllocCodeInternal(
         "    };\n\n"
         "#^#CHECK_IDX#$#\n"
         "updateReasonFunc(CreateFailureReason::None);\n"
+        "#^#HOT#$#\n"
         "switch (static_cast<std::intmax_t>(id)) {\n"
         "    #^#CASES#$#\n"
         "    default: break;\n"
@@ -113,8 +129,35 @@ std::string commsGetMsgAllocCodeInternal(
         "updateReasonFunc(CreateFailureReason::InvalidId);\n"
         "return MsgPtr();\n";
 
-    util::GenStringsList cases;
+    // The most frequent messages (if the profile is provided) are placed first
+    std::vector<const CommsMessagesMap::value_type*> elems;
+    elems.reserve(map.size());
+    GenMessagesAccessList allMessages;
     for (auto& elem : map) {
+        elems.push_back(&elem);
+        allMessages.insert(allMessages.end(), elem.second.begin(), elem.second.end());
+    }
+
+    auto freqFunc =
+        [&generator](const CommsMessagesMap::value_type* elem)
+        {
+            std::uintmax_t result = 0U;
+            for (auto* m : elem->second) {
+                result += generator.commsMsgFrequency(*m);
+            }
+            return result;
+        };
+
+    std::stable_sort(
+        elems.begin(), elems.end(),
+        [&freqFunc](auto* first, auto* second)
+        {
+            return freqFunc(second) < freqFunc(first);
+        });
+
+    util::GenStringsList cases;
+    for (auto* elemPtr : elems) {
+        auto& elem = *elemPtr;
         assert(!elem.second.empty());
 
         if (hasUniqueIds) {
@@ -155,6 +198,25 @@ std::string commsGetMsgAllocCodeInternal(
     };
 
     if (hasUniqueIds) {
+        static const std::string HotTempl =
+            "if (static_cast<std::intmax_t>(id) == #^#ID#$#) {\n"
+            "    #^#CODE#$#\n"
+            "}\n";
+
+        util::GenStringsList checks;
+        for (auto* m : generator.commsHotMessages(allMessages)) {
+            util::GenReplacementMap hotRepl = {
+                {"ID", util::genNumToStringWithHexComment(m->genParseObj().parseId())},
+                {"CODE", func(*m, generator, -1)},
+            };
+
+            checks.push_back(util::genProcessTemplate(HotTempl, hotRepl));
+        }
+
+        if (!checks.empty()) {
+            repl["HOT"] = "// Fast path for the most frequent messages\n" + util::genStrListToString(checks, "\n", "");
+        }
+
         repl["CHECK_IDX"] =
             "if (1U <= idx) {\n"
             "    updateReasonFunc(CreateFailureReason::InvalidId);\n"
@@ -197,23 +259,409 @@ std::string commsGetMsgCountCodeInternal(const CommsMessagesMap& map)
     return util::genProcessTemplate(Templ, repl);
 }
 
+bool commsIsTableStrategyInternal(const CommsMessagesMap& map, const CommsGenerator& generator)
+{
+    using CommsMsgFactoryStrategy = CommsGenerator::CommsMsgFactoryStrategy;
+    auto strategy = generator.commsGetMsgFactoryStrategy();
+    if ((strategy == CommsMsgFactoryStrategy::Switch) || map.empty()) {
+        return false;
+    }
+
+    if (strategy == CommsMsgFactoryStrategy::Table) {
+        return true;
+    }
+
+    assert(strategy == CommsMsgFactoryStrategy::Auto);
+    return CommsMinTableFactoryIds <= map.size();
+}
+
+// The tables are ordered by the signed message ID values,
+// the negative IDs precede the positive ones.
+CommsSignedMessagesMap commsSignedMessagesMapInternal(const CommsMessagesMap& map)
+{
+    CommsSignedMessagesMap result;
+    for (auto& elem : map) {
+        assert(!elem.second.empty());
+        result[static_cast<std::intmax_t>(elem.first)] = &elem.second;
+    }
+
+    return result;
+}
+
+std::string commsGetMsgTableFindCodeInternal(const CommsMessagesMap& map)
+{
+    std::map<std::intmax_t, std::size_t> counts;
+    for (auto& elem : commsSignedMessagesMapInternal(map)) {
+        counts[elem.first] = elem.second->size();
+    }
+
+    assert(!counts.empty());
+    auto minId = counts.begin()->first;
+    auto maxId = counts.rbegin()->first;
+    auto range = (static_cast<std::uintmax_t>(maxId) - static_cast<std::uintmax_t>(minId)) + 1U;
+    bool dense = (0U < range) && (range <= CommsMaxDenseFactoryTableSize) && (range <= (counts.size() * 2U));
+
+    util::GenStringsList offsets;
+    std::size_t offset = 0U;
+    auto addOffsetFunc =
+        [&offsets, &offset](std::intmax_t id, std::size_t count)
+        {
+            offsets.push_back(util::genNumToString(offset) + "U, // " + util::genNumToString(id));
+            offset += count;
+        };
+
+    if (dense) {
+        for (auto id = minId; ; ++id) {
+            auto iter = counts.find(id);
+            addOffsetFunc(id, (iter != counts.end()) ? iter->second : 0U);
+            if (id == maxId) {
+                break;
+            }
+        }
+
+        offsets.push_back(util::genNumToString(offset) + "U");
+
+        static const std::string Templ =
+            "static const std::size_t Offsets[] = {\n"
+            "    #^#OFFSETS#$#\n"
+            "};\n"
+            "static const std::intmax_t MinId = #^#MIN_ID#$#;\n"
+            "static const std::size_t Count = std::extent<decltype(Offsets)>::value - 1U;\n"
+            "auto idVal = static_cast<std::intmax_t>(id);\n"
+            "if (idVal < MinId) {\n"
+            "    return 0U;\n"
+            "}\n\n"
+            "auto idx = static_cast<std::uintmax_t>(idVal) - static_cast<std::uintmax_t>(MinId);\n"
+            "if (Count <= idx) {\n"
+            "    return 0U;\n"
+            "}\n\n"
+            "first = Offsets[idx];\n"
+            "return Offsets[idx + 1U] - first;\n";
+
+        util::GenReplacementMap repl = {
+            {"OFFSETS", util::genStrListToString(offsets, "\n", "")},
+            {"MIN_ID", util::genNumToString(minId)},
+        };
+
+        return util::genProcessTemplate(Templ, repl);
+    }
+
+    util::GenStringsList ids;
+    for (auto& elem : counts) {
+        ids.push_back(util::genNumToStringWithHexComment(elem.first) + ",");
+        addOffsetFunc(elem.first, elem.second);
+    }
+
+    offsets.push_back(util::genNumToString(offset) + "U");
+
+    static const std::string Templ =
+        "static const std::intmax_t Ids[] = {\n"
+        "    #^#IDS#$#\n"
+        "};\n"
+        "static const std::size_t Offsets[] = {\n"
+        "    #^#OFFSETS#$#\n"
+        "};\n"
+        "static const std::size_t Count = std::extent<decltype(Ids)>::value;\n"
+        "static_assert(std::extent<decltype(Offsets)>::value == (Count + 1U), \"Invalid offsets table\");\n"
+        "auto idVal = static_cast<std::intmax_t>(id);\n"
+        "const std::intmax_t* base = &Ids[0];\n"
+        "std::size_t len = Count;\n"
+        "while (1U < len) {\n"
+        "    auto half = len / 2U;\n"
+        "    base = (base[half] < idVal) ? (base + half) : base;\n"
+        "    len -= half;\n"
+        "}\n\n"
+        "auto idx = static_cast<std::size_t>(base - &Ids[0]) + ((*base < idVal) ? 1U : 0U);\n"
+        "if ((Count <= idx) || (Ids[idx] != idVal)) {\n"
+        "    return 0U;\n"
+        "}\n\n"
+        "first = Offsets[idx];\n"
+        "return Offsets[idx + 1U] - first;\n";
+
+    util::GenReplacementMap repl = {
+        {"IDS", util::genStrListToString(ids, "\n", "")},
+        {"OFFSETS", util::genStrListToString(offsets, "\n", "")},
+    };
+
+    return util::genProcessTemplate(Templ, repl);
+}
+
+std::string commsGetMsgTableAllocCodeInternal(const CommsMessagesMap& map, const CommsGenerator& generator, const std::string& poolClassName)
+{
+    static const std::string Templ =
+        "auto updateReasonFunc =\n"
+        "    [reason](CreateFailureReason val)\n"
+        "    {\n"
+        "        if (reason != nullptr) {\n"
+        "            *reason = val;\n"
+        "        }\n"
+        "    };\n\n"
+        "static const CreateFunc Funcs[] = {\n"
+        "    #^#FUNCS#$#\n"
+        "};\n\n"
+        "std::size_t first = 0U;\n"
+        "auto count = findInternal(id, first);\n"
+        "if (count <= idx) {\n"
+        "    updateReasonFunc(CreateFailureReason::InvalidId);\n"
+        "    return MsgPtr();\n"
+        "}\n\n"
+        "updateReasonFunc(CreateFailureReason::None);\n"
+        "return #^#CALL#$#;\n";
+
+    util::GenStringsList funcs;
+    for (auto& elem : commsSignedMessagesMapInternal(map)) {
+        for (auto* m : *elem.second) {
+            auto msgType = comms::genScopeFor(*m, generator) + "<TInterface, TProtOptions>";
+            if (poolClassName.empty()) {
+                funcs.push_back("&createMsgInternal<" + msgType + " >,");
+                continue;
+            }
+
+            funcs.push_back("&" + poolClassName + "::createMsgInternal<" + msgType + ", " + util::genNumToString(funcs.size()) + ">,");
+        }
+    }
+
+    util::GenReplacementMap repl = {
+        {"FUNCS", util::genStrListToString(funcs, "\n", "")},
+        {"CALL", poolClassName.empty() ? "Funcs[first + idx]()" : "(this->*Funcs[first + idx])()"},
+    };
+
+    return util::genProcessTemplate(Templ, repl);
+}
+
+std::string commsGetMsgTableCountCodeInternal()
+{
+    return
+        "std::size_t first = 0U;\n"
+        "return findInternal(id, first);\n";
+}
+
+std::string commsGetMsgTablePrivateCodeInternal(const CommsMessagesMap& map)
+{
+    static const std::string Templ =
+        "\n"
+        "private:\n"
+        "    using CreateFunc = MsgPtr (*)();\n\n"
+        "    template <typename TMsg>\n"
+        "    static MsgPtr createMsgInternal()\n"
+        "    {\n"
+        "        return MsgPtr(new TMsg);\n"
+        "    }\n\n"
+        "    // Returns number of messages with the same ID,\n"
+        "    // index of the first one is reported via \"first\" parameter.\n"
+        "    static std::size_t findInternal(MsgIdParamType id, std::size_t& first)\n"
+        "    {\n"
+        "        #^#CODE#$#\n"
+        "    }\n";
+
+    util::GenReplacementMap repl = {
+        {"CODE", commsGetMsgTableFindCodeInternal(map)},
+    };
+
+    return util::genProcessTemplate(Templ, repl);
+}
+
+std::string commsGetMsgPoolPrivateCodeInternal(const CommsMessagesMap& map, const std::string& className)
+{
+    static const std::string Templ =
+        "\n"
+        "private:\n"
+        "    using CreateFunc = MsgPtr (#^#CLASS_NAME#$#::*)() const;\n\n"
+        "    // Fixed capacity storage of objects of the same type,\n"
+        "    // the free blocks are kept in the singly linked list, the\n"
+        "    // allocation is expected to be performed by a single thread\n"
+        "    // while the release may be performed by any thread.\n"
+        "    class Pool\n"
+        "    {\n"
+        "    public:\n"
+        "        explicit Pool(std::size_t objSize) :\n"
+        "            m_blockElems((objSize + sizeof(Storage) - 1U) / sizeof(Storage)),\n"
+        "            m_storage(new Storage[m_blockElems * TPoolCapacity]),\n"
+        "            m_next(new std::size_t[TPoolCapacity]),\n"
+        "            m_head(0U)\n"
+        "        {\n"
+        "            for (std::size_t idx = 0U; idx < TPoolCapacity; ++idx) {\n"
+        "                m_next[idx] = idx + 1U;\n"
+        "            }\n"
+        "        }\n\n"
+        "        void* alloc()\n"
+        "        {\n"
+        "            auto idx = popInternal(ConcurrentTag());\n"
+        "            if (TPoolCapacity <= idx) {\n"
+        "                return nullptr;\n"
+        "            }\n\n"
+        "            return &m_storage[idx * m_blockElems];\n"
+        "        }\n\n"
+        "        void release(void* block)\n"
+        "        {\n"
+        "            auto offset = static_cast<std::size_t>(static_cast<Storage*>(block) - &m_storage[0]);\n"
+        "            pushInternal(offset / m_blockElems, ConcurrentTag());\n"
+        "        }\n\n"
+        "    private:\n"
+        "        struct alignas(std::max_align_t) Storage\n"
+        "        {\n"
+        "            unsigned char m_data[sizeof(std::max_align_t)];\n"
+        "        };\n\n"
+        "        using ConcurrentTag = std::integral_constant<bool, TConcurrentRelease>;\n"
+        "        using HeadType =\n"
+        "            typename std::conditional<\n"
+        "                TConcurrentRelease,\n"
+        "                std::atomic<std::size_t>,\n"
+        "                std::size_t\n"
+        "            >::type;\n\n"
+        "        std::size_t popInternal(std::true_type)\n"
+        "        {\n"
+        "            // Only the allocating thread removes blocks from the list,\n"
+        "            // the head can only change due to concurrent release (no ABA).\n"
+        "            auto head = m_head.load(std::memory_order_acquire);\n"
+        "            while (head < TPoolCapacity) {\n"
+        "                if (m_head.compare_exchange_weak(head, m_next[head], std::memory_order_acquire, std::memory_order_acquire)) {\n"
+        "                    break;\n"
+        "                }\n"
+        "            }\n"
+        "            return head;\n"
+        "        }\n\n"
+        "        std::size_t popInternal(std::false_type)\n"
+        "        {\n"
+        "            auto head = m_head;\n"
+        "            if (head < TPoolCapacity) {\n"
+        "                m_head = m_next[head];\n"
+        "            }\n"
+        "            return head;\n"
+        "        }\n\n"
+        "        void pushInternal(std::size_t idx, std::true_type)\n"
+        "        {\n"
+        "            auto head = m_head.load(std::memory_order_relaxed);\n"
+        "            do {\n"
+        "                m_next[idx] = head;\n"
+        "            } while (!m_head.compare_exchange_weak(head, idx, std::memory_order_release, std::memory_order_relaxed));\n"
+        "        }\n\n"
+        "        void pushInternal(std::size_t idx, std::false_type)\n"
+        "        {\n"
+        "            m_next[idx] = m_head;\n"
+        "            m_head = idx;\n"
+        "        }\n\n"
+        "        std::size_t m_blockElems = 0U;\n"
+        "        std::unique_ptr<Storage[]> m_storage;\n"
+        "        std::unique_ptr<std::size_t[]> m_next;\n"
+        "        HeadType m_head;\n"
+        "    };\n\n"
+        "    template <typename TMsg, std::size_t TIdx>\n"
+        "    MsgPtr createMsgInternal() const\n"
+        "    {\n"
+        "        static_assert(alignof(TMsg) <= alignof(std::max_align_t), \"Over-aligned messages are not supported\");\n"
+        "        auto& pool = m_pools[TIdx];\n"
+        "        if (!pool) {\n"
+        "            pool.reset(new Pool(sizeof(TMsg)));\n"
+        "        }\n\n"
+        "        auto* block = pool->alloc();\n"
+        "        if (block == nullptr) {\n"
+        "            // The pool is exhausted, fall back to the heap\n"
+        "            return MsgPtr(new TMsg);\n"
+        "        }\n\n"
+        "        return MsgPtr(new (block) TMsg, MsgDeleter(pool.get(), &releaseMsgInternal<TMsg>));\n"
+        "    }\n\n"
+        "    template <typename TMsg>\n"
+        "    static void releaseMsgInternal(void* pool, Message* msg)\n"
+        "    {\n"
+        "        auto* obj = static_cast<TMsg*>(msg);\n"
+        "        obj->~TMsg();\n"
+        "        static_cast<Pool*>(pool)->release(obj);\n"
+        "    }\n\n"
+        "    // Returns number of messages with the same ID,\n"
+        "    // index of the first one is reported via \"first\" parameter.\n"
+        "    static std::size_t findInternal(MsgIdParamType id, std::size_t& first)\n"
+        "    {\n"
+        "        #^#CODE#$#\n"
+        "    }\n\n"
+        "    static const std::size_t NumOfMessages = #^#MSGS_COUNT#$#;\n"
+        "    mutable std::unique_ptr<Pool> m_pools[NumOfMessages];\n";
+
+    std::size_t count = 0U;
+    for (auto& elem : map) {
+        count += elem.second.size();
+    }
+
+    util::GenReplacementMap repl = {
+        {"CODE", commsGetMsgTableFindCodeInternal(map)},
+        {"MSGS_COUNT", util::genNumToString(count) + "U"},
+        {"CLASS_NAME", className},
+    };
+
+    return util::genProcessTemplate(Templ, repl);
+}
+
+std::string commsGetMsgPoolPublicCodeInternal(const std::string& className)
+{
+    static const std::string Templ =
+        "/// @brief Deleter of the allocated messages.\n"
+        "/// @details Returns the message object to its pool, or\n"
+        "///     deletes it in case it was allocated on the heap.\n"
+        "class MsgDeleter\n"
+        "{\n"
+        "public:\n"
+        "    /// @brief Type of the function releasing message to the pool.\n"
+        "    using ReleaseFunc = void (*)(void*, Message*);\n\n"
+        "    /// @brief Default constructor, the message is deleted.\n"
+        "    MsgDeleter() = default;\n\n"
+        "    /// @brief Constructor, the message is released to the pool.\n"
+        "    MsgDeleter(void* pool, ReleaseFunc func) : m_pool(pool), m_func(func) {}\n\n"
+        "    /// @brief Release the message object.\n"
+        "    void operator()(Message* msg) const\n"
+        "    {\n"
+        "        if (m_func == nullptr) {\n"
+        "            delete msg;\n"
+        "            return;\n"
+        "        }\n\n"
+        "        m_func(m_pool, msg);\n"
+        "    }\n\n"
+        "private:\n"
+        "    void* m_pool = nullptr;\n"
+        "    ReleaseFunc m_func = nullptr;\n"
+        "};\n\n"
+        "/// @brief Default constructor\n"
+        "#^#CLASS_NAME#$#() = default;\n\n"
+        "/// @brief Copy constructor.\n"
+        "/// @details The pools are not shared, the new object allocates its own ones.\n"
+        "#^#CLASS_NAME#$#(const #^#CLASS_NAME#$#&) {}\n\n"
+        "/// @brief Copy assignment.\n"
+        "/// @details The pools are not shared, the object keeps its own ones.\n"
+        "#^#CLASS_NAME#$#& operator=(const #^#CLASS_NAME#$#&)\n"
+        "{\n"
+        "    return *this;\n"
+        "}\n";
+
+    util::GenReplacementMap repl = {
+        {"CLASS_NAME", className},
+    };
+
+    return util::genProcessTemplate(Templ, repl);
+}
+
 bool commsWriteFileInternal(
     const std::string& prefix,
     const std::string& desc,
     const CommsGenerator& generator,
     const CommsNamespace& parent,
-    CommsCheckFunction&& checkFunc,
-    bool inPlaceAlloc)
+    const CommsCheckFunction& checkFunc,
+    CommsFactoryKind kind)
 {
     auto* typeStr = &CommsDynMemStr;
     auto* policyStr = &CommsDynMemAllocPolicyStr;
     [[maybe_unused]] auto codeFunc = &commsDynMemAllocCodeFuncInternal;
+    bool inPlaceAlloc = (kind == CommsFactoryKind::InPlace);
+    bool pool = (kind == CommsFactoryKind::Pool);
     if (inPlaceAlloc) {
         typeStr = &CommsInPlaceStr;
         policyStr = &CommsInPlacePolicyStr;
         codeFunc = &commsInPlaceAllocCodeFuncInternal;
     }
 
+    if (pool) {
+        typeStr = &CommsPoolStr;
+        policyStr = &CommsPoolPolicyStr;
+    }
+
     auto name = prefix + *typeStr + strings::genMsgFactorySuffixStr();
     auto filePath = comms::genHeaderPathForFactory(name, generator, parent);
     generator.genLogger().genInfo("Generating " + filePath);
@@ -224,12 +672,6 @@ bool commsWriteFileInternal(
         return false;
     }
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        generator.genLogger().genError("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
-
     static const std::string Templ =
         "#^#GENERATED#$#\n"
         "/// @file\n"
@@ -242,14 +684,17 @@ bool commsWriteFileInternal(
         "/// @brief Message factory with #^#POLICY#$# memory allocation for #^#DESC#$# messages.\n"
         "/// @details Defines the same public interface as @b comms::MsgFactory and intended for\n"
         "///     its replacement.\n"
+        "#^#DETAILS#$#\n"
         "/// @tparam TInterface Interface class of the messages.\n"
         "/// @tparam TProtOptions Application specific protocol definition options.\n"
-        "template<typename TInterface, typename TProtOptions>\n"
+        "#^#EXTRA_TPARAMS_DOC#$#\n"
+        "template<typename TInterface, typename TProtOptions#^#EXTRA_TPARAMS#$#>\n"
         "class #^#NAME#$##^#ORIG#$#\n"
         "{\n"
         "public:\n"
         "    /// @brief Type of the common base class of all the messages.\n"
         "    using Message = TInterface;\n\n"
+        "    #^#PUBLIC#$#\n"
         "    /// @brief Type of the message ID when passed as a parameter.\n"
         "    using MsgIdParamType = typename Message::MsgIdParamType;\n\n"
         "    /// @brief Type of the message ID.\n"
@@ -326,6 +771,7 @@ bool commsWriteFileInternal(
         "    {\n"
         "        return true;\n"
         "    }\n"
+        "#^#PRIVATE#$#\n"
         "};\n\n"
         "#^#EXTEND#$#\n"
         "#^#APPEND#$#\n"
@@ -340,8 +786,6 @@ bool commsWriteFileInternal(
 
     };
 
-    comms::genPrepareIncludeStatement(includes);
-
     auto allMessages = parent.genGetAllMessagesIdSorted();
 
     CommsMessagesMap mappedMessages;
@@ -362,6 +806,17 @@ bool commsWriteFileInternal(
                 return elem.second.size() <= 1U;
             });
 
+    bool tableStrategy = (!mappedMessages.empty()) && (pool || commsIsTableStrategyInternal(mappedMessages, generator));
+    if (tableStrategy) {
+        includes.insert(includes.end(), {"<cstddef>", "<type_traits>"});
+    }
+
+    if (pool) {
+        includes.insert(includes.end(), {"<atomic>", "<cstddef>", "<new>", "<type_traits>"});
+    }
+
+    comms::genPrepareIncludeStatement(includes);
+
     bool classExtended = false;
     util::GenReplacementMap repl = {
         {"GENERATED", CommsGenerator::commsFileGeneratedComment()},
@@ -381,8 +836,32 @@ bool commsWriteFileInternal(
         {"CREATE_CODE", commsGetMsgAllocCodeInternal(mappedMessages, generator, codeFunc, hasUniqueIds)},
     };
 
+    auto className = name;
     if (classExtended) {
         repl["ORIG"] = strings::genOrigSuffixStr();
+        className += strings::genOrigSuffixStr();
+    }
+
+    if (tableStrategy) {
+        repl["MSG_COUNT_CODE"] = commsGetMsgTableCountCodeInternal();
+        repl["CREATE_CODE"] = commsGetMsgTableAllocCodeInternal(mappedMessages, generator, pool ? className : std::string());
+        repl["PRIVATE"] = commsGetMsgTablePrivateCodeInternal(mappedMessages);
+    }
+
+    if (pool) {
+        repl["DETAILS"] =
+            "///     The messages are allocated from the pools owned by the factory object,\n"
+            "///     hence the latter must outlive all the allocated messages (@ref MsgPtr objects).";
+        repl["EXTRA_TPARAMS_DOC"] =
+            "/// @tparam TPoolCapacity Number of objects in the pool of every message type.\n"
+            "/// @tparam TConcurrentRelease Allow release of the messages on the thread other than\n"
+            "///     the one performing the allocation. The release is lock-free.";
+        repl["EXTRA_TPARAMS"] = ", std::size_t TPoolCapacity = " + util::genNumToString(CommsDefaultPoolCapacity) + "U, bool TConcurrentRelease = true";
+        repl["DELETER_SUFFIX"] = ", MsgDeleter";
+        repl["PUBLIC"] = commsGetMsgPoolPublicCodeInternal(className);
+        if (!mappedMessages.empty()) {
+            repl["PRIVATE"] = commsGetMsgPoolPrivateCodeInternal(mappedMessages, className);
+        }
     }
 
     if (inPlaceAlloc) {
@@ -390,9 +869,25 @@ bool commsWriteFileInternal(
         assert(false); // Not implemented
     }
 
-    stream << util::genProcessTemplate(Templ, repl, true);
-    stream.flush();
-    return stream.good();
+    return generator.genWriteFile(filePath, util::genProcessTemplate(Templ, repl, true));
+}
+
+bool commsWriteFilesInternal(
+    const std::string& prefix,
+    const std::string& desc,
+    const CommsGenerator& generator,
+    const CommsNamespace& parent,
+    CommsCheckFunction&& checkFunc)
+{
+    if (!commsWriteFileInternal(prefix, desc, generator, parent, checkFunc, CommsFactoryKind::DynMem)) {
+        return false;
+    }
+
+    if (!generator.commsGetPoolMsgFactories()) {
+        return true;
+    }
+
+    return commsWriteFileInternal(prefix, desc, generator, parent, checkFunc, CommsFactoryKind::Pool);
 }
 
 } // namespace
@@ -432,16 +927,15 @@ bool CommsMsgFactory::commsWriteAllMsgFactoryInternal() const
             return true;
         };
 
-    auto dynMemWrite =
-        commsWriteFileInternal(
+    auto result =
+        commsWriteFilesInternal(
             strings::genAllMessagesStr(),
             CommsAllMessagesDesc,
             m_commsGenerator,
             m_parent,
-            checkFunc,
-            false);
+            checkFunc);
 
-    return dynMemWrite;
+    return result;
 }
 
 bool CommsMsgFactory::commsWriteClientMsgFactoryInternal() const
@@ -452,16 +946,15 @@ bool CommsMsgFactory::commsWriteClientMsgFactoryInternal() const
             return msg.genParseObj().parseSender() != commsdsl::parse::ParseMessage::ParseSender::Client;
         };
 
-    auto dynMemWrite =
-        commsWriteFileInternal(
+    auto result =
+        commsWriteFilesInternal(
             CommsClientPrefixStr,
             CommsClientDesc,
             m_commsGenerator,
             m_parent,
-            checkFunc,
-            false);
+            checkFunc);
 
-    return dynMemWrite;
+    return result;
 }
 
 bool CommsMsgFactory::commsWriteServerMsgFactoryInternal() const
@@ -472,16 +965,15 @@ bool CommsMsgFactory::commsWriteServerMsgFactoryInternal() const
             return msg.genParseObj().parseSender() != commsdsl::parse::ParseMessage::ParseSender::Server;
         };
 
-    auto dynMemWrite =
-        commsWriteFileInternal(
+    auto result =
+        commsWriteFilesInternal(
             CommsServerPrefixStr,
             CommsServerDesc,
             m_commsGenerator,
             m_parent,
-            checkFunc,
-            false);
+            checkFunc);
 
-    return dynMemWrite;
+    return result;
 }
 
 bool CommsMsgFactory::commsWritePlatformMsgFactoryInternal() const
@@ -506,16 +998,15 @@ bool CommsMsgFactory::commsWritePlatformMsgFactoryInternal() const
                 return platformCheckFunc(msg);
             };
 
-        auto allDynMemWrite =
-            commsWriteFileInternal(
+        auto allWrite =
+            commsWriteFilesInternal(
                 comms::genClassName(p) + "Messages",
                 CommsAllMessagesDesc + " \"" + p + "\" platform specific",
                 m_commsGenerator,
                 m_parent,
-                allCheckFunc,
-                false);
+                allCheckFunc);
 
-        if (!allDynMemWrite) {
+        if (!allWrite) {
             return false;
         }
 
@@ -527,16 +1018,15 @@ bool CommsMsgFactory::commsWritePlatformMsgFactoryInternal() const
                     (msg.genParseObj().parseSender() != commsdsl::parse::ParseMessage::ParseSender::Client);
             };
 
-        auto clientDynMemWrite =
-            commsWriteFileInternal(
+        auto clientWrite =
+            commsWriteFilesInternal(
                 comms::genClassName(p) + CommsClientPrefixStr,
                 CommsClientDesc + " \"" + p + "\" platform specific",
                 m_commsGenerator,
                 m_parent,
-                clientCheckFunc,
-                false);
+                clientCheckFunc);
 
-        if (!clientDynMemWrite) {
+        if (!clientWrite) {
             return false;
         }
 
@@ -548,16 +1038,15 @@ bool CommsMsgFactory::commsWritePlatformMsgFactoryInternal() const
                     (msg.genParseObj().parseSender() != commsdsl::parse::ParseMessage::ParseSender::Server);
             };
 
-        auto serverDynMemWrite =
-            commsWriteFileInternal(
+        auto serverWrite =
+            commsWriteFilesInternal(
                 comms::genClassName(p) + CommsServerPrefixStr,
                 CommsServerDesc + " \"" + p + "\" platform specific",
                 m_commsGenerator,
                 m_parent,
-                serverCheckFunc,
-                false);
+                serverCheckFunc);
 
-        if (!serverDynMemWrite) {
+        if (!serverWrite) {
             return false;
         }
     };
@@ -582,16 +1071,15 @@ bool CommsMsgFactory::commsWriteExtraMsgFactoryInternal() const
                 return bundleCheckFunc(msg);
             };
 
-        auto allDynMemWrite =
-            commsWriteFileInternal(
+        auto allWrite =
+            commsWriteFilesInternal(
                 comms::genClassName(b.first) + "Messages",
                 CommsAllMessagesDesc + " \"" + b.first+ "\" bundle specific",
                 m_commsGenerator,
                 m_parent,
-                allCheckFunc,
-                false);
+                allCheckFunc);
 
-        if (!allDynMemWrite) {
+        if (!allWrite) {
             return false;
         }
 
@@ -603,16 +1091,15 @@ bool CommsMsgFactory::commsWriteExtraMsgFactoryInternal() const
                     (msg.genParseObj().parseSender() != commsdsl::parse::ParseMessage::ParseSender::Client);
             };
 
-        auto clientDynMemWrite =
-            commsWriteFileInternal(
+        auto clientWrite =
+            commsWriteFilesInternal(
                 comms::genClassName(b.first) + CommsClientPrefixStr,
                 CommsClientDesc + " \"" + b.first+ "\" bundle specific",
                 m_commsGenerator,
                 m_parent,
-                clientCheckFunc,
-                false);
+                clientCheckFunc);
 
-        if (!clientDynMemWrite) {
+        if (!clientWrite) {
             return false;
         }
 
@@ -624,16 +1111,15 @@ bool CommsMsgFactory::commsWriteExtraMsgFactoryInternal() const
                     (msg.genParseObj().parseSender() != commsdsl::parse::ParseMessage::ParseSender::Server);
             };
 
-        auto serverDynMemWrite =
-            commsWriteFileInternal(
+        auto serverWrite =
+            commsWriteFilesInternal(
                 comms::genClassName(b.first) + CommsServerPrefixStr,
                 CommsServerDesc + " \"" + b.first + "\" bundle specific",
                 m_commsGenerator,
                 m_parent,
-                serverCheckFunc,
-                false);
+                serverCheckFunc);
 
-        if (!serverDynMemWrite) {
+        if (!serverWrite) {
             return false;
         }
     };
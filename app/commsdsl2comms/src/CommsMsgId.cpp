@@ -27,7 +27,6 @@
 
 #include <algorithm>
 #include <cassert>
-#include <fstream>
 #include <limits>
 
 namespace util = commsdsl::gen::util;
@@ -55,12 +54,6 @@ bool CommsMsgId::commsWrite() const
         return false;
     }
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        m_commsGenerator.genLogger().genError("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
-
     const std::string Templ =
         "#^#GENERATED#$#\n"
         "/// @file\n"
@@ -86,10 +79,7 @@ bool CommsMsgId::commsWrite() const
         {"NS_END", comms::genNamespaceEndFor(m_parent, m_commsGenerator)},
     };
 
-    stream << util::genProcessTemplate(Templ, repl, true);
-    stream.flush();
-    if (!stream.good()) {
-        m_commsGenerator.genLogger().genError("Failed to write \"" + filePath + "\".");
+    if (!m_commsGenerator.genWriteFile(filePath, util::genProcessTemplate(Templ, repl, true))) {
         return false;
     }
 
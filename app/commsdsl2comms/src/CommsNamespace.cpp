@@ -60,7 +60,8 @@ CommsNamespace::CommsNamespace(CommsGenerator& generator, ParseNamespace parseOb
     m_dispatch(generator, *this),
     m_factory(generator, *this),
     m_input(generator, *this),
-    m_msgId(generator, *this)
+    m_msgId(generator, *this),
+    m_frameMaxLengths(generator, *this)
 {
 }
 
@@ -213,6 +214,38 @@ std::string CommsNamespace::commsBareMetalDefaultOptions() const
     return util::genProcessTemplate(commsOptsTemplInternal(nsName.empty()), repl);
 }
 
+std::string CommsNamespace::commsHighThroughputDefaultOptions() const
+{
+    auto body =
+        commsOptionsInternal(
+            &CommsNamespace::commsHighThroughputDefaultOptions,
+            &CommsField::commsHighThroughputDefaultOptions,
+            &CommsMessage::commsHighThroughputDefaultOptions,
+            &CommsFrame::commsHighThroughputDefaultOptions,
+            true
+        );
+
+    if (body.empty()) {
+        return strings::genEmptyString();
+    }
+
+    auto& nsName = genName();
+    util::GenReplacementMap repl = {
+        {"NAME", nsName},
+        {"BODY", std::move(body)},
+    };
+
+    auto& commsGen = static_cast<const CommsGenerator&>(genGenerator());
+    bool hasMainNs = commsGen.commsHasMainNamespaceInOptions();
+    auto thisNsScope = comms::genScopeFor(*this, genGenerator(), hasMainNs);
+
+    if (!thisNsScope.empty()) {
+        repl["EXT"] = ": public TBase::" + thisNsScope;
+    }
+
+    return util::genProcessTemplate(commsOptsTemplInternal(nsName.empty()), repl);
+}
+
 std::string CommsNamespace::commsMsgFactoryDefaultOptions() const
 {
     auto body =
@@ -425,6 +458,12 @@ bool CommsNamespace::genWriteImpl() const
         return false;
     }
 
+    if ((!genFrames().empty()) &&
+        CommsGenerator::commsCast(genGenerator()).commsGetLengthBounds() &&
+        (!m_frameMaxLengths.commsWrite())) {
+        return false;
+    }
+
     if ((!genHasFramesRecursive()) ||
         (!genHasMessagesRecursive())) {
         return true;
@@ -20,6 +20,7 @@
 #include "CommsDispatch.h"
 #include "CommsField.h"
 #include "CommsFrame.h"
+#include "CommsFrameMaxLengths.h"
 #include "CommsInputMessages.h"
 #include "CommsMessage.h"
 #include "CommsMsgFactory.h"
@@ -52,6 +53,7 @@ public:
     std::string commsServerDefaultOptions() const;
     std::string commsDataViewDefaultOptions() const;
     std::string commsBareMetalDefaultOptions() const;
+    std::string commsHighThroughputDefaultOptions() const;
     std::string commsMsgFactoryDefaultOptions() const;
 
     bool commsHasReferencedMsgId() const;
@@ -89,6 +91,7 @@ private:
     CommsMsgFactory m_factory;
     CommsInputMessages m_input;
     CommsMsgId m_msgId;
+    CommsFrameMaxLengths m_frameMaxLengths;
 };
 
 } // namespace commsdsl2comms
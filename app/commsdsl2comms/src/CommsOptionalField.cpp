@@ -127,6 +127,33 @@ bool commsInterfaceReferenceInternal(const commsdsl::parse::ParseOptCond& cond)
             });
 }
 
+void commsSiblingRefsInternal(const commsdsl::parse::ParseOptCond& cond, util::GenStringsList& refs)
+{
+    if (cond.parseKind() == commsdsl::parse::ParseOptCond::ParseKind::Expr) {
+        using ParseOperandType = commsdsl::parse::ParseOptCondExpr::ParseOperandType;
+        commsdsl::parse::ParseOptCondExpr exprCond(cond);
+        for (auto& info : {exprCond.parseLeftInfo(), exprCond.parseRightInfo()}) {
+            if (info.m_type != ParseOperandType::SiblingRef) {
+                continue;
+            }
+
+            util::genAddToStrList(info.m_access.substr(0, info.m_access.find(".")), refs);
+        }
+        return;
+    }
+
+    if ((cond.parseKind() != commsdsl::parse::ParseOptCond::ParseKind::List)) {
+        [[maybe_unused]] static constexpr bool Should_not_happen = false;
+        assert(Should_not_happen);
+        return;
+    }
+
+    commsdsl::parse::ParseOptCondList listCond(cond);
+    for (auto& c : listCond.parseConditions()) {
+        commsSiblingRefsInternal(c, refs);
+    }
+}
+
 } // namespace
 
 CommsOptionalField::CommsOptionalField(CommsGenerator& generator, ParseField parseObj, GenElem* parent) :
@@ -687,6 +714,37 @@ void CommsOptionalField::commsAddMissingOnInvalidOptInternal(GenStringsList& opt
     }
 }
 
+std::string CommsOptionalField::commsPresenceCond(const CommsFieldsList& siblings) const
+{
+    auto c = genOptionalFieldParseObj().parseCond();
+    if (!c.parseValid()) {
+        return strings::genEmptyString();
+    }
+
+    return commsDslCondToStringInternal(siblings, c);
+}
+
+std::string CommsOptionalField::commsPresenceFieldAccess() const
+{
+    auto str = "field_" + comms::genAccessName(genName()) + "()";
+    if (commsIsVersionOptional()) {
+        str += ".field()";
+    }
+
+    return str;
+}
+
+CommsOptionalField::GenStringsList CommsOptionalField::commsPresenceSiblingRefs() const
+{
+    GenStringsList refs;
+    auto c = genOptionalFieldParseObj().parseCond();
+    if (c.parseValid()) {
+        commsSiblingRefsInternal(c, refs);
+    }
+
+    return refs;
+}
+
 std::string CommsOptionalField::commsDslCondToStringInternal(
     const CommsFieldsList& siblings,
     const commsdsl::parse::ParseOptCond& cond,
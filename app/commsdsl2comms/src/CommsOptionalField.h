@@ -40,6 +40,11 @@ public:
         const commsdsl::parse::ParseOptCond& cond,
         bool bracketsWrap = false);
 
+    // Support for the message level presence bitmask
+    std::string commsPresenceCond(const CommsFieldsList& siblings) const;
+    std::string commsPresenceFieldAccess() const;
+    GenStringsList commsPresenceSiblingRefs() const;
+
 protected:
     // GenBase overrides
     virtual bool genPrepareImpl() override;
@@ -171,4 +171,9 @@ std::string CommsPayloadLayer::commsCustomFieldBareMetalOptsImpl() const
     return util::genProcessTemplate(Templ, repl);
 }
 
+std::string CommsPayloadLayer::commsCustomFieldHighThroughputOptsImpl() const
+{
+    return commsCustomFieldDataViewOptsImpl();
+}
+
 } // namespace commsdsl2comms
@@ -45,6 +45,7 @@ protected:
     virtual std::string commsCustomFieldOptsImpl() const override;
     virtual std::string commsCustomFieldDataViewOptsImpl() const override;
     virtual std::string commsCustomFieldBareMetalOptsImpl() const override;
+    virtual std::string commsCustomFieldHighThroughputOptsImpl() const override;
 };
 
 } // namespace commsdsl2comms
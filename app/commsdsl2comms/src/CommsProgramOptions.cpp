@@ -31,6 +31,23 @@ const std::string CommsCustomizationStr("customization");
 const std::string CommsVersionIndependentCodeStr("version-independent-code");
 const std::string CommsExtraMessagesBundleStr("extra-messages-bundle");
 const std::string CommsForceMainNamespaceInOptionsStr("force-main-ns-in-options");
+const std::string CommsDispatchStrategyStr("dispatch-strategy");
+const std::string CommsMsgFactoryStrategyStr("msg-factory-strategy");
+const std::string CommsPoolMsgFactoriesStr("pool-msg-factories");
+const std::string CommsFixedLayoutMessagesStr("fixed-layout-messages");
+const std::string CommsBulkListsStr("bulk-lists");
+const std::string CommsLazyMessagesStr("lazy-messages");
+const std::string CommsPeekFunctionsStr("peek-functions");
+const std::string CommsPatchFunctionsStr("patch-functions");
+const std::string CommsSkipFunctionsStr("skip-functions");
+const std::string CommsLengthBoundsStr("length-bounds");
+const std::string CommsInPlaceStorageStr("in-place-storage");
+const std::string CommsSinglePassFrameWriteStr("single-pass-frame-write");
+const std::string CommsFastChecksumsStr("fast-checksums");
+const std::string CommsReflectionStr("reflection");
+const std::string CommsJsonEncodersStr("json-encoders");
+const std::string CommsMsgFrequencyProfileStr("msg-frequency-profile");
+const std::string CommsFixedRemoteVersionStr("fixed-remote-version");
 
 } // namespace
 
@@ -57,6 +74,79 @@ CommsProgramOptions::CommsProgramOptions()
             "Multiple bundles are separated by comma (\'Name1@ListFile1,Name2@ListFile2\').",
             true)
         (CommsForceMainNamespaceInOptionsStr, "Force having main namespace struct in generated options.")
+        (CommsDispatchStrategyStr,
+            "Implementation strategy of the generated message dispatch functions. Supported values are:\n"
+            "  * \"switch\" - Use switch statement on message ID.\n"
+            "  * \"table\" - Use function pointers table directly indexed by the message ID.\n"
+            "  * \"hash\" - Use function pointers table indexed by the minimal perfect hash of the message ID.\n"
+            "  * \"auto\" - Choose based on the distribution of the message IDs.",
+            std::string("switch"))
+        (CommsMsgFactoryStrategyStr,
+            "Implementation strategy of the generated message factories. Supported values are:\n"
+            "  * \"switch\" - Use switch statement on message ID.\n"
+            "  * \"table\" - Use constructor functions tables indexed by the message ID.\n"
+            "  * \"auto\" - Choose based on the number of message IDs.",
+            std::string("switch"))
+        (CommsPoolMsgFactoriesStr,
+            "Generate message factories allocating messages from fixed capacity pools "
+            "alongside the dynamic memory allocation ones.")
+        (CommsFixedLayoutMessagesStr,
+            "Generate read and write functions of the messages having fixed length fields only, "
+            "which check the available buffer length once and then read / write the fields "
+            "without checking the length of each one.")
+        (CommsBulkListsStr,
+            "Generate read and write functions of the lists having fixed length elements, "
+            "which check the available buffer length once and then read / write all the elements "
+            "without checking the length of each one.")
+        (CommsLazyMessagesStr,
+            "Generate messages recording the payload on read and decoding their fields "
+            "only when accessed. The input buffer must outlive such messages and "
+            "all the frames are required to delimit the message payload using size layer.")
+        (CommsPeekFunctionsStr,
+            "Generate static \"peek\" functions for the leading message fields having fixed offset "
+            "within the payload, which read the requested field from the raw payload without "
+            "reading the whole message.")
+        (CommsPatchFunctionsStr,
+            "Generate static \"patch\" functions for the leading message fields having fixed offset "
+            "within the payload, which update the field inside the serialized payload, as well as "
+            "\"updateChecksum\" function for the frames, which recalculates the checksum in place.")
+        (CommsSkipFunctionsStr,
+            "Generate static \"skip\" functions for fields and messages as well as \"scan\" "
+            "function for frames, which determine serialization length from the raw buffer "
+            "without reading the fields.")
+        (CommsLengthBoundsStr,
+            "Generate constexpr minimal and maximal serialization lengths of the messages "
+            "and frames as well as \"FrameMaxLengths.h\" header with maximal lengths of all the frames "
+            "defined in the namespace.")
+        (CommsInPlaceStorageStr,
+            "Generate storage types holding any message of the input bundle by value "
+            "as well as frame read functions constructing the message in such storage, "
+            "avoiding dynamic memory allocation and virtual functions.")
+        (CommsSinglePassFrameWriteStr,
+            "Generate frame size layers (with fixed length field) which reserve the size field, "
+            "write the rest of the frame and update the size value afterwards when the output "
+            "iterator is random-access, instead of calculating the message length in advance.")
+        (CommsFastChecksumsStr,
+            "Generate specialized table driven (CRC) and word-wise (sum / xor) checksum calculators "
+            "and use them in the checksum layers instead of the generic ones provided by the COMMS library.")
+        (CommsReflectionStr,
+            "Generate compile time reflection tables (names, kinds, fixed offsets, lengths, enum values "
+            "and bit positions of the fields) for every message as well as a generic visitor over them.")
+        (CommsJsonEncodersStr,
+            "Generate JSON and compact text encoders for every message, which write directly into "
+            "the caller provided buffer without using streams.")
+        (CommsMsgFrequencyProfileStr,
+            "Path to the messages frequency profile (CSV) file. Every line is expected to contain "
+            "the message ID (decimal) or the message name (as referenced in CommsDSL) followed by "
+            "the number of received messages ('ID,Count' or 'Name,Count'). The message dispatch "
+            "and factory code is ordered to check the most frequent messages first.",
+            true)
+        (CommsFixedRemoteVersionStr,
+            "Generate code for communication with the remote end of the specified (fixed) version only. "
+            "The fields which don't exist in such version are dropped, the rest are generated "
+            "without being optional and without any version dependent logic. "
+            "Implies schema version being forced and \"--version-independent-code\".",
+            true)
         ;
 }
 
@@ -80,4 +170,94 @@ bool CommsProgramOptions::commsIsMainNamespaceInOptionsForced() const
     return genIsOptUsed(CommsForceMainNamespaceInOptionsStr);
 }
 
+const std::string& CommsProgramOptions::commsGetDispatchStrategy() const
+{
+    return genValue(CommsDispatchStrategyStr);
+}
+
+const std::string& CommsProgramOptions::commsGetMsgFactoryStrategy() const
+{
+    return genValue(CommsMsgFactoryStrategyStr);
+}
+
+bool CommsProgramOptions::commsPoolMsgFactoriesRequested() const
+{
+    return genIsOptUsed(CommsPoolMsgFactoriesStr);
+}
+
+bool CommsProgramOptions::commsFixedLayoutMessagesRequested() const
+{
+    return genIsOptUsed(CommsFixedLayoutMessagesStr);
+}
+
+bool CommsProgramOptions::commsBulkListsRequested() const
+{
+    return genIsOptUsed(CommsBulkListsStr);
+}
+
+bool CommsProgramOptions::commsLazyMessagesRequested() const
+{
+    return genIsOptUsed(CommsLazyMessagesStr);
+}
+
+bool CommsProgramOptions::commsPeekFunctionsRequested() const
+{
+    return genIsOptUsed(CommsPeekFunctionsStr);
+}
+
+bool CommsProgramOptions::commsPatchFunctionsRequested() const
+{
+    return genIsOptUsed(CommsPatchFunctionsStr);
+}
+
+bool CommsProgramOptions::commsSkipFunctionsRequested() const
+{
+    return genIsOptUsed(CommsSkipFunctionsStr);
+}
+
+bool CommsProgramOptions::commsLengthBoundsRequested() const
+{
+    return genIsOptUsed(CommsLengthBoundsStr);
+}
+
+bool CommsProgramOptions::commsInPlaceStorageRequested() const
+{
+    return genIsOptUsed(CommsInPlaceStorageStr);
+}
+
+bool CommsProgramOptions::commsSinglePassFrameWriteRequested() const
+{
+    return genIsOptUsed(CommsSinglePassFrameWriteStr);
+}
+
+bool CommsProgramOptions::commsFastChecksumsRequested() const
+{
+    return genIsOptUsed(CommsFastChecksumsStr);
+}
+
+bool CommsProgramOptions::commsReflectionRequested() const
+{
+    return genIsOptUsed(CommsReflectionStr);
+}
+
+bool CommsProgramOptions::commsJsonEncodersRequested() const
+{
+    return genIsOptUsed(CommsJsonEncodersStr);
+}
+
+const std::string& CommsProgramOptions::commsGetMsgFrequencyProfile() const
+{
+    return genValue(CommsMsgFrequencyProfileStr);
+}
+
+bool CommsProgramOptions::commsHasFixedRemoteVersion() const
+{
+    return genIsOptUsed(CommsFixedRemoteVersionStr);
+}
+
+unsigned CommsProgramOptions::commsGetFixedRemoteVersion() const
+{
+    return commsdsl::gen::util::genStrToUnsigned(genValue(CommsFixedRemoteVersionStr));
+}
+
 } // namespace commsdsl2comms
@@ -41,6 +41,24 @@ public:
     bool commsVersionIndependentCodeRequested() const;
     std::vector<std::string> commsGetExtraInputBundles() const;
     bool commsIsMainNamespaceInOptionsForced() const;
+    const std::string& commsGetDispatchStrategy() const;
+    const std::string& commsGetMsgFactoryStrategy() const;
+    bool commsPoolMsgFactoriesRequested() const;
+    bool commsFixedLayoutMessagesRequested() const;
+    bool commsBulkListsRequested() const;
+    bool commsLazyMessagesRequested() const;
+    bool commsPeekFunctionsRequested() const;
+    bool commsPatchFunctionsRequested() const;
+    bool commsSkipFunctionsRequested() const;
+    bool commsLengthBoundsRequested() const;
+    bool commsInPlaceStorageRequested() const;
+    bool commsSinglePassFrameWriteRequested() const;
+    bool commsFastChecksumsRequested() const;
+    bool commsReflectionRequested() const;
+    bool commsJsonEncodersRequested() const;
+    const std::string& commsGetMsgFrequencyProfile() const;
+    bool commsHasFixedRemoteVersion() const;
+    unsigned commsGetFixedRemoteVersion() const;
 };
 
 } // namespace commsdsl2comms
\ No newline at end of file
@@ -0,0 +1,469 @@
+//
+// Copyright 2025 - 2025 (C). Alex Robenko. All rights reserved.
+//
+// SPDX-License-Identifier: Apache-2.0
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "CommsReflection.h"
+
+#include "CommsGenerator.h"
+#include "CommsMessage.h"
+#include "CommsSchema.h"
+
+#include "commsdsl/gen/GenBitfieldField.h"
+#include "commsdsl/gen/GenEnumField.h"
+#include "commsdsl/gen/GenSetField.h"
+#include "commsdsl/gen/comms.h"
+#include "commsdsl/gen/strings.h"
+#include "commsdsl/gen/util.h"
+
+#include <algorithm>
+#include <cassert>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace comms = commsdsl::gen::comms;
+namespace strings = commsdsl::gen::strings;
+namespace util = commsdsl::gen::util;
+
+namespace commsdsl2comms
+{
+
+namespace
+{
+
+using ParseField = commsdsl::parse::ParseField;
+using GenField = commsdsl::gen::GenField;
+
+const std::string CommsReflectionFileName("Reflection");
+const std::string CommsReflectionNamespace("reflection");
+
+const std::string& commsKindNameInternal(ParseField::ParseKind kind)
+{
+    static const std::string Map[] = {
+        /* Int */ "Int",
+        /* Enum */ "Enum",
+        /* Set */ "Set",
+        /* Float */ "Float",
+        /* Bitfield */ "Bitfield",
+        /* Bundle */ "Bundle",
+        /* String */ "String",
+        /* Data */ "Data",
+        /* List */ "List",
+        /* Ref */ "Ref",
+        /* Optional */ "Optional",
+        /* Variant */ "Variant",
+    };
+
+    static const std::size_t MapSize = std::extent<decltype(Map)>::value;
+    static_assert(MapSize == static_cast<std::size_t>(ParseField::ParseKind::NumOfValues), "Invalid map");
+
+    auto idx = static_cast<std::size_t>(kind);
+    if (MapSize <= idx) {
+        [[maybe_unused]] static constexpr bool Should_not_happen = false;
+        assert(Should_not_happen);
+        return strings::genEmptyString();
+    }
+
+    return Map[idx];
+}
+
+std::string commsNameInternal(const ParseField& parseObj)
+{
+    return '\"' + parseObj.parseName() + '\"';
+}
+
+std::string commsDisplayNameInternal(const ParseField& parseObj)
+{
+    return '\"' + util::genDisplayName(parseObj.parseDisplayName(), parseObj.parseName()) + '\"';
+}
+
+std::string commsLengthInternal(std::size_t value, const std::string& reflScope)
+{
+    if (value == comms::genMaxPossibleLength()) {
+        return reflScope + "::UnlimitedLength";
+    }
+
+    return util::genNumToString(value) + 'U';
+}
+
+std::string commsEnumValuesInternal(const GenField& field)
+{
+    util::GenStringsList values;
+    auto& enumField = static_cast<const commsdsl::gen::GenEnumField&>(field);
+    for (auto& info : enumField.genSortedRevValues()) {
+        assert(info.second != nullptr);
+        values.push_back("{\"" + *info.second + "\", " + util::genNumToString(info.first) + '}');
+    }
+
+    return util::genStrListToString(values, ",\n", "");
+}
+
+std::string commsBitsInternal(const GenField& field)
+{
+    util::GenStringsList bits;
+    auto parseObj = field.genParseObj();
+    if (parseObj.parseKind() == ParseField::ParseKind::Bitfield) {
+        // Members are listed starting from the least significant bits
+        std::size_t offset = 0U;
+        auto& bitfield = static_cast<const commsdsl::gen::GenBitfieldField&>(field);
+        for (auto& m : bitfield.genMembers()) {
+            auto bitLength = m->genParseObj().parseBitLength();
+            bits.push_back(
+                "{\"" + m->genParseObj().parseName() + "\", " + std::to_string(offset) + "U, " +
+                std::to_string(bitLength) + "U}");
+            offset += bitLength;
+        }
+
+        return util::genStrListToString(bits, ",\n", "");
+    }
+
+    assert(parseObj.parseKind() == ParseField::ParseKind::Set);
+    using ParseBitsPtr = std::pair<const std::string*, unsigned>;
+    std::vector<ParseBitsPtr> sortedBits;
+    for (auto& b : commsdsl::parse::ParseSetField(parseObj).parseBits()) {
+        if (b.second.m_reserved) {
+            continue;
+        }
+
+        sortedBits.emplace_back(&b.first, b.second.m_idx);
+    }
+
+    std::sort(
+        sortedBits.begin(), sortedBits.end(),
+        [](const ParseBitsPtr& first, const ParseBitsPtr& second)
+        {
+            return first.second < second.second;
+        });
+
+    for (auto& b : sortedBits) {
+        bits.push_back("{\"" + *b.first + "\", " + std::to_string(b.second) + "U, 1U}");
+    }
+
+    return util::genStrListToString(bits, ",\n", "");
+}
+
+} // namespace
+
+bool CommsReflection::commsWrite(CommsGenerator& generator)
+{
+    if (!generator.commsGetReflection()) {
+        return true;
+    }
+
+    auto& thisSchema = static_cast<const CommsSchema&>(generator.genCurrentSchema());
+    if ((!generator.genIsCurrentProtocolSchema()) && (!thisSchema.commsHasAnyGeneratedCode())) {
+        return true;
+    }
+
+    CommsReflection obj(generator);
+    return obj.commsWriteInternal();
+}
+
+bool CommsReflection::commsWriteMessage(const CommsGenerator& generator, const CommsMessage& msg)
+{
+    if (!generator.commsGetReflection()) {
+        return true;
+    }
+
+    CommsReflection obj(generator);
+    return obj.commsWriteMessageInternal(msg);
+}
+
+bool CommsReflection::commsWriteInternal() const
+{
+    auto filePath = comms::genHeaderPathRoot(CommsReflectionFileName, m_commsGenerator);
+    m_commsGenerator.genLogger().genInfo("Generating " + filePath);
+
+    auto dirPath = util::genPathUp(filePath);
+    assert(!dirPath.empty());
+    if (!m_commsGenerator.genCreateDirectory(dirPath)) {
+        return false;
+    }
+
+    const std::string Templ =
+        "#^#GENERATED#$#\n"
+        "/// @file\n"
+        "/// @brief Contains definition of the compile time reflection types.\n\n"
+        "#pragma once\n\n"
+        "#include <cstddef>\n"
+        "#include <cstdint>\n\n"
+        "namespace #^#PROT_NAMESPACE#$#\n"
+        "{\n\n"
+        "namespace #^#REFL_NAMESPACE#$#\n"
+        "{\n\n"
+        "/// @brief Kind of the reflected field.\n"
+        "enum class FieldKind : std::uint8_t\n"
+        "{\n"
+        "    #^#KINDS#$#\n"
+        "    NumOfValues ///< Limit for the values\n"
+        "};\n\n"
+        "/// @brief Offset value of the field which doesn't have a fixed offset within the message.\n"
+        "constexpr std::size_t NoOffset = static_cast<std::size_t>(-1);\n\n"
+        "/// @brief Maximal length value of the field or message which doesn't have a length limit.\n"
+        "constexpr std::size_t UnlimitedLength = static_cast<std::size_t>(-1);\n\n"
+        "/// @brief Name and numeric value of a single enum value.\n"
+        "struct EnumValueInfo\n"
+        "{\n"
+        "    const char* m_name; ///< Name of the value\n"
+        "    std::intmax_t m_value; ///< Numeric value\n"
+        "};\n\n"
+        "/// @brief Name and position of the bitfield member or the set field bit.\n"
+        "struct BitsInfo\n"
+        "{\n"
+        "    const char* m_name; ///< Name of the member or bit\n"
+        "    unsigned m_bitOffset; ///< Offset from the least significant bit\n"
+        "    unsigned m_bitLength; ///< Number of bits, always 1 for the set field bit\n"
+        "};\n\n"
+        "/// @brief Reflection information of the message field.\n"
+        "struct FieldInfo\n"
+        "{\n"
+        "    const char* m_name; ///< Name of the field\n"
+        "    const char* m_displayName; ///< Display name of the field\n"
+        "    FieldKind m_kind; ///< Kind of the field, references are reported as the referenced field\n"
+        "    std::size_t m_offset; ///< Offset within the message payload or @ref NoOffset\n"
+        "    std::size_t m_minLength; ///< Minimal serialisation length\n"
+        "    std::size_t m_maxLength; ///< Maximal serialisation length or @ref UnlimitedLength\n"
+        "    const EnumValueInfo* m_enumValues; ///< Values of the enum field, nullptr for other kinds\n"
+        "    std::size_t m_enumValuesCount; ///< Number of elements in @ref m_enumValues\n"
+        "    const BitsInfo* m_bits; ///< Members of the bitfield or bits of the set field, nullptr for other kinds\n"
+        "    std::size_t m_bitsCount; ///< Number of elements in @ref m_bits\n"
+        "};\n\n"
+        "/// @brief Reflection information of the message.\n"
+        "struct MessageInfo\n"
+        "{\n"
+        "    const char* m_name; ///< Name of the message\n"
+        "    const char* m_displayName; ///< Display name of the message\n"
+        "    const FieldInfo* m_fields; ///< Fields of the message, nullptr when there are none\n"
+        "    std::size_t m_fieldsCount; ///< Number of elements in @ref m_fields\n"
+        "    std::size_t m_minLength; ///< Minimal payload length\n"
+        "    std::size_t m_maxLength; ///< Maximal payload length or @ref UnlimitedLength\n"
+        "};\n\n"
+        "/// @brief Invoke the visitor for every field of the message.\n"
+        "/// @details The visitor is expected to define the following operator:\n"
+        "///     @code\n"
+        "///     void operator()(std::size_t idx, const FieldInfo& info);\n"
+        "///     @endcode\n"
+        "template <typename TVisitor>\n"
+        "void visitFields(const MessageInfo& info, TVisitor&& visitor)\n"
+        "{\n"
+        "    for (std::size_t idx = 0U; idx < info.m_fieldsCount; ++idx) {\n"
+        "        visitor(idx, info.m_fields[idx]);\n"
+        "    }\n"
+        "}\n\n"
+        "} // namespace #^#REFL_NAMESPACE#$#\n\n"
+        "} // namespace #^#PROT_NAMESPACE#$#\n";
+
+    util::GenStringsList kinds;
+    for (auto idx = 0U; idx < static_cast<unsigned>(ParseField::ParseKind::NumOfValues); ++idx) {
+        auto& name = commsKindNameInternal(static_cast<ParseField::ParseKind>(idx));
+        kinds.push_back(name + ", ///< @b " + name + " field");
+    }
+
+    util::GenReplacementMap repl = {
+        {"GENERATED", CommsGenerator::commsFileGeneratedComment()},
+        {"PROT_NAMESPACE", m_commsGenerator.genCurrentSchema().genMainNamespace()},
+        {"REFL_NAMESPACE", CommsReflectionNamespace},
+        {"KINDS", util::genStrListToString(kinds, "\n", "")},
+    };
+
+    return m_commsGenerator.genWriteFile(filePath, util::genProcessTemplate(Templ, repl, true));
+}
+
+bool CommsReflection::commsWriteMessageInternal(const CommsMessage& msg) const
+{
+    auto className = comms::genClassName(msg.genParseObj().parseName()) + "Reflection";
+    auto filePath = msg.commsSiblingHeaderPath(className);
+
+    m_commsGenerator.genLogger().genInfo("Generating " + filePath);
+
+    auto dirPath = util::genPathUp(filePath);
+    assert(!dirPath.empty());
+    if (!m_commsGenerator.genCreateDirectory(dirPath)) {
+        return false;
+    }
+
+    const std::string Templ =
+        "#^#GENERATED#$#\n"
+        "/// @file\n"
+        "/// @brief Contains compile time reflection tables of @ref #^#SCOPE#$# message.\n\n"
+        "#pragma once\n\n"
+        "#^#INCLUDES#$#\n"
+        "#^#NS_BEGIN#$#\n"
+        "/// @brief Compile time reflection tables of @ref #^#SCOPE#$# message.\n"
+        "/// @tparam TUnused Unused parameter, allows definition of the tables in the header.\n"
+        "template <typename TUnused = void>\n"
+        "struct #^#CLASS_NAME#$#T\n"
+        "{\n"
+        "    /// @brief Number of the message fields.\n"
+        "    static constexpr std::size_t fieldsCount()\n"
+        "    {\n"
+        "        return #^#FIELDS_COUNT#$#;\n"
+        "    }\n\n"
+        "    #^#TABLES#$#\n"
+        "    /// @brief Reflection information of the message.\n"
+        "    static constexpr #^#REFL_SCOPE#$#::MessageInfo Info = {\n"
+        "        #^#INFO#$#\n"
+        "    };\n\n"
+        "    /// @brief Invoke the visitor for every field of the message.\n"
+        "    /// @details See @ref #^#REFL_SCOPE#$#::visitFields() for the visitor requirements.\n"
+        "    template <typename TVisitor>\n"
+        "    static void visit(TVisitor&& visitor)\n"
+        "    {\n"
+        "        #^#REFL_SCOPE#$#::visitFields(Info, std::forward<TVisitor>(visitor));\n"
+        "    }\n"
+        "};\n\n"
+        "#^#DEFS#$#\n"
+        "/// @brief Compile time reflection tables of @ref #^#SCOPE#$# message.\n"
+        "using #^#CLASS_NAME#$# = #^#CLASS_NAME#$#T<>;\n\n"
+        "#^#NS_END#$#\n";
+
+    auto& gen = m_commsGenerator;
+    auto reflScope = comms::genScopeForRoot(CommsReflectionNamespace, gen);
+    auto& fields = msg.commsFields();
+    auto fixedCount = msg.commsFixedOffsetFieldsCount();
+
+    util::GenStringsList tables;
+    util::GenStringsList defs;
+    util::GenStringsList fieldsInfo;
+    std::size_t offset = 0U;
+    for (auto idx = 0U; idx < fields.size(); ++idx) {
+        auto* f = fields[idx];
+        auto& genField = f->commsGenField();
+        auto parseObj = genField.genParseObj();
+        auto& resolved = CommsField::commsResolvedField(genField);
+        auto kind = resolved.genParseObj().parseKind();
+        auto accName = comms::genAccessName(parseObj.parseName());
+
+        std::string enumValues = "nullptr, 0U";
+        std::string bits = "nullptr, 0U";
+        auto addTableFunc =
+            [&tables, &defs, &reflScope, &className](const std::string& type, const std::string& name, const std::string& body, const std::string& desc)
+            {
+                static const std::string TableTempl =
+                    "/// @brief #^#DESC#$#\n"
+                    "static constexpr #^#REFL_SCOPE#$#::#^#TYPE#$# #^#NAME#$#[] = {\n"
+                    "    #^#BODY#$#\n"
+                    "};\n";
+
+                util::GenReplacementMap tableRepl = {
+                    {"DESC", desc},
+                    {"REFL_SCOPE", reflScope},
+                    {"TYPE", type},
+                    {"NAME", name},
+                    {"BODY", body},
+                };
+
+                tables.push_back(util::genProcessTemplate(TableTempl, tableRepl));
+                defs.push_back(
+                    "template <typename TUnused>\n"
+                    "constexpr " + reflScope + "::" + type + ' ' + className + "T<TUnused>::" + name + "[];\n");
+            };
+
+        if (kind == ParseField::ParseKind::Enum) {
+            auto name = "EnumValues_" + accName;
+            addTableFunc("EnumValueInfo", name, commsEnumValuesInternal(resolved), "Values of the @b " + parseObj.parseName() + " field.");
+            enumValues = name + ", sizeof(" + name + ") / sizeof(" + name + "[0])";
+        }
+
+        if ((kind == ParseField::ParseKind::Bitfield) || (kind == ParseField::ParseKind::Set)) {
+            auto body = commsBitsInternal(resolved);
+            if (!body.empty()) {
+                auto name = "Bits_" + accName;
+                auto desc =
+                    (kind == ParseField::ParseKind::Bitfield) ?
+                        "Members of the @b " + parseObj.parseName() + " field." :
+                        "Bits of the @b " + parseObj.parseName() + " field.";
+                addTableFunc("BitsInfo", name, body, desc);
+                bits = name + ", sizeof(" + name + ") / sizeof(" + name + "[0])";
+            }
+        }
+
+        std::string offsetStr = reflScope + "::NoOffset";
+        if (idx <= fixedCount) {
+            offsetStr = util::genNumToString(offset) + 'U';
+            offset += f->commsMinLength();
+        }
+
+        fieldsInfo.push_back(
+            "{" +
+            commsNameInternal(parseObj) + ", " +
+            commsDisplayNameInternal(parseObj) + ", " +
+            reflScope + "::FieldKind::" + commsKindNameInternal(kind) + ", " +
+            offsetStr + ", " +
+            commsLengthInternal(f->commsMinLength(), reflScope) + ", " +
+            commsLengthInternal(f->commsMaxLength(), reflScope) + ", " +
+            enumValues + ", " +
+            bits + "}");
+    }
+
+    std::string fieldsPtr = "nullptr";
+    if (!fieldsInfo.empty()) {
+        static const std::string FieldsTempl =
+            "/// @brief Reflection information of the message fields.\n"
+            "static constexpr #^#REFL_SCOPE#$#::FieldInfo Fields[] = {\n"
+            "    #^#FIELDS#$#\n"
+            "};\n";
+
+        util::GenReplacementMap fieldsRepl = {
+            {"REFL_SCOPE", reflScope},
+            {"FIELDS", util::genStrListToString(fieldsInfo, ",\n", "")},
+        };
+
+        tables.push_back(util::genProcessTemplate(FieldsTempl, fieldsRepl));
+        defs.push_back(
+            "template <typename TUnused>\n"
+            "constexpr " + reflScope + "::FieldInfo " + className + "T<TUnused>::Fields[];\n");
+        fieldsPtr = "Fields";
+    }
+
+    defs.push_back(
+        "template <typename TUnused>\n"
+        "constexpr " + reflScope + "::MessageInfo " + className + "T<TUnused>::Info;\n");
+
+    auto msgParseObj = msg.genParseObj();
+    util::GenStringsList info = {
+        '\"' + msgParseObj.parseName() + '\"',
+        '\"' + util::genDisplayName(msgParseObj.parseDisplayName(), msgParseObj.parseName()) + '\"',
+        fieldsPtr,
+        std::to_string(fields.size()) + 'U',
+        commsLengthInternal(msg.commsMinLength(), reflScope),
+        commsLengthInternal(msg.commsMaxLength(), reflScope),
+    };
+
+    util::GenStringsList includes = {
+        "<cstddef>",
+        "<utility>",
+        comms::genRelHeaderForRoot(CommsReflectionFileName, gen),
+    };
+    comms::genPrepareIncludeStatement(includes);
+
+    util::GenReplacementMap repl = {
+        {"GENERATED", CommsGenerator::commsFileGeneratedComment()},
+        {"SCOPE", comms::genScopeFor(msg, gen)},
+        {"INCLUDES", util::genStrListToString(includes, "\n", "\n")},
+        {"NS_BEGIN", comms::genNamespaceBeginFor(msg, gen)},
+        {"NS_END", comms::genNamespaceEndFor(msg, gen)},
+        {"CLASS_NAME", className},
+        {"FIELDS_COUNT", std::to_string(fields.size()) + 'U'},
+        {"TABLES", util::genStrListToString(tables, "\n", "\n")},
+        {"REFL_SCOPE", reflScope},
+        {"INFO", util::genStrListToString(info, ",\n", "")},
+        {"DEFS", util::genStrListToString(defs, "\n", "\n")},
+    };
+
+    return gen.genWriteFile(filePath, util::genProcessTemplate(Templ, repl, true));
+}
+
+} // namespace commsdsl2comms
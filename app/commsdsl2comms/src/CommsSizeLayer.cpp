@@ -44,6 +44,15 @@ CommsSizeLayer::CommsIncludesList CommsSizeLayer::commsDefIncludesImpl() const
         "comms/frame/MsgSizeLayer.h"
     };
 
+    if (commsIsSinglePassWriteInternal()) {
+        result.insert(result.end(), {
+            "<cstddef>",
+            "<iterator>",
+            "<type_traits>",
+            "comms/ErrorStatus.h",
+        });
+    }
+
     return result;
 }
 
@@ -64,4 +73,78 @@ std::string CommsSizeLayer::commsDefBaseTypeImpl(const std::string& prevName) co
     return util::genProcessTemplate(Templ, repl);
 }
 
+std::string CommsSizeLayer::commsDefPublicCodeImpl() const
+{
+    if (!commsIsSinglePassWriteInternal()) {
+        return std::string();
+    }
+
+    static const std::string Templ =
+        "/// @brief Serialize the message with all the inner layers in a single pass.\n"
+        "/// @details When the output iterator is random-access the size field is\n"
+        "///     reserved, the inner layers are written and the size value is updated\n"
+        "///     afterwards instead of calculating the message length in advance.\n"
+        "///     Other iterators are handled by the default implementation.\n"
+        "template <typename TMsg, typename TIter>\n"
+        "comms::ErrorStatus write(const TMsg& msg, TIter& iter, std::size_t size) const\n"
+        "{\n"
+        "    using IterType = typename std::decay<decltype(iter)>::type;\n"
+        "    using IterTag = typename std::iterator_traits<IterType>::iterator_category;\n"
+        "    return writeInternal(msg, iter, size, std::is_base_of<std::random_access_iterator_tag, IterTag>());\n"
+        "}";
+
+    return Templ;
+}
+
+std::string CommsSizeLayer::commsDefPrivateCodeImpl() const
+{
+    if (!commsIsSinglePassWriteInternal()) {
+        return std::string();
+    }
+
+    static const std::string Templ =
+        "template <typename TMsg, typename TIter>\n"
+        "comms::ErrorStatus writeInternal(const TMsg& msg, TIter& iter, std::size_t size, std::true_type) const\n"
+        "{\n"
+        "    typename Base::Field field;\n"
+        "    auto fieldIter = iter;\n"
+        "    auto es = field.write(iter, size);\n"
+        "    if (es != comms::ErrorStatus::Success) {\n"
+        "        return es;\n"
+        "    }\n\n"
+        "    auto dataIter = iter;\n"
+        "    es = Base::nextLayer().write(msg, iter, size - field.length());\n"
+        "    if (es != comms::ErrorStatus::Success) {\n"
+        "        return es;\n"
+        "    }\n\n"
+        "    field.setValue(static_cast<std::size_t>(std::distance(dataIter, iter)));\n"
+        "    return field.write(fieldIter, field.length());\n"
+        "}\n\n"
+        "template <typename TMsg, typename TIter>\n"
+        "comms::ErrorStatus writeInternal(const TMsg& msg, TIter& iter, std::size_t size, std::false_type) const\n"
+        "{\n"
+        "    return Base::write(msg, iter, size);\n"
+        "}";
+
+    return Templ;
+}
+
+bool CommsSizeLayer::commsIsSinglePassWriteInternal() const
+{
+    auto& gen = CommsGenerator::commsCast(genGenerator());
+    if (!gen.commsGetSinglePassFrameWrite()) {
+        return false;
+    }
+
+    // The size value is updated in place, the serialization length of the
+    // field mustn't depend on the value.
+    auto* field = commsExternalField();
+    if (field == nullptr) {
+        field = commsMemberField();
+    }
+
+    assert(field != nullptr);
+    return field->commsMinLength() == field->commsMaxLength();
+}
+
 } // namespace commsdsl2comms
@@ -41,6 +41,11 @@ protected:
     // CommsBase overrides
     virtual CommsIncludesList commsDefIncludesImpl() const override;
     virtual std::string commsDefBaseTypeImpl(const std::string& prevName) const override;
+    virtual std::string commsDefPublicCodeImpl() const override;
+    virtual std::string commsDefPrivateCodeImpl() const override;
+
+private:
+    bool commsIsSinglePassWriteInternal() const;
 };
 
 } // namespace commsdsl2comms
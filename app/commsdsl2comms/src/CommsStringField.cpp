@@ -95,6 +95,10 @@ CommsStringField::CommsIncludesList CommsStringField::commsDefIncludesImpl() con
                 "comms/field/IntValue.h",
                 "<cstdint>"
             });
+
+            if (CommsGenerator::commsCast(genGenerator()).commsGetSkipFunctions()) {
+                result.push_back("<cstring>");
+            }
         }
 
         auto& validValues = obj.parseValidValues();
@@ -329,6 +333,52 @@ std::string CommsStringField::commsDefValidFuncBodyImpl() const
     return util::genProcessTemplate(Templ, repl);
 }
 
+std::string CommsStringField::commsDefSkipFuncBodyImpl() const
+{
+    auto obj = genStringFieldParseObj();
+    if ((!obj.parseDetachedPrefixFieldName().empty()) ||
+        (obj.parseFixedLength() != 0U)) {
+        return strings::genEmptyString();
+    }
+
+    if ((m_commsMemberPrefixField != nullptr) || (m_commsExternalPrefixField != nullptr)) {
+        static const std::string Templ =
+            "#^#PREFIX_TYPE#$# prefix;\n"
+            "auto iter = buf;\n"
+            "auto es = prefix.read(iter, len);\n"
+            "if (es != comms::ErrorStatus::Success) {\n"
+            "    return es;\n"
+            "}\n\n"
+            "auto prefixLen = static_cast<std::size_t>(iter - buf);\n"
+            "auto dataLen = static_cast<std::size_t>(prefix.getValue());\n"
+            "if ((len - prefixLen) < dataLen) {\n"
+            "    return comms::ErrorStatus::NotEnoughData;\n"
+            "}\n\n"
+            "consumed = prefixLen + dataLen;\n"
+            "return comms::ErrorStatus::Success;";
+
+        util::GenReplacementMap repl = {
+            {"PREFIX_TYPE", commsPrefixTypeInternal()},
+        };
+
+        return util::genProcessTemplate(Templ, repl);
+    }
+
+    if (obj.parseHasZeroTermSuffix()) {
+        return
+            "auto* term = static_cast<const std::uint8_t*>(std::memchr(buf, 0, len));\n"
+            "if (term == nullptr) {\n"
+            "    return comms::ErrorStatus::NotEnoughData;\n"
+            "}\n\n"
+            "consumed = static_cast<std::size_t>(term - buf) + 1U;\n"
+            "return comms::ErrorStatus::Success;";
+    }
+    return
+        "static_cast<void>(buf);\n"
+        "consumed = len;\n"
+        "return comms::ErrorStatus::Success;";
+}
+
 bool CommsStringField::commsIsLimitedCustomizableImpl() const
 {
     return true;
@@ -352,6 +402,12 @@ CommsStringField::GenStringsList CommsStringField::commsExtraDataViewDefaultOpti
         };
 }
 
+CommsStringField::GenStringsList CommsStringField::commsExtraHighThroughputDefaultOptionsImpl() const
+{
+    // The view on the input buffer is cheaper than any storage
+    return commsExtraDataViewDefaultOptionsImpl();
+}
+
 CommsStringField::GenStringsList CommsStringField::commsExtraBareMetalDefaultOptionsImpl() const
 {
     auto obj = genStringFieldParseObj();
@@ -477,22 +533,28 @@ void CommsStringField::commsAddLengthPrefixOptInternal(GenStringsList& opts) con
         return;
     }
 
-    std::string prefixName;
+    auto prefixName = commsPrefixTypeInternal();
+    if (m_commsMemberPrefixField == nullptr) {
+        prefixName += ' ';
+    }
+
+    opts.push_back("comms::option::def::SequenceSerLengthFieldPrefix<" + prefixName + '>');
+}
+
+std::string CommsStringField::commsPrefixTypeInternal() const
+{
     if (m_commsMemberPrefixField != nullptr) {
-        prefixName = "typename " + comms::genClassName(genName()) + strings::genMembersSuffixStr();
+        auto prefixName = "typename " + comms::genClassName(genName()) + strings::genMembersSuffixStr();
         if (comms::genIsGlobalField(*this)) {
             prefixName += "<TOpt>";
         }
 
         prefixName += "::" + comms::genClassName(m_commsMemberPrefixField->commsGenField().genName());
-    }
-    else {
-        assert(m_commsExternalPrefixField != nullptr);
-        prefixName = comms::genScopeFor(m_commsExternalPrefixField->commsGenField(), genGenerator(), true, true);
-        prefixName += "<TOpt> ";
+        return prefixName;
     }
 
-    opts.push_back("comms::option::def::SequenceSerLengthFieldPrefix<" + prefixName + '>');
+    assert(m_commsExternalPrefixField != nullptr);
+    return comms::genScopeFor(m_commsExternalPrefixField->commsGenField(), genGenerator(), true, true) + "<TOpt>";
 }
 
 void CommsStringField::commsAddTermSuffixOptInternal(GenStringsList& opts) const
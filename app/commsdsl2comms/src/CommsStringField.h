@@ -50,10 +50,12 @@ protected:
     virtual std::string commsDefBundledReadPrepareFuncBodyImpl(const CommsFieldsList& siblings) const override;
     virtual std::string commsDefBundledRefreshFuncBodyImpl(const CommsFieldsList& siblings) const override;
     virtual std::string commsDefValidFuncBodyImpl() const override;
+    virtual std::string commsDefSkipFuncBodyImpl() const override;
     virtual bool commsIsLimitedCustomizableImpl() const override;
     virtual std::string commsMembersCustomizationOptionsBodyImpl(CommsFieldOptsFunc fieldOptsFunc) const override;
     virtual GenStringsList commsExtraDataViewDefaultOptionsImpl() const override;
     virtual GenStringsList commsExtraBareMetalDefaultOptionsImpl() const override;
+    virtual GenStringsList commsExtraHighThroughputDefaultOptionsImpl() const override;
     virtual std::size_t commsMaxLengthImpl() const override;
     virtual std::string commsSizeAccessStrImpl(const std::string& accStr, const std::string& prefix) const override;
     virtual std::string commsCompValueCastTypeImpl(const std::string& accStr, const std::string& prefix) const override;
@@ -64,6 +66,7 @@ private:
 
     void commsAddFixedLengthOptInternal(GenStringsList& opts) const;
     void commsAddLengthPrefixOptInternal(GenStringsList& opts) const;
+    std::string commsPrefixTypeInternal() const;
     void commsAddTermSuffixOptInternal(GenStringsList& opts) const;
     void commsAddLengthForcingOptInternal(GenStringsList& opts) const;
 
@@ -24,7 +24,6 @@
 #include "commsdsl/gen/comms.h"
 
 #include <cassert>
-#include <fstream>
 
 namespace comms = commsdsl::gen::comms;
 namespace strings = commsdsl::gen::strings;
@@ -49,12 +48,6 @@ bool CommsVersion::commsWriteInternal() const
     auto filePath = comms::genHeaderPathRoot(strings::genVersionFileNameStr(), m_commsGenerator);
 
     m_commsGenerator.genLogger().genInfo("Generating " + filePath);
-    std::ofstream stream(filePath);
-    if (!stream) {
-        m_commsGenerator.genLogger().genError("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
-
     const std::string Templ =
         "#^#GENERATED#$#\n"
         "/// @file\n"
@@ -89,11 +82,7 @@ bool CommsVersion::commsWriteInternal() const
         {"APPEND", m_commsGenerator.genReadCodeInjectCode(comms::genInputCodeRelPathForRoot(strings::genVersionFileNameStr(), m_commsGenerator) + strings::genAppendFileSuffixStr(), "Append here")},
     };
 
-    stream << util::genProcessTemplate(Templ, repl, true);
-    stream.flush();
-
-    if (!stream.good()) {
-        m_commsGenerator.genLogger().genError("Failed to write \"" + filePath + "\".");
+    if (!m_commsGenerator.genWriteFile(filePath, util::genProcessTemplate(Templ, repl, true))) {
         return false;
     }
 
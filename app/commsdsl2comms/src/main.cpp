@@ -17,6 +17,8 @@
 #include "CommsProgramOptions.h"
 #include "CommsGenerator.h"
 
+#include "commsdsl/gen/GenWatcher.h"
+
 #include <stdexcept>
 #include <iostream>
 #include <cassert>
@@ -27,8 +29,7 @@ int main(int argc, const char* argv[])
         commsdsl2comms::CommsProgramOptions options;
         options.genParse(argc, argv);
 
-        commsdsl2comms::CommsGenerator generator;
-        return generator.genExec(options);
+        return commsdsl::gen::GenWatcher::genRun<commsdsl2comms::CommsGenerator>(options);
     }
     catch (const std::exception& e) {
         std::cerr << "Unhandled exception: " << e.what() << std::endl;
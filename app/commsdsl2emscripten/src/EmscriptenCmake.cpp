@@ -27,7 +27,6 @@
 #include "commsdsl/gen/util.h"
 
 #include <cassert>
-#include <fstream>
 
 namespace comms = commsdsl::gen::comms;
 namespace strings = commsdsl::gen::strings;
@@ -52,12 +51,6 @@ bool EmscriptenCmake::emscriptenWriteInternal() const
     }
 
     m_emscriptenGenerator.genLogger().genInfo("Generating " + filePath);
-    std::ofstream stream(filePath);
-    if (!stream) {
-        m_emscriptenGenerator.genLogger().genError("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
-
     const std::string Templ =
         "cmake_minimum_required (VERSION 3.12)\n"
         "project (#^#PROJ_NAME#$#_emscripten)\n\n"
@@ -143,10 +136,7 @@ bool EmscriptenCmake::emscriptenWriteInternal() const
     };
 
     auto str = commsdsl::gen::util::genProcessTemplate(Templ, repl, true);
-    stream << str;
-    stream.flush();
-    if (!stream.good()) {
-        m_emscriptenGenerator.genLogger().genError("Failed to write " + filePath + ".");
+    if (!m_emscriptenGenerator.genWriteFile(filePath, str)) {
         return false;
     }
 
@@ -23,7 +23,6 @@
 #include "commsdsl/gen/util.h"
 
 #include <cassert>
-#include <fstream>
 
 namespace comms = commsdsl::gen::comms;
 namespace strings = commsdsl::gen::strings;
@@ -65,12 +64,6 @@ bool EmscriptenComms::emscriptenWriteErrorStatusInternal() const
     }
 
     m_emscriptenGenerator.genLogger().genInfo("Generating " + filePath);
-    std::ofstream stream(filePath);
-    if (!stream) {
-        m_emscriptenGenerator.genLogger().genError("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
-
     const std::string Values[] = {
         "Success",
         "UpdateRequired",
@@ -115,10 +108,7 @@ bool EmscriptenComms::emscriptenWriteErrorStatusInternal() const
     };
 
     auto str = commsdsl::gen::util::genProcessTemplate(Templ, repl, true);
-    stream << str;
-    stream.flush();
-    if (!stream.good()) {
-        m_emscriptenGenerator.genLogger().genError("Failed to write \"" + filePath + "\".");
+    if (!m_emscriptenGenerator.genWriteFile(filePath, str)) {
         return false;
     }
 
@@ -136,12 +126,6 @@ bool EmscriptenComms::emscriptenWriteOptionalModeInternal() const
     }
 
     m_emscriptenGenerator.genLogger().genInfo("Generating " + filePath);
-    std::ofstream stream(filePath);
-    if (!stream) {
-        m_emscriptenGenerator.genLogger().genError("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
-
     const std::string Values[] = {
         "Tentative",
         "Exists",
@@ -180,10 +164,7 @@ bool EmscriptenComms::emscriptenWriteOptionalModeInternal() const
     };
 
     auto str = commsdsl::gen::util::genProcessTemplate(Templ, repl, true);
-    stream << str;
-    stream.flush();
-    if (!stream.good()) {
-        m_emscriptenGenerator.genLogger().genError("Failed to write \"" + filePath + "\".");
+    if (!m_emscriptenGenerator.genWriteFile(filePath, str)) {
         return false;
     }
 
@@ -21,7 +21,6 @@
 #include "commsdsl/gen/util.h"
 
 #include <cassert>
-#include <fstream>
 
 namespace util = commsdsl::gen::util;
 
@@ -80,12 +79,6 @@ bool EmscriptenDataBuf::emscriptenWriteHeaderInternal() const
     }
 
     m_emscriptenGenerator.genLogger().genInfo("Generating " + filePath);
-    std::ofstream stream(filePath);
-    if (!stream) {
-        m_emscriptenGenerator.genLogger().genError("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
-
     const std::string Templ =
         "#^#GENERATED#$#\n\n"
         "#include <cstdint>\n"
@@ -104,10 +97,7 @@ bool EmscriptenDataBuf::emscriptenWriteHeaderInternal() const
     };
 
     auto str = commsdsl::gen::util::genProcessTemplate(Templ, repl, true);
-    stream << str;
-    stream.flush();
-    if (!stream.good()) {
-        m_emscriptenGenerator.genLogger().genError("Failed to write \"" + filePath + "\".");
+    if (!m_emscriptenGenerator.genWriteFile(filePath, str)) {
         return false;
     }
 
@@ -124,12 +114,6 @@ bool EmscriptenDataBuf::emscriptenWriteSrcInternal() const
     }
 
     m_emscriptenGenerator.genLogger().genInfo("Generating " + filePath);
-    std::ofstream stream(filePath);
-    if (!stream) {
-        m_emscriptenGenerator.genLogger().genError("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
-
     const std::string Templ =
         "#^#GENERATED#$#\n\n"
         "#include \"#^#HEADER#$#\"\n\n"
@@ -158,10 +142,7 @@ bool EmscriptenDataBuf::emscriptenWriteSrcInternal() const
     };
 
     auto str = commsdsl::gen::util::genProcessTemplate(Templ, repl, true);
-    stream << str;
-    stream.flush();
-    if (!stream.good()) {
-        m_emscriptenGenerator.genLogger().genError("Failed to write \"" + filePath + "\".");
+    if (!m_emscriptenGenerator.genWriteFile(filePath, str)) {
         return false;
     }
 
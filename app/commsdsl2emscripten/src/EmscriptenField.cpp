@@ -28,7 +28,6 @@
 
 #include <algorithm>
 #include <cassert>
-#include <fstream>
 
 namespace comms = commsdsl::gen::comms;
 namespace strings = commsdsl::gen::strings;
@@ -450,12 +449,6 @@ bool EmscriptenField::emscriptenWriteHeaderInternal() const
     auto& logger = generator.genLogger();
     logger.genInfo("Generating " + filePath);
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        logger.genError("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
-
     static const std::string Templ =
         "#^#GENERATED#$#\n\n"
         "#pragma once\n\n"
@@ -471,9 +464,7 @@ bool EmscriptenField::emscriptenWriteHeaderInternal() const
         {"APPEND", generator.genReadCodeInjectCode(strings::genIncludeDirStr() + '/' + generator.emscriptenRelHeaderFor(m_genField) + strings::genAppendFileSuffixStr(), "Append here")},
     };
 
-    stream << util::genProcessTemplate(Templ, repl, true);
-    stream.flush();
-    return stream.good();
+    return generator.genWriteFile(filePath, util::genProcessTemplate(Templ, repl, true));
 }
 
 bool EmscriptenField::emscriptenWriteSrcInternal() const
@@ -489,12 +480,6 @@ bool EmscriptenField::emscriptenWriteSrcInternal() const
     auto& logger = generator.genLogger();
     logger.genInfo("Generating " + filePath);
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        logger.genError("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
-
     static const std::string Templ =
         "#^#GENERATED#$#\n\n"
         "#^#INCLUDES#$#\n"
@@ -509,9 +494,7 @@ bool EmscriptenField::emscriptenWriteSrcInternal() const
         {"APPEND", generator.genReadCodeInjectCode(generator.emscriptenRelSourceFor(m_genField) + strings::genAppendFileSuffixStr(), "Append here")},
     };
 
-    stream << util::genProcessTemplate(Templ, repl, true);
-    stream.flush();
-    return stream.good();
+    return generator.genWriteFile(filePath, util::genProcessTemplate(Templ, repl, true));
 }
 
 std::string EmscriptenField::emscriptenHeaderIncludesInternal() const
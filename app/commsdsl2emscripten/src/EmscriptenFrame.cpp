@@ -30,7 +30,6 @@
 
 #include <algorithm>
 #include <cassert>
-#include <fstream>
 
 namespace comms = commsdsl::gen::comms;
 namespace strings = commsdsl::gen::strings;
@@ -143,12 +142,6 @@ bool EmscriptenFrame::emscriptenWriteHeaderInternal() const
     auto& logger = gen.genLogger();
     logger.genInfo("Generating " + filePath);
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        logger.genError("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
-
     static const std::string Templ =
         "#^#GENERATED#$#\n"
         "#pragma once\n\n"
@@ -166,9 +159,7 @@ bool EmscriptenFrame::emscriptenWriteHeaderInternal() const
         {"DEF", emscriptenHeaderClassInternal()},
     };
 
-    stream << util::genProcessTemplate(Templ, repl, true);
-    stream.flush();
-    return stream.good();
+    return gen.genWriteFile(filePath, util::genProcessTemplate(Templ, repl, true));
 }
 
 bool EmscriptenFrame::emscriptenWriteSourceInternal() const
@@ -184,12 +175,6 @@ bool EmscriptenFrame::emscriptenWriteSourceInternal() const
     auto& logger = gen.genLogger();
     logger.genInfo("Generating " + filePath);
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        logger.genError("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
-
     static const std::string Templ =
         "#^#GENERATED#$#\n\n"
         "#include \"#^#HEADER#$#\"\n\n"
@@ -209,9 +194,7 @@ bool EmscriptenFrame::emscriptenWriteSourceInternal() const
         {"HEADER", gen.emscriptenRelHeaderFor(*this)},
     };
 
-    stream << util::genProcessTemplate(Templ, repl, true);
-    stream.flush();
-    return stream.good();
+    return gen.genWriteFile(filePath, util::genProcessTemplate(Templ, repl, true));
 }
 
 std::string EmscriptenFrame::emscriptenHeaderIncludesInternal() const
@@ -420,8 +403,23 @@ std::string EmscriptenFrame::emscriptenSourceCodeInternal() const
     static const std::string Templ =
         "std::size_t #^#CLASS_NAME#$#::processInputData(const #^#DATA_BUF#$#& buf, #^#HANDLER#$#& handler)\n"
         "{\n"
-        "    if (buf.empty()) { return 0U; }\n"
-        "    return static_cast<std::size_t>(comms::processAllWithDispatch(buf.begin(), buf.size(), m_frame, handler));\n"
+        "    std::size_t consumed = 0U;\n"
+        "    while (consumed < buf.size()) {\n"
+        "        auto begIter = buf.begin() + consumed;\n"
+        "        auto iter = begIter;\n"
+        "        auto len = buf.size() - consumed;\n\n"
+        "        Frame::MsgPtr msg;\n"
+        "        auto es = comms::processSingleWithDispatch(iter, len, m_frame, msg, handler);\n"
+        "        if (es == comms::ErrorStatus::NotEnoughData) {\n"
+        "            break;\n"
+        "        }\n\n"
+        "        if (es == comms::ErrorStatus::ProtocolError) {\n"
+        "            consumed += Frame::resyncOffset(buf.data() + consumed, len);\n"
+        "            continue;\n"
+        "        }\n\n"
+        "        consumed += static_cast<decltype(consumed)>(std::distance(begIter, iter));\n"
+        "    }\n"
+        "    return consumed;\n"
         "}\n\n"
         "std::size_t #^#CLASS_NAME#$#::processInputJsArray(const emscripten::val& buf, #^#HANDLER#$#& handler)\n"
         "{\n"
@@ -449,7 +447,7 @@ std::string EmscriptenFrame::emscriptenSourceCodeInternal() const
         "            return consumed;\n"
         "        }\n\n"
         "        if (es == comms::ErrorStatus::ProtocolError) {\n"
-        "            ++consumed;\n"
+        "            consumed += Frame::resyncOffset(buf.data() + consumed, len);\n"
         "            continue;\n"
         "        }\n\n"
         "        if (allFields != nullptr) {\n"
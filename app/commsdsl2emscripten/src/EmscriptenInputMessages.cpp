@@ -25,7 +25,6 @@
 #include "commsdsl/gen/util.h"
 
 #include <cassert>
-#include <fstream>
 
 namespace comms = commsdsl::gen::comms;
 namespace strings = commsdsl::gen::strings;
@@ -79,12 +78,6 @@ bool EmscriptenInputMessages::emscriptenWriteHeaderInternal() const
     }
 
     m_emscriptenGenerator.genLogger().genInfo("Generating " + filePath);
-    std::ofstream stream(filePath);
-    if (!stream) {
-        m_emscriptenGenerator.genLogger().genError("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
-
     util::GenStringsList includes = {
         "<tuple>"
     };
@@ -123,10 +116,7 @@ bool EmscriptenInputMessages::emscriptenWriteHeaderInternal() const
     };
 
     auto str = commsdsl::gen::util::genProcessTemplate(Templ, repl, true);
-    stream << str;
-    stream.flush();
-    if (!stream.good()) {
-        m_emscriptenGenerator.genLogger().genError("Failed to write \"" + filePath + "\".");
+    if (!m_emscriptenGenerator.genWriteFile(filePath, str)) {
         return false;
     }
 
@@ -143,12 +133,6 @@ bool EmscriptenInputMessages::emscriptenWriteHeaderFwdInternal() const
     }
 
     m_emscriptenGenerator.genLogger().genInfo("Generating " + filePath);
-    std::ofstream stream(filePath);
-    if (!stream) {
-        m_emscriptenGenerator.genLogger().genError("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
-
     util::GenStringsList msgs;
 
     auto allMessages = m_parent.genGetAllMessagesIdSorted();
@@ -174,10 +158,7 @@ bool EmscriptenInputMessages::emscriptenWriteHeaderFwdInternal() const
     };
 
     auto str = commsdsl::gen::util::genProcessTemplate(Templ, repl, true);
-    stream << str;
-    stream.flush();
-    if (!stream.good()) {
-        m_emscriptenGenerator.genLogger().genError("Failed to write \"" + filePath + "\".");
+    if (!m_emscriptenGenerator.genWriteFile(filePath, str)) {
         return false;
     }
 
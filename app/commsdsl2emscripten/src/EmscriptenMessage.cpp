@@ -28,7 +28,6 @@
 #include "commsdsl/gen/util.h"
 
 #include <cassert>
-#include <fstream>
 
 namespace comms = commsdsl::gen::comms;
 namespace strings = commsdsl::gen::strings;
@@ -103,12 +102,6 @@ bool EmscriptenMessage::emscriptenWriteHeaderInternal() const
     auto& logger = emscriptenGenerator.genLogger();
     logger.genInfo("Generating " + filePath);
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        logger.genError("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
-
     static const std::string Templ =
         "#^#GENERATED#$#\n"
         "#pragma once\n\n"
@@ -124,9 +117,7 @@ bool EmscriptenMessage::emscriptenWriteHeaderInternal() const
         {"DEF", emscriptenHeaderClassInternal()},
     };
 
-    stream << util::genProcessTemplate(Templ, repl, true);
-    stream.flush();
-    return stream.good();
+    return emscriptenGenerator.genWriteFile(filePath, util::genProcessTemplate(Templ, repl, true));
 }
 
 bool EmscriptenMessage::emscriptenWriteSourceInternal() const
@@ -142,12 +133,6 @@ bool EmscriptenMessage::emscriptenWriteSourceInternal() const
     auto& logger = emscriptenGenerator.genLogger();
     logger.genInfo("Generating " + filePath);
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        logger.genError("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
-
     static const std::string Templ =
         "#^#GENERATED#$#\n"
         "#include \"#^#HEADER#$#\"\n\n"
@@ -163,9 +148,7 @@ bool EmscriptenMessage::emscriptenWriteSourceInternal() const
         {"CODE", emscriptenSourceCodeInternal()},
     };
 
-    stream << util::genProcessTemplate(Templ, repl, true);
-    stream.flush();
-    return stream.good();
+    return emscriptenGenerator.genWriteFile(filePath, util::genProcessTemplate(Templ, repl, true));
 }
 
 std::string EmscriptenMessage::emscriptenHeaderIncludesInternal() const
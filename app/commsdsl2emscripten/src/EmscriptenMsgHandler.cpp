@@ -27,7 +27,6 @@
 #include "commsdsl/gen/util.h"
 
 #include <cassert>
-#include <fstream>
 
 namespace comms = commsdsl::gen::comms;
 namespace strings = commsdsl::gen::strings;
@@ -82,12 +81,6 @@ bool EmscriptenMsgHandler::emscriptenWriteHeaderInternal() const
     }
 
     m_emscriptenGenerator.genLogger().genInfo("Generating " + filePath);
-    std::ofstream stream(filePath);
-    if (!stream) {
-        m_emscriptenGenerator.genLogger().genError("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
-
     const std::string Templ =
         "#^#GENERATED#$#\n\n"
         "#pragma once\n\n"
@@ -116,10 +109,7 @@ bool EmscriptenMsgHandler::emscriptenWriteHeaderInternal() const
     };
 
     auto str = commsdsl::gen::util::genProcessTemplate(Templ, repl, true);
-    stream << str;
-    stream.flush();
-    if (!stream.good()) {
-        m_emscriptenGenerator.genLogger().genError("Failed to write \"" + filePath + "\".");
+    if (!m_emscriptenGenerator.genWriteFile(filePath, str)) {
         return false;
     }
 
@@ -136,12 +126,6 @@ bool EmscriptenMsgHandler::emscriptenWriteSrcInternal() const
     }
 
     m_emscriptenGenerator.genLogger().genInfo("Generating " + filePath);
-    std::ofstream stream(filePath);
-    if (!stream) {
-        m_emscriptenGenerator.genLogger().genError("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
-
     const std::string Templ =
         "#^#GENERATED#$#\n\n"
         "#include \"#^#HEADER#$#\"\n\n"
@@ -175,10 +159,7 @@ bool EmscriptenMsgHandler::emscriptenWriteSrcInternal() const
     };
 
     auto str = commsdsl::gen::util::genProcessTemplate(Templ, repl, true);
-    stream << str;
-    stream.flush();
-    if (!stream.good()) {
-        m_emscriptenGenerator.genLogger().genError("Failed to write \"" + filePath + "\".");
+    if (!m_emscriptenGenerator.genWriteFile(filePath, str)) {
         return false;
     }
 
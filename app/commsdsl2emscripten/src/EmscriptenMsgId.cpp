@@ -26,7 +26,6 @@
 
 #include <algorithm>
 #include <cassert>
-#include <fstream>
 #include <limits>
 
 namespace util = commsdsl::gen::util;
@@ -59,12 +58,6 @@ bool EmscriptenMsgId::emscriptenWrite() const
         return false;
     }
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        m_emscriptenGenerator.genLogger().genError("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
-
     const std::string Templ =
         "#^#GENERATED#$#\n"
         "#include <emscripten/bind.h>\n\n"
@@ -84,10 +77,7 @@ bool EmscriptenMsgId::emscriptenWrite() const
         {"HEADER", comms::genRelHeaderForMsgId(strings::genMsgIdEnumNameStr(), m_emscriptenGenerator, m_parent)},
     };
 
-    stream << util::genProcessTemplate(Templ, repl, true);
-    stream.flush();
-    if (!stream.good()) {
-        m_emscriptenGenerator.genLogger().genError("Failed to write \"" + filePath + "\".");
+    if (!m_emscriptenGenerator.genWriteFile(filePath, util::genProcessTemplate(Templ, repl, true))) {
         return false;
     }
 
@@ -24,7 +24,6 @@
 
 #include <algorithm>
 #include <cassert>
-#include <fstream>
 #include <limits>
 
 namespace util = commsdsl::gen::util;
@@ -128,12 +127,6 @@ bool EmscriptenProtocolOptions::emscriptenWriteHeaderInternal()
         return false;
     }
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        m_emscriptenGenerator.genLogger().genError("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
-
     const std::string Templ =
         "#^#GENERATED#$#\n"
         "#^#INCLUDES#$#\n"
@@ -146,10 +139,7 @@ bool EmscriptenProtocolOptions::emscriptenWriteHeaderInternal()
         {"DEF", emscriptenTypeDefInternal()}
     };
 
-    stream << util::genProcessTemplate(Templ, repl, true);
-    stream.flush();
-    if (!stream.good()) {
-        m_emscriptenGenerator.genLogger().genError("Failed to write \"" + filePath + "\".");
+    if (!m_emscriptenGenerator.genWriteFile(filePath, util::genProcessTemplate(Templ, repl, true))) {
         return false;
     }
 
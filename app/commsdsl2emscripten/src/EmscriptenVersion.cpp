@@ -25,7 +25,6 @@
 
 #include <algorithm>
 #include <cassert>
-#include <fstream>
 #include <limits>
 
 namespace comms = commsdsl::gen::comms;
@@ -76,12 +75,6 @@ bool EmscriptenVersion::emscriptenWriteHeaderInternal() const
         return false;
     }
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        m_emscriptenGenerator.genLogger().genError("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
-
     const std::string Templ =
         "#^#GENERATED#$#\n"
         "#include \"#^#HEADER#$#\"\n\n"
@@ -100,10 +93,7 @@ bool EmscriptenVersion::emscriptenWriteHeaderInternal() const
         {"CODE_VER", emscriptenCodeVersionInternal()},
     };
 
-    stream << util::genProcessTemplate(Templ, repl, true);
-    stream.flush();
-    if (!stream.good()) {
-        m_emscriptenGenerator.genLogger().genError("Failed to write \"" + filePath + "\".");
+    if (!m_emscriptenGenerator.genWriteFile(filePath, util::genProcessTemplate(Templ, repl, true))) {
         return false;
     }
 
@@ -121,12 +111,6 @@ bool EmscriptenVersion::emscriptenWriteSrcInternal() const
         return false;
     }
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        m_emscriptenGenerator.genLogger().genError("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
-
     const std::string Templ =
         "#^#GENERATED#$#\n"
         "#include <emscripten/bind.h>\n\n"
@@ -146,10 +130,7 @@ bool EmscriptenVersion::emscriptenWriteSrcInternal() const
         {"CODE_VER", emscriptenCodeVerConstantsInternal()},
     };
 
-    stream << util::genProcessTemplate(Templ, repl, true);
-    stream.flush();
-    if (!stream.good()) {
-        m_emscriptenGenerator.genLogger().genError("Failed to write \"" + filePath + "\".");
+    if (!m_emscriptenGenerator.genWriteFile(filePath, util::genProcessTemplate(Templ, repl, true))) {
         return false;
     }
 
@@ -17,6 +17,8 @@
 #include "EmscriptenGenerator.h"
 #include "EmscriptenProgramOptions.h"
 
+#include "commsdsl/gen/GenWatcher.h"
+
 #include <cassert>
 #include <iostream>
 #include <stdexcept>
@@ -27,8 +29,7 @@ int main(int argc, const char* argv[])
         commsdsl2emscripten::EmscriptenProgramOptions options;
         options.genParse(argc, argv);
 
-        commsdsl2emscripten::EmscriptenGenerator generator;
-        return generator.genExec(options);
+        return commsdsl::gen::GenWatcher::genRun<commsdsl2emscripten::EmscriptenGenerator>(options);
     }
     catch (const std::exception& e) {
         std::cerr << "Unhandled exception: " << e.what() << std::endl;
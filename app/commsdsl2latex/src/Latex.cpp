@@ -23,7 +23,7 @@
 #include "commsdsl/gen/strings.h"
 
 #include <cassert>
-#include <fstream>
+#include <sstream>
 
 namespace util = commsdsl::gen::util;
 namespace strings = commsdsl::gen::strings;
@@ -59,11 +59,7 @@ bool Latex::latexWriteInternal()
     auto filePath = util::genPathAddElem(m_latexGenerator.genGetOutputDir(), docName);
 
     m_latexGenerator.genLogger().genInfo("Generating " + filePath);
-    std::ofstream stream(filePath);
-    if (!stream) {
-        m_latexGenerator.genLogger().genError("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
+    std::ostringstream stream;
 
     do {
         auto replaceFileName = latexDocTexFileName(m_latexGenerator) + strings::genReplaceFileSuffixStr();
@@ -102,9 +98,7 @@ bool Latex::latexWriteInternal()
         stream << str;
     } while (false);
 
-    stream.flush();
-    if (!stream.good()) {
-        m_latexGenerator.genLogger().genError("Failed to write \"" + filePath + "\".");
+    if (!m_latexGenerator.genWriteFile(filePath, stream.str())) {
         return false;
     }
 
@@ -118,11 +112,7 @@ bool Latex::latexWriteCfgInternal()
     auto filePath = util::genPathAddElem(m_latexGenerator.genGetOutputDir(), docName);
 
     m_latexGenerator.genLogger().genInfo("Generating " + filePath);
-    std::ofstream stream(filePath);
-    if (!stream) {
-        m_latexGenerator.genLogger().genError("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
+    std::ostringstream stream;
 
     do {
         auto replaceFileName = docName + strings::genReplaceFileSuffixStr();
@@ -151,9 +141,7 @@ bool Latex::latexWriteCfgInternal()
         stream << str;
     } while (false);
 
-    stream.flush();
-    if (!stream.good()) {
-        m_latexGenerator.genLogger().genError("Failed to write \"" + filePath + "\".");
+    if (!m_latexGenerator.genWriteFile(filePath, stream.str())) {
         return false;
     }
 
@@ -22,8 +22,6 @@
 #include "commsdsl/gen/util.h"
 #include "commsdsl/gen/strings.h"
 
-#include <fstream>
-
 namespace util = commsdsl::gen::util;
 namespace strings = commsdsl::gen::strings;
 
@@ -41,12 +39,6 @@ bool LatexCmake::latexWriteInternal()
     auto filePath = util::genPathAddElem(m_latexGenerator.genGetOutputDir(), strings::genCmakeListsFileStr());
 
     m_latexGenerator.genLogger().genInfo("Generating " + filePath);
-    std::ofstream stream(filePath);
-    if (!stream) {
-        m_latexGenerator.genLogger().genError("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
-
     const std::string Templ =
         "cmake_minimum_required (VERSION 3.10)\n"
         "project (\"#^#PROJ_NAME#$#_latex\" NONE)\n\n"
@@ -74,11 +66,7 @@ bool LatexCmake::latexWriteInternal()
     };
 
     auto str = commsdsl::gen::util::genProcessTemplate(Templ, repl, true);
-    stream << str;
-
-    stream.flush();
-    if (!stream.good()) {
-        m_latexGenerator.genLogger().genError("Failed to write \"" + filePath + "\".");
+    if (!m_latexGenerator.genWriteFile(filePath, str)) {
         return false;
     }
 
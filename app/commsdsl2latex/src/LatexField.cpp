@@ -32,7 +32,6 @@
 
 #include <algorithm>
 #include <cassert>
-#include <fstream>
 #include <iomanip>
 #include <sstream>
 
@@ -558,11 +557,7 @@ bool LatexField::latexWrite() const
     }
 
     latexGenerator.genLogger().genInfo("Generating " + filePath);
-    std::ofstream stream(filePath);
-    if (!stream) {
-        latexGenerator.genLogger().genError("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
+    std::ostringstream stream;
 
     do {
         auto replaceFileName = latexRelFilePath() + strings::genReplaceFileSuffixStr();
@@ -587,9 +582,7 @@ bool LatexField::latexWrite() const
         stream << util::genProcessTemplate(Templ, repl, true) << std::endl;
     } while (false);
 
-    stream.flush();
-    if (!stream.good()) {
-        latexGenerator.genLogger().genError("Failed to write \"" + filePath + "\".");
+    if (!latexGenerator.genWriteFile(filePath, stream.str())) {
         return false;
     }
 
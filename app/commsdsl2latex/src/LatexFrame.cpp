@@ -23,7 +23,7 @@
 #include "commsdsl/gen/util.h"
 
 #include <cassert>
-#include <fstream>
+#include <sstream>
 
 namespace strings = commsdsl::gen::strings;
 namespace util = commsdsl::gen::util;
@@ -74,11 +74,7 @@ bool LatexFrame::genWriteImpl() const
     }
 
     latexGenerator.genLogger().genInfo("Generating " + filePath);
-    std::ofstream stream(filePath);
-    if (!stream) {
-        latexGenerator.genLogger().genError("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
+    std::ostringstream stream;
 
     do {
         auto replaceFileName = relFilePath + strings::genReplaceFileSuffixStr();
@@ -125,9 +121,7 @@ bool LatexFrame::genWriteImpl() const
         stream << util::genProcessTemplate(Templ, repl, true) << std::endl;
     } while (false);
 
-    stream.flush();
-    if (!stream.good()) {
-        latexGenerator.genLogger().genError("Failed to write \"" + filePath + "\".");
+    if (!latexGenerator.genWriteFile(filePath, stream.str())) {
         return false;
     }
 
@@ -25,7 +25,7 @@
 #include "commsdsl/parse/ParseProtocol.h"
 
 #include <cassert>
-#include <fstream>
+#include <sstream>
 #include <iomanip>
 #include <limits>
 #include <type_traits>
@@ -102,11 +102,7 @@ bool LatexMessage::genWriteImpl() const
     }
 
     latexGenerator.genLogger().genInfo("Generating " + filePath);
-    std::ofstream stream(filePath);
-    if (!stream) {
-        latexGenerator.genLogger().genError("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
+    std::ostringstream stream;
 
     do {
         auto replaceFileName = relFilePath + strings::genReplaceFileSuffixStr();
@@ -153,9 +149,7 @@ bool LatexMessage::genWriteImpl() const
         stream << util::genProcessTemplate(Templ, repl, true) << std::endl;
     } while (false);
 
-    stream.flush();
-    if (!stream.good()) {
-        latexGenerator.genLogger().genError("Failed to write \"" + filePath + "\".");
+    if (!latexGenerator.genWriteFile(filePath, stream.str())) {
         return false;
     }
 
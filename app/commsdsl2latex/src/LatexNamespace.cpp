@@ -25,7 +25,7 @@
 
 #include <algorithm>
 #include <cassert>
-#include <fstream>
+#include <sstream>
 
 namespace strings = commsdsl::gen::strings;
 namespace util = commsdsl::gen::util;
@@ -174,11 +174,7 @@ bool LatexNamespace::genWriteImpl() const
     }
 
     latexGenerator.genLogger().genInfo("Generating " + filePath);
-    std::ofstream stream(filePath);
-    if (!stream) {
-        latexGenerator.genLogger().genError("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
+    std::ostringstream stream;
 
     do {
         auto replaceFileName = relFilePath + strings::genReplaceFileSuffixStr();
@@ -232,9 +228,7 @@ bool LatexNamespace::genWriteImpl() const
         stream << util::genProcessTemplate(Templ, repl, true) << std::endl;
     } while (false);
 
-    stream.flush();
-    if (!stream.good()) {
-        latexGenerator.genLogger().genError("Failed to write \"" + filePath + "\".");
+    if (!latexGenerator.genWriteFile(filePath, stream.str())) {
         return false;
     }
 
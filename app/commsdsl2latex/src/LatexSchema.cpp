@@ -24,7 +24,7 @@
 #include "commsdsl/gen/util.h"
 
 #include <cassert>
-#include <fstream>
+#include <sstream>
 
 namespace strings = commsdsl::gen::strings;
 namespace util = commsdsl::gen::util;
@@ -82,11 +82,7 @@ bool LatexSchema::genWriteImpl()
     }
 
     latexGenerator.genLogger().genInfo("Generating " + filePath);
-    std::ofstream stream(filePath);
-    if (!stream) {
-        latexGenerator.genLogger().genError("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
+    std::ostringstream stream;
 
     do {
         auto replaceFileName = latexRelFilePath() + strings::genReplaceFileSuffixStr();
@@ -138,9 +134,7 @@ bool LatexSchema::genWriteImpl()
         stream << util::genProcessTemplate(Templ, repl, true) << std::endl;
     } while (false);
 
-    stream.flush();
-    if (!stream.good()) {
-        latexGenerator.genLogger().genError("Failed to write \"" + filePath + "\".");
+    if (!latexGenerator.genWriteFile(filePath, stream.str())) {
         return false;
     }
 
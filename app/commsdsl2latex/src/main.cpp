@@ -17,6 +17,8 @@
 #include "LatexGenerator.h"
 #include "LatexProgramOptions.h"
 
+#include "commsdsl/gen/GenWatcher.h"
+
 #include <cassert>
 #include <iostream>
 #include <stdexcept>
@@ -27,8 +29,7 @@ int main(int argc, const char* argv[])
         commsdsl2latex::LatexProgramOptions options;
         options.genParse(argc, argv);
 
-        commsdsl2latex::LatexGenerator generator;
-        return generator.genExec(options);
+        return commsdsl::gen::GenWatcher::genRun<commsdsl2latex::LatexGenerator>(options);
     }
     catch (const std::exception& e) {
         std::cerr << "Unhandled exception: " << e.what() << std::endl;
@@ -0,0 +1,305 @@
+//
+// Copyright 2025 - 2025 (C). Alex Robenko. All rights reserved.
+//
+// SPDX-License-Identifier: Apache-2.0
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "MultiDriver.h"
+
+#ifdef COMMSDSL2MULTI_HAS_COMMS
+#include "CommsGenerator.h"
+#include "CommsProgramOptions.h"
+#endif // #ifdef COMMSDSL2MULTI_HAS_COMMS
+
+#ifdef COMMSDSL2MULTI_HAS_C
+#include "CGenerator.h"
+#include "CProgramOptions.h"
+#endif // #ifdef COMMSDSL2MULTI_HAS_C
+
+#ifdef COMMSDSL2MULTI_HAS_EMSCRIPTEN
+#include "EmscriptenGenerator.h"
+#include "EmscriptenProgramOptions.h"
+#endif // #ifdef COMMSDSL2MULTI_HAS_EMSCRIPTEN
+
+#ifdef COMMSDSL2MULTI_HAS_LATEX
+#include "LatexGenerator.h"
+#include "LatexProgramOptions.h"
+#endif // #ifdef COMMSDSL2MULTI_HAS_LATEX
+
+#ifdef COMMSDSL2MULTI_HAS_SWIG
+#include "SwigGenerator.h"
+#include "SwigProgramOptions.h"
+#endif // #ifdef COMMSDSL2MULTI_HAS_SWIG
+
+#ifdef COMMSDSL2MULTI_HAS_TEST
+#include "TestGenerator.h"
+#include "TestProgramOptions.h"
+#endif // #ifdef COMMSDSL2MULTI_HAS_TEST
+
+#ifdef COMMSDSL2MULTI_HAS_TOOLS_QT
+#include "ToolsQtGenerator.h"
+#include "ToolsQtProgramOptions.h"
+#endif // #ifdef COMMSDSL2MULTI_HAS_TOOLS_QT
+
+#include "commsdsl/version.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <exception>
+#include <iostream>
+#include <map>
+#include <thread>
+
+namespace commsdsl2multi
+{
+
+namespace
+{
+
+template <typename TOptions, typename TGenerator>
+int multiRunBackend(
+    const std::string& app,
+    const MultiDriver::MultiArgsList& args,
+    const MultiDriver::ParseProtocol& protocol)
+{
+    std::vector<const char*> argv;
+    argv.reserve(args.size() + 1U);
+    argv.push_back(app.c_str());
+    for (auto& a : args) {
+        argv.push_back(a.c_str());
+    }
+
+    TOptions options;
+    options.genParse(static_cast<int>(argv.size()), argv.data());
+
+    TGenerator generator;
+    return generator.genExec(options, protocol);
+}
+
+using MultiBackendFuncsMap = std::map<std::string, MultiDriver::MultiBackendFunc>;
+
+const MultiBackendFuncsMap& multiAvailableBackends()
+{
+    static const MultiBackendFuncsMap Map = {
+#ifdef COMMSDSL2MULTI_HAS_COMMS
+        {"commsdsl2comms", &multiRunBackend<commsdsl2comms::CommsProgramOptions, commsdsl2comms::CommsGenerator>},
+#endif
+#ifdef COMMSDSL2MULTI_HAS_C
+        {"commsdsl2c", &multiRunBackend<commsdsl2c::CProgramOptions, commsdsl2c::CGenerator>},
+#endif
+#ifdef COMMSDSL2MULTI_HAS_EMSCRIPTEN
+        {"commsdsl2emscripten", &multiRunBackend<commsdsl2emscripten::EmscriptenProgramOptions, commsdsl2emscripten::EmscriptenGenerator>},
+#endif
+#ifdef COMMSDSL2MULTI_HAS_LATEX
+        {"commsdsl2latex", &multiRunBackend<commsdsl2latex::LatexProgramOptions, commsdsl2latex::LatexGenerator>},
+#endif
+#ifdef COMMSDSL2MULTI_HAS_SWIG
+        {"commsdsl2swig", &multiRunBackend<commsdsl2swig::SwigProgramOptions, commsdsl2swig::SwigGenerator>},
+#endif
+#ifdef COMMSDSL2MULTI_HAS_TEST
+        {"commsdsl2test", &multiRunBackend<commsdsl2test::TestProgramOptions, commsdsl2test::TestGenerator>},
+#endif
+#ifdef COMMSDSL2MULTI_HAS_TOOLS_QT
+        {"commsdsl2tools_qt", &multiRunBackend<commsdsl2tools_qt::ToolsQtProgramOptions, commsdsl2tools_qt::ToolsQtGenerator>},
+#endif
+    };
+
+    return Map;
+}
+
+} // namespace
+
+int MultiDriver::multiExec(const MultiProgramOptions& options)
+{
+    if (options.genHelpRequested()) {
+        std::cout << "Usage:\n\t" << options.genApp() << " [OPTIONS] schema_file1 [schema_file2] [schema_file3] ...\n\n";
+        std::cout << options.genHelpStr();
+        return 0;
+    }
+
+    if (options.genVersionRequested()) {
+        std::cout <<
+            commsdsl::versionMajor() << '.' <<
+            commsdsl::versionMinor() << '.' <<
+            commsdsl::versionPatch() << std::endl;
+        return 0;
+    }
+
+    if (options.genQuietRequested() && options.genDebugRequested()) {
+        m_logger.genError("Cannot use both --quiet and --debug options at the same time");
+        return -1;
+    }
+
+    if (options.genQuietRequested()) {
+        m_logger.genSetMinLevel(commsdsl::parse::ParseErrorLevel_Warning);
+    }
+
+    if (options.genDebugRequested()) {
+        m_logger.genSetMinLevel(commsdsl::parse::ParseErrorLevel_Debug);
+    }
+
+    if (options.genWarnAsErrRequested()) {
+        m_logger.genSetWarnAsError();
+    }
+
+    if (!multiPrepareBackends(options)) {
+        return -1;
+    }
+
+    auto files = options.genGetInputFiles();
+    if (files.empty()) {
+        m_logger.genError("No input files are provided");
+        return -1;
+    }
+
+    m_protocol.parseSetMultipleSchemasEnabled(options.genMultipleSchemasEnabled());
+    if (!multiParseSchemas(files)) {
+        m_logger.genError("Failed to parse the schema files");
+        return -1;
+    }
+
+    return multiRunBackends(options.multiGetJobs());
+}
+
+bool MultiDriver::multiPrepareBackends(const MultiProgramOptions& options)
+{
+    auto& available = multiAvailableBackends();
+    for (auto& b : MultiProgramOptions::multiSupportedBackends()) {
+        if (!options.multiIsBackendRequested(b)) {
+            continue;
+        }
+
+        auto iter = available.find(b);
+        if (iter == available.end()) {
+            m_logger.genError("The " + b + " backend is not available in this build");
+            return false;
+        }
+
+        MultiBackendInfo info;
+        info.m_app = b;
+        if (!options.multiGetBackendArgs(b, info.m_args)) {
+            m_logger.genError("Unterminated quote in the arguments of " + b);
+            return false;
+        }
+
+        info.m_func = iter->second;
+        m_backends.push_back(std::move(info));
+    }
+
+    if (m_backends.empty()) {
+        m_logger.genError("No backends are requested");
+        return false;
+    }
+
+    return true;
+}
+
+bool MultiDriver::multiParseSchemas(const MultiProgramOptions::GenStringsList& files)
+{
+    m_protocol.parseSetErrorReportCallback(
+        [this](commsdsl::parse::ParseErrorLevel level, const std::string& msg)
+        {
+            m_logger.genLog(level, msg);
+        });
+
+    for (auto& f : files) {
+        m_logger.genInfo("Parsing " + f);
+        if (!m_protocol.parse(f)) {
+            return false;
+        }
+
+        if (m_logger.genHadWarning()) {
+            m_logger.genError("Warning treated as error");
+            return false;
+        }
+    }
+
+    if (!m_protocol.parseValidate()) {
+        return false;
+    }
+
+    if (m_logger.genHadWarning()) {
+        m_logger.genError("Warning treated as error");
+        return false;
+    }
+
+    // The backends only read the parsed protocol definition,
+    // the errors reported by them are logged by their own loggers.
+    m_protocol.parseSetErrorReportCallback(
+        [](commsdsl::parse::ParseErrorLevel, const std::string&) noexcept
+        {
+        });
+
+    return true;
+}
+
+int MultiDriver::multiRunBackends(unsigned jobs)
+{
+    std::vector<int> results(m_backends.size(), 0);
+    std::vector<std::exception_ptr> exceptions(m_backends.size());
+    std::atomic<std::size_t> nextIdx(0U);
+
+    auto workerFunc =
+        [this, &results, &exceptions, &nextIdx]()
+        {
+            while (true) {
+                auto idx = nextIdx++;
+                if (m_backends.size() <= idx) {
+                    break;
+                }
+
+                auto& info = m_backends[idx];
+                assert(info.m_func != nullptr);
+
+                // Exception escaping the worker thread terminates the application,
+                // keep it to be rethrown after all the workers are joined.
+                try {
+                    results[idx] = info.m_func(info.m_app, info.m_args, m_protocol);
+                }
+                catch (...) {
+                    exceptions[idx] = std::current_exception();
+                }
+            }
+        };
+
+    auto threadsCount = std::min(static_cast<std::size_t>(jobs), m_backends.size());
+    std::vector<std::thread> threads;
+    for (auto idx = 1U; idx < threadsCount; ++idx) {
+        threads.emplace_back(workerFunc);
+    }
+
+    workerFunc();
+
+    for (auto& t : threads) {
+        t.join();
+    }
+
+    for (auto idx = 0U; idx < exceptions.size(); ++idx) {
+        if (exceptions[idx]) {
+            m_logger.genError("The " + m_backends[idx].m_app + " backend failed with exception");
+            std::rethrow_exception(exceptions[idx]);
+        }
+    }
+
+    for (auto idx = 0U; idx < results.size(); ++idx) {
+        if (results[idx] != 0) {
+            m_logger.genError("The " + m_backends[idx].m_app + " backend failed");
+            return results[idx];
+        }
+    }
+
+    return 0;
+}
+
+} // namespace commsdsl2multi
@@ -0,0 +1,61 @@
+//
+// Copyright 2025 - 2025 (C). Alex Robenko. All rights reserved.
+//
+// SPDX-License-Identifier: Apache-2.0
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "MultiProgramOptions.h"
+
+#include "commsdsl/gen/GenLogger.h"
+#include "commsdsl/parse/ParseProtocol.h"
+
+#include <string>
+#include <vector>
+
+namespace commsdsl2multi
+{
+
+// Parses and validates the schema files only once, then runs all the
+// requested code generators (backends) on the same protocol definition.
+class MultiDriver
+{
+public:
+    using ParseProtocol = commsdsl::parse::ParseProtocol;
+    using GenLogger = commsdsl::gen::GenLogger;
+    using MultiArgsList = MultiProgramOptions::MultiArgsList;
+    using MultiBackendFunc = int (*)(const std::string& app, const MultiArgsList& args, const ParseProtocol& protocol);
+
+    int multiExec(const MultiProgramOptions& options);
+
+private:
+    struct MultiBackendInfo
+    {
+        std::string m_app;
+        MultiArgsList m_args;
+        MultiBackendFunc m_func = nullptr;
+    };
+
+    using MultiBackendsList = std::vector<MultiBackendInfo>;
+
+    bool multiPrepareBackends(const MultiProgramOptions& options);
+    bool multiParseSchemas(const MultiProgramOptions::GenStringsList& files);
+    int multiRunBackends(unsigned jobs);
+
+    ParseProtocol m_protocol;
+    GenLogger m_logger;
+    MultiBackendsList m_backends;
+};
+
+} // namespace commsdsl2multi
@@ -0,0 +1,195 @@
+//
+// Copyright 2025 - 2025 (C). Alex Robenko. All rights reserved.
+//
+// SPDX-License-Identifier: Apache-2.0
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "MultiProgramOptions.h"
+
+#include "commsdsl/gen/util.h"
+
+#include <algorithm>
+#include <cassert>
+
+namespace commsdsl2multi
+{
+
+namespace
+{
+
+const std::string MultiHelpStr("h,help");
+const std::string MultiVersionStr("version");
+const std::string MultiQuietStr("q,quiet");
+const std::string MultiDebugStr("d,debug");
+const std::string MultiWarnAsErrStr("w,warn-as-err");
+const std::string MultiInputFilesListStr("i,input-files-list");
+const std::string MultiInputFilesPrefixStr("p,input-files-prefix");
+const std::string MultiMultipleSchemasEnabledStr("s,multiple-schemas-enabled");
+const std::string MultiJobsStr("jobs");
+const std::string MultiFullJobsStr("j," + MultiJobsStr);
+
+// Splits the value the way a POSIX shell would: the arguments are separated
+// by whitespace, the single and double quotes group characters (including
+// whitespace) into a single argument. Outside the single quotes the backslash
+// escapes the following quote, whitespace or backslash character, in all other
+// cases it is kept as is to allow Windows paths.
+bool multiSplitArgs(const std::string& value, MultiProgramOptions::MultiArgsList& args)
+{
+    static const std::string WhiteSpaces(" \t\r\n");
+    static const std::string Escaped("'\"\\" + WhiteSpaces);
+    std::string arg;
+    bool hasArg = false;
+    char quote = '\0';
+    for (std::size_t pos = 0U; pos < value.size(); ++pos) {
+        auto ch = value[pos];
+        if (quote == '\'') {
+            if (ch == quote) {
+                quote = '\0';
+                continue;
+            }
+
+            arg += ch;
+            continue;
+        }
+
+        if ((ch == '\\') && ((pos + 1U) < value.size()) && (Escaped.find(value[pos + 1U]) != std::string::npos)) {
+            ++pos;
+            arg += value[pos];
+            hasArg = true;
+            continue;
+        }
+
+        if (quote == '"') {
+            if (ch == quote) {
+                quote = '\0';
+                continue;
+            }
+
+            arg += ch;
+            continue;
+        }
+
+        if ((ch == '\'') || (ch == '"')) {
+            quote = ch;
+            hasArg = true;
+            continue;
+        }
+
+        if (WhiteSpaces.find(ch) == std::string::npos) {
+            arg += ch;
+            hasArg = true;
+            continue;
+        }
+
+        if (hasArg) {
+            args.push_back(std::move(arg));
+            arg.clear();
+            hasArg = false;
+        }
+    }
+
+    if (quote != '\0') {
+        return false;
+    }
+
+    if (hasArg) {
+        args.push_back(std::move(arg));
+    }
+
+    return true;
+}
+
+} // namespace
+
+MultiProgramOptions::MultiProgramOptions()
+{
+    // Only the options relevant to the parsing of the schema files are shared,
+    // all the others are provided to every backend separately.
+    (*this)
+        (MultiHelpStr, "Show this help")
+        (MultiVersionStr, "Print version string and exit.")
+        (MultiQuietStr, "Quiet, show only warnings and errors. Forwarded to all the backends.")
+        (MultiDebugStr, "Show debug logging. Forwarded to all the backends.")
+        (MultiWarnAsErrStr, "Treat warnings as errors. Forwarded to all the backends.")
+        (MultiInputFilesListStr, "File containing list of input files.", true)
+        (MultiInputFilesPrefixStr, "Prefix for the values from the list file.", true)
+        (MultiMultipleSchemasEnabledStr, "Allow having multiple schemas with different names. Forwarded to all the backends.")
+        (MultiFullJobsStr, "Number of backends to run in parallel. Defaults to 1.", std::string("1"))
+        ;
+
+    for (auto& b : multiSupportedBackends()) {
+        (*this)
+            (b,
+                "Run " + b + " backend with the provided space separated options "
+                "(use quotes), for example \"-o output_dir -c code_input_dir\". "
+                "Single or double quotes inside the value keep the argument containing "
+                "spaces as a single one, for example \"-o 'output dir'\". "
+                "The input schema files must not be listed.",
+                true);
+    }
+}
+
+unsigned MultiProgramOptions::multiGetJobs() const
+{
+    auto jobs = static_cast<unsigned>(commsdsl::gen::util::genStrToUnsigned(genValue(MultiJobsStr)));
+    return std::max(jobs, 1U);
+}
+
+bool MultiProgramOptions::multiIsBackendRequested(const std::string& backend) const
+{
+    return genIsOptUsed(backend);
+}
+
+bool MultiProgramOptions::multiGetBackendArgs(const std::string& backend, MultiArgsList& args) const
+{
+    assert(multiIsBackendRequested(backend));
+    args.clear();
+    if (!multiSplitArgs(genValue(backend), args)) {
+        return false;
+    }
+
+    if (genQuietRequested()) {
+        args.push_back("--quiet");
+    }
+
+    if (genDebugRequested()) {
+        args.push_back("--debug");
+    }
+
+    if (genWarnAsErrRequested()) {
+        args.push_back("--warn-as-err");
+    }
+
+    if (genMultipleSchemasEnabled()) {
+        args.push_back("--multiple-schemas-enabled");
+    }
+
+    return true;
+}
+
+const MultiProgramOptions::MultiArgsList& MultiProgramOptions::multiSupportedBackends()
+{
+    static const MultiArgsList List = {
+        "commsdsl2comms",
+        "commsdsl2c",
+        "commsdsl2emscripten",
+        "commsdsl2latex",
+        "commsdsl2swig",
+        "commsdsl2test",
+        "commsdsl2tools_qt",
+    };
+
+    return List;
+}
+
+} // namespace commsdsl2multi
@@ -0,0 +1,47 @@
+//
+// Copyright 2025 - 2025 (C). Alex Robenko. All rights reserved.
+//
+// SPDX-License-Identifier: Apache-2.0
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "commsdsl/gen/GenProgramOptions.h"
+
+#include <string>
+#include <vector>
+
+namespace commsdsl2multi
+{
+
+class MultiProgramOptions : public commsdsl::gen::GenProgramOptions
+{
+public:
+    using GenProgramOptions = commsdsl::gen::GenProgramOptions;
+    using MultiArgsList = std::vector<std::string>;
+
+    MultiProgramOptions();
+
+    static const MultiProgramOptions& multiCast(const GenProgramOptions& options)
+    {
+        return static_cast<const MultiProgramOptions&>(options);
+    }
+
+    unsigned multiGetJobs() const;
+    bool multiIsBackendRequested(const std::string& backend) const;
+    bool multiGetBackendArgs(const std::string& backend, MultiArgsList& args) const;
+
+    static const MultiArgsList& multiSupportedBackends();
+};
+
+} // namespace commsdsl2multi
@@ -0,0 +1,39 @@
+//
+// Copyright 2025 - 2025 (C). Alex Robenko. All rights reserved.
+//
+// SPDX-License-Identifier: Apache-2.0
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "MultiDriver.h"
+#include "MultiProgramOptions.h"
+
+#include <stdexcept>
+#include <iostream>
+#include <cassert>
+
+int main(int argc, const char* argv[])
+{
+    try {
+        commsdsl2multi::MultiProgramOptions options;
+        options.genParse(argc, argv);
+
+        commsdsl2multi::MultiDriver driver;
+        return driver.multiExec(options);
+    }
+    catch (const std::exception& e) {
+        std::cerr << "Unhandled exception: " << e.what() << std::endl;
+        assert(false);
+    }
+
+    return -1;
+}
@@ -31,7 +31,7 @@
 #include "commsdsl/gen/strings.h"
 #include "commsdsl/gen/util.h"
 
-#include <fstream>
+#include <sstream>
 
 namespace comms = commsdsl::gen::comms;
 namespace strings = commsdsl::gen::strings;
@@ -51,11 +51,7 @@ bool Swig::swigWriteInternal()
     auto swigName = swigFileNameInternal();
     auto filePath = util::genPathAddElem(m_swigGenerator.genGetOutputDir(), swigName);
     m_swigGenerator.genLogger().genInfo("Generating " + filePath);
-    std::ofstream stream(filePath);
-    if (!stream) {
-        m_swigGenerator.genLogger().genError("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
+    std::ostringstream stream;
 
     do {
         bool hasReplace = false;
@@ -89,9 +85,7 @@ bool Swig::swigWriteInternal()
         stream << str;
     } while (false);
 
-    stream.flush();
-    if (!stream.good()) {
-        m_swigGenerator.genLogger().genError("Failed to write \"" + filePath + "\".");
+    if (!m_swigGenerator.genWriteFile(filePath, stream.str())) {
         return false;
     }
 
@@ -22,7 +22,6 @@
 #include "commsdsl/gen/util.h"
 
 #include <cassert>
-#include <fstream>
 
 namespace strings = commsdsl::gen::strings;
 namespace util = commsdsl::gen::util;
@@ -46,12 +45,6 @@ bool SwigCmake::swigWriteInternal() const
     }
 
     m_swigGenerator.genLogger().genInfo("Generating " + filePath);
-    std::ofstream stream(filePath);
-    if (!stream) {
-        m_swigGenerator.genLogger().genError("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
-
     const std::string Templ =
         "cmake_minimum_required (VERSION 3.12)\n"
         "project (#^#PROJ_NAME#$#_swig)\n\n"
@@ -129,10 +122,7 @@ bool SwigCmake::swigWriteInternal() const
     };
 
     auto str = commsdsl::gen::util::genProcessTemplate(Templ, repl, true);
-    stream << str;
-    stream.flush();
-    if (!stream.good()) {
-        m_swigGenerator.genLogger().genError("Failed to write " + filePath + ".");
+    if (!m_swigGenerator.genWriteFile(filePath, str)) {
         return false;
     }
 
@@ -25,7 +25,6 @@
 
 #include <algorithm>
 #include <cassert>
-#include <fstream>
 #include <limits>
 
 namespace util = commsdsl::gen::util;
@@ -94,12 +93,6 @@ bool SwigDataBuf::swigWriteInternal() const
         return false;
     }
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        m_swigGenerator.genLogger().genError("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
-
     const std::string Templ =
         "#^#GENERATED#$#\n"
         "#pragma once\n\n"
@@ -112,10 +105,7 @@ bool SwigDataBuf::swigWriteInternal() const
         {"UINT8_T", SwigGenerator::swigCast(m_swigGenerator).swigConvertCppType("std::uint8_t")}
     };
 
-    stream << util::genProcessTemplate(Templ, repl, true);
-    stream.flush();
-    if (!stream.good()) {
-        m_swigGenerator.genLogger().genError("Failed to write \"" + filePath + "\".");
+    if (!m_swigGenerator.genWriteFile(filePath, util::genProcessTemplate(Templ, repl, true))) {
         return false;
     }
 
@@ -31,7 +31,6 @@
 
 #include <algorithm>
 #include <cassert>
-#include <fstream>
 
 namespace comms = commsdsl::gen::comms;
 namespace strings = commsdsl::gen::strings;
@@ -132,12 +131,6 @@ bool SwigFrame::genWriteImpl() const
     auto& logger = genGenerator().genLogger();
     logger.genInfo("Generating " + filePath);
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        logger.genError("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
-
     static const std::string Templ =
         "#^#GENERATED#$#\n"
         "#pragma once\n\n"
@@ -153,9 +146,7 @@ bool SwigFrame::genWriteImpl() const
         {"DEF", swigClassDeclInternal()},
     };
 
-    stream << util::genProcessTemplate(Templ, repl, true);
-    stream.flush();
-    return stream.good();
+    return genGenerator().genWriteFile(filePath, util::genProcessTemplate(Templ, repl, true));
 }
 
 std::string SwigFrame::swigLayerDeclsInternal() const
@@ -250,8 +241,23 @@ std::string SwigFrame::swigFrameCodeInternal() const
         "    #^#LAYERS#$#\n\n"
         "    #^#SIZE_T#$# processInputData(const #^#DATA_BUF#$#& buf, #^#HANDLER#$#& handler)\n"
         "    {\n"
-        "        if (buf.empty()) { return 0U; }\n"
-        "        return static_cast<#^#SIZE_T#$#>(comms::processAllWithDispatch(buf.begin(), buf.size(), m_frame, handler));\n"
+        "        #^#SIZE_T#$# consumed = 0U;\n"
+        "        while (consumed < buf.size()) {\n"
+        "            auto begIter = buf.begin() + consumed;\n"
+        "            auto iter = begIter;\n"
+        "            auto len = buf.size() - consumed;\n\n"
+        "            Frame::MsgPtr msg;\n"
+        "            auto es = comms::processSingleWithDispatch(iter, len, m_frame, msg, handler);\n"
+        "            if (es == comms::ErrorStatus::NotEnoughData) {\n"
+        "                break;\n"
+        "            }\n\n"
+        "            if (es == comms::ErrorStatus::ProtocolError) {\n"
+        "                consumed += static_cast<decltype(consumed)>(Frame::resyncOffset(buf.data() + consumed, len));\n"
+        "                continue;\n"
+        "            }\n\n"
+        "            consumed += static_cast<decltype(consumed)>(std::distance(begIter, iter));\n"
+        "        }\n"
+        "        return consumed;\n"
         "    }\n\n"
         "    #^#SIZE_T#$# processInputDataSingleMsg(const #^#DATA_BUF#$#& buf, #^#HANDLER#$#& handler, #^#CLASS_NAME#$#_AllFields* allFields = nullptr)\n"
         "    {\n"
@@ -275,7 +281,7 @@ std::string SwigFrame::swigFrameCodeInternal() const
         "                return consumed;\n"
         "            }\n\n"
         "            if (es == comms::ErrorStatus::ProtocolError) {\n"
-        "                ++consumed;\n"
+        "                consumed += static_cast<decltype(consumed)>(Frame::resyncOffset(buf.data() + consumed, len));\n"
         "                continue;\n"
         "            }\n\n"
         "            if (allFields != nullptr) {\n"
@@ -28,7 +28,6 @@
 #include "commsdsl/gen/util.h"
 
 #include <cassert>
-#include <fstream>
 
 namespace comms = commsdsl::gen::comms;
 namespace strings = commsdsl::gen::strings;
@@ -201,12 +200,6 @@ bool SwigInterface::genWriteImpl() const
     auto& logger = genGenerator().genLogger();
     logger.genInfo("Generating " + filePath);
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        logger.genError("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
-
     static const std::string Templ =
         "#^#GENERATED#$#\n"
         "#pragma once\n\n"
@@ -220,9 +213,7 @@ bool SwigInterface::genWriteImpl() const
         {"DEF", swigClassDeclInternal()},
     };
 
-    stream << util::genProcessTemplate(Templ, repl, true);
-    stream.flush();
-    return stream.good();
+    return genGenerator().genWriteFile(filePath, util::genProcessTemplate(Templ, repl, true));
 }
 
 std::string SwigInterface::swigFieldDeclsInternal() const
@@ -28,7 +28,6 @@
 #include "commsdsl/gen/util.h"
 
 #include <cassert>
-#include <fstream>
 
 namespace comms = commsdsl::gen::comms;
 namespace strings = commsdsl::gen::strings;
@@ -174,12 +173,6 @@ bool SwigMessage::genWriteImpl() const
     auto& logger = genGenerator().genLogger();
     logger.genInfo("Generating " + filePath);
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        logger.genError("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
-
     static const std::string Templ =
         "#^#GENERATED#$#\n"
         "#pragma once\n\n"
@@ -193,9 +186,7 @@ bool SwigMessage::genWriteImpl() const
         {"DEF", swigClassDeclInternal()},
     };
 
-    stream << util::genProcessTemplate(Templ, repl, true);
-    stream.flush();
-    return stream.good();
+    return genGenerator().genWriteFile(filePath, util::genProcessTemplate(Templ, repl, true));
 }
 
 std::string SwigMessage::swigFieldDefsInternal() const
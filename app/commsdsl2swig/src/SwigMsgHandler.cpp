@@ -27,7 +27,6 @@
 
 #include <algorithm>
 #include <cassert>
-#include <fstream>
 #include <limits>
 
 namespace util = commsdsl::gen::util;
@@ -67,12 +66,6 @@ bool SwigMsgHandler::swigWrite() const
         return false;
     }
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        m_swigGenerator.genLogger().genError("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
-
     const std::string Templ =
         "#^#GENERATED#$#\n"
         "#pragma once\n\n"
@@ -84,10 +77,7 @@ bool SwigMsgHandler::swigWrite() const
         {"CLASS", swigClassDeclInternal()},
     };
 
-    stream << util::genProcessTemplate(Templ, repl, true);
-    stream.flush();
-    if (!stream.good()) {
-        m_swigGenerator.genLogger().genError("Failed to write \"" + filePath + "\".");
+    if (!m_swigGenerator.genWriteFile(filePath, util::genProcessTemplate(Templ, repl, true))) {
         return false;
     }
 
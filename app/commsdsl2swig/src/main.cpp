@@ -17,6 +17,8 @@
 #include "SwigGenerator.h"
 #include "SwigProgramOptions.h"
 
+#include "commsdsl/gen/GenWatcher.h"
+
 #include <cassert>
 #include <iostream>
 #include <stdexcept>
@@ -27,8 +29,7 @@ int main(int argc, const char* argv[])
         commsdsl2swig::SwigProgramOptions options;
         options.genParse(argc, argv);
 
-        commsdsl2swig::SwigGenerator generator;
-        return generator.genExec(options);
+        return commsdsl::gen::GenWatcher::genRun<commsdsl2swig::SwigGenerator>(options);
     }
     catch (const std::exception& e) {
         std::cerr << "Unhandled exception: " << e.what() << std::endl;
@@ -24,8 +24,6 @@
 #include "commsdsl/gen/GenEnumField.h"
 #include "commsdsl/gen/GenIntField.h"
 
-#include <fstream>
-
 namespace comms = commsdsl::gen::comms;
 namespace strings = commsdsl::gen::strings;
 namespace util = commsdsl::gen::util;
@@ -47,12 +45,6 @@ bool Test::testWriteInputTest() const
     auto filePath = util::genPathAddElem(m_testGenerator.genGetOutputDir(), testName);
 
     m_testGenerator.genLogger().genInfo("Generating " + filePath);
-    std::ofstream stream(filePath);
-    if (!stream) {
-        m_testGenerator.genLogger().genError("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
-
     util::GenReplacementMap repl = {
         {"GEN_COMMENT", m_testGenerator.testFileGeneratedComment()},
         {"NS", util::genStrToUpper(m_testGenerator.genCurrentSchema().genMainNamespace())},
@@ -445,11 +437,7 @@ bool Test::testWriteInputTest() const
         "}\n\n";
 
     auto str = commsdsl::gen::util::genProcessTemplate(Template, repl, true);
-    stream << str;
-
-    stream.flush();
-    if (!stream.good()) {
-        m_testGenerator.genLogger().genError("Failed to write \"" + filePath + "\".");
+    if (!m_testGenerator.genWriteFile(filePath, str)) {
         return false;
     }
 
@@ -481,4 +469,4 @@ std::string Test::testCodeVersionInternal() const
     return util::genProcessTemplate(Templ, repl);
 }
 
-} // namespace commsdsl2test
\ No newline at end of file
+} // namespace commsdsl2test
@@ -23,7 +23,6 @@
 #include "commsdsl/gen/comms.h"
 
 #include <cassert>
-#include <fstream>
 
 namespace strings = commsdsl::gen::strings;
 namespace util = commsdsl::gen::util;
@@ -44,12 +43,6 @@ bool TestCmake::testWriteInternal() const
             m_testGenerator.genGetOutputDir(), commsdsl::gen::strings::genCmakeListsFileStr());
 
     m_testGenerator.genLogger().genInfo("Generating " + filePath);
-    std::ofstream stream(filePath);
-    if (!stream) {
-        m_testGenerator.genLogger().genError("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
-
     auto allInterfaces = m_testGenerator.genGetAllInterfaces();
     assert(!allInterfaces.empty());
     auto* firstInterface = allInterfaces.front();
@@ -207,10 +200,7 @@ bool TestCmake::testWriteInternal() const
         "define_test(#^#PROJ_NS#$#_input_test)\n";
 
     auto str = util::genProcessTemplate(Template, repl, true);
-    stream << str;
-    stream.flush();
-    if (!stream.good()) {
-        m_testGenerator.genLogger().genError("Failed to write \"" + filePath + "\".");
+    if (!m_testGenerator.genWriteFile(filePath, str)) {
         return false;
     }
 
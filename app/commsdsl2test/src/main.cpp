@@ -17,6 +17,8 @@
 #include "TestGenerator.h"
 #include "TestProgramOptions.h"
 
+#include "commsdsl/gen/GenWatcher.h"
+
 #include <cassert>
 #include <iostream>
 #include <stdexcept>
@@ -27,8 +29,7 @@ int main(int argc, const char* argv[])
         commsdsl2test::TestProgramOptions options;
         options.genParse(argc, argv);
 
-        commsdsl2test::TestGenerator generator;
-        return generator.genExec(options);
+        return commsdsl::gen::GenWatcher::genRun<commsdsl2test::TestGenerator>(options);
     }
     catch (const std::exception& e) {
         std::cerr << "Unhandled exception: " << e.what() << std::endl;
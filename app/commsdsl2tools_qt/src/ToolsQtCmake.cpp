@@ -23,7 +23,6 @@
 #include "commsdsl/gen/util.h"
 
 #include <cassert>
-#include <fstream>
 
 namespace comms = commsdsl::gen::comms;
 namespace strings = commsdsl::gen::strings;
@@ -45,12 +44,6 @@ bool ToolsQtCmake::toolsWriteInternal() const
             m_toolsGenerator.genGetOutputDir(), strings::genCmakeListsFileStr());
 
     m_toolsGenerator.genLogger().genInfo("Generating " + filePath);
-    std::ofstream stream(filePath);
-    if (!stream) {
-        m_toolsGenerator.genLogger().genError("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
-
     static const std::string Template =
         "cmake_minimum_required (VERSION 3.10)\n"
         "project (\"#^#MAIN_NS#$#_cc_tools_qt_plugin\")\n\n"
@@ -171,10 +164,7 @@ bool ToolsQtCmake::toolsWriteInternal() const
     };
 
     auto str = commsdsl::gen::util::genProcessTemplate(Template, repl, true);
-    stream << str;
-    stream.flush();
-    if (!stream.good()) {
-        m_toolsGenerator.genLogger().genError("Failed to write \"" + filePath + "\".");
+    if (!m_toolsGenerator.genWriteFile(filePath, str)) {
         return false;
     }
 
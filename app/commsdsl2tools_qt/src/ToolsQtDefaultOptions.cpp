@@ -26,7 +26,6 @@
 #include <algorithm>
 #include <cassert>
 #include <functional>
-#include <fstream>
 
 namespace comms = commsdsl::gen::comms;
 namespace strings = commsdsl::gen::strings;
@@ -135,12 +134,6 @@ bool ToolsQtDefaultOptions::toolsWriteInternal() const
 
     m_toolsGenerator.genLogger().genInfo("Generating " + filePath);
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        m_toolsGenerator.genLogger().genError("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
-
     static const std::string Templ =
         "#^#GENERATED#$#\n"
         "/// @file\n"
@@ -203,9 +196,7 @@ bool ToolsQtDefaultOptions::toolsWriteInternal() const
         repl["ORIG"] = strings::genOrigSuffixStr();
     }
 
-    stream << util::genProcessTemplate(Templ, repl, true);
-    stream.flush();
-    return stream.good();
+    return m_toolsGenerator.genWriteFile(filePath, util::genProcessTemplate(Templ, repl, true));
 }
 
 } // namespace commsdsl2tools_qt
\ No newline at end of file
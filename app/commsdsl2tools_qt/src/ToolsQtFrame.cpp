@@ -28,7 +28,6 @@
 
 #include <algorithm>
 #include <cassert>
-#include <fstream>
 #include <iterator>
 #include <numeric>
 
@@ -154,12 +153,6 @@ bool ToolsQtFrame::toolsWriteProtTransportMsgHeaderInternal() const
             return false;
         }
 
-        std::ofstream stream(filePath);
-        if (!stream) {
-            logger.genError("Failed to open \"" + filePath + "\" for writing.");
-            return false;
-        }
-
         util::GenStringsList includes = {
             "<tuple>",
             "cc_tools_qt/ToolsTransportProtMessageBase.h",
@@ -193,10 +186,7 @@ bool ToolsQtFrame::toolsWriteProtTransportMsgHeaderInternal() const
             {"DEF", toolsProtTransportMsgDefInternal(*info.first)},
         };
 
-        stream << util::genProcessTemplate(Templ, repl, true);
-        stream.flush();
-        if (!stream.good()) {
-            logger.genError("Write to \"" + filePath + "\" is unsuccessful.");
+        if (!gen.genWriteFile(filePath, util::genProcessTemplate(Templ, repl, true))) {
             return false;
         }
     }
@@ -226,12 +216,6 @@ bool ToolsQtFrame::toolsWriteHeaderInternal() const
             return false;
         }
 
-        std::ofstream stream(filePath);
-        if (!stream) {
-            logger.genError("Failed to open \"" + filePath + "\" for writing.");
-            return false;
-        }
-
         static const std::string Templ =
             "#^#GENERATED#$#\n"
             "\n"
@@ -255,10 +239,7 @@ bool ToolsQtFrame::toolsWriteHeaderInternal() const
             {"DEF", toolsFrameHeaderDefInternal()},
         };
 
-        stream << util::genProcessTemplate(Templ, repl, true);
-        stream.flush();
-        if (!stream.good()) {
-            logger.genError("Write to \"" + filePath + "\" is unsuccessful.");
+        if (!gen.genWriteFile(filePath, util::genProcessTemplate(Templ, repl, true))) {
             return false;
         }
     }
@@ -291,12 +272,6 @@ bool ToolsQtFrame::toolsWriteSrcInternal() const
             return false;
         }
 
-        std::ofstream stream(filePath);
-        if (!stream) {
-            logger.genError("Failed to open \"" + filePath + "\" for writing.");
-            return false;
-        }
-
         static const std::string Templ =
             "#^#GENERATED#$#\n"
             "\n"
@@ -333,10 +308,7 @@ bool ToolsQtFrame::toolsWriteSrcInternal() const
             {"INCLUDES", util::genStrListToString(includes, "\n", "")},
         };
 
-        stream << util::genProcessTemplate(Templ, repl, true);
-        stream.flush();
-        if (!stream.good()) {
-            logger.genError("Write to \"" + filePath + "\" is unsuccessful.");
+        if (!gen.genWriteFile(filePath, util::genProcessTemplate(Templ, repl, true))) {
             return false;
         }
     }
@@ -359,12 +331,6 @@ bool ToolsQtFrame::toolsWriteTransportMsgHeaderInternal() const
 
         logger.genInfo("Generating " + filePath);
 
-        std::ofstream stream(filePath);
-        if (!stream) {
-            logger.genError("Failed to open \"" + filePath + "\" for writing.");
-            return false;
-        }
-
         static const std::string Templ =
             "#^#GENERATED#$#\n"
             "\n"
@@ -388,10 +354,7 @@ bool ToolsQtFrame::toolsWriteTransportMsgHeaderInternal() const
             {"DEF", toolsTransportMsgHeaderDefInternal()},
         };
 
-        stream << util::genProcessTemplate(Templ, repl, true);
-        stream.flush();
-        if (!stream.good()) {
-            logger.genError("Write to \"" + filePath + "\" is unsuccessful.");
+        if (!gen.genWriteFile(filePath, util::genProcessTemplate(Templ, repl, true))) {
             return false;
         }
     }
@@ -415,12 +378,6 @@ bool ToolsQtFrame::toolsWriteTransportMsgSrcInternal() const
 
         logger.genInfo("Generating " + filePath);
 
-        std::ofstream stream(filePath);
-        if (!stream) {
-            logger.genError("Failed to open \"" + filePath + "\" for writing.");
-            return false;
-        }
-
         static const std::string Templ =
             "#^#GENERATED#$#\n"
             "\n"
@@ -454,10 +411,7 @@ bool ToolsQtFrame::toolsWriteTransportMsgSrcInternal() const
             {"DEF", toolsTransportMsgSrcDefInternal(*info.first)},
         };
 
-        stream << util::genProcessTemplate(Templ, repl, true);
-        stream.flush();
-        if (!stream.good()) {
-            logger.genError("Write to \"" + filePath + "\" is unsuccessful.");
+        if (!gen.genWriteFile(filePath, util::genProcessTemplate(Templ, repl, true))) {
             return false;
         }
     }
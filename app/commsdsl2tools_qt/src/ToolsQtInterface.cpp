@@ -27,7 +27,6 @@
 
 #include <algorithm>
 #include <cassert>
-#include <fstream>
 #include <iterator>
 
 namespace comms = commsdsl::gen::comms;
@@ -107,12 +106,6 @@ bool ToolsQtInterface::toolsWriteHeaderInternal() const
         return false;
     }
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        logger.genError("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
-
     static const std::string Templ =
         "#^#GENERATED#$#\n"
         "\n"
@@ -145,9 +138,7 @@ bool ToolsQtInterface::toolsWriteHeaderInternal() const
         {"DEF", toolsHeaderCodeInternal()},
     };
 
-    stream << util::genProcessTemplate(Templ, repl, true);
-    stream.flush();
-    return stream.good();
+    return gen.genWriteFile(filePath, util::genProcessTemplate(Templ, repl, true));
 }
 
 bool ToolsQtInterface::toolsWriteSrcInternal() const
@@ -164,12 +155,6 @@ bool ToolsQtInterface::toolsWriteSrcInternal() const
         return false;
     }
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        logger.genError("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
-
     static const std::string Templ =
         "#^#GENERATED#$#\n"
         "#include \"#^#CLASS_NAME#$#.h\"\n\n"
@@ -190,9 +175,7 @@ bool ToolsQtInterface::toolsWriteSrcInternal() const
         {"DEF", toolsSrcCodeInternal()},
     };
 
-    stream << util::genProcessTemplate(Templ, repl, true);
-    stream.flush();
-    return stream.good();
+    return gen.genWriteFile(filePath, util::genProcessTemplate(Templ, repl, true));
 }
 
 std::string ToolsQtInterface::toolsHeaderCodeInternal() const
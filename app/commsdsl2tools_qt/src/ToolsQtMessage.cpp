@@ -25,7 +25,6 @@
 
 #include <algorithm>
 #include <cassert>
-#include <fstream>
 #include <iterator>
 #include <type_traits>
 
@@ -107,12 +106,6 @@ bool ToolsQtMessage::toolsWriteHeaderInternal() const
         auto includes = toolsHeaderIncludesInternal();
         comms::genPrepareIncludeStatement(includes);
 
-        std::ofstream stream(filePath);
-        if (!stream) {
-            logger.genError("Failed to open \"" + filePath + "\" for writing.");
-            return false;
-        }
-
         static const std::string Templ =
             "#^#GENERATED#$#\n"
             "\n"
@@ -135,10 +128,7 @@ bool ToolsQtMessage::toolsWriteHeaderInternal() const
             {"DEF", toolsHeaderCodeInternal()},
         };
 
-        stream << util::genProcessTemplate(Templ, repl, true);
-        stream.flush();
-        if (!stream.good()) {
-            logger.genError("Write to \"" + filePath + "\" is unsuccessful.");
+        if (!gen.genWriteFile(filePath, util::genProcessTemplate(Templ, repl, true))) {
             return false;
         }
     }
@@ -161,12 +151,6 @@ bool ToolsQtMessage::toolsWriteSrcInternal() const
         auto includes = toolsSrcIncludesInternal(*iFace);
         comms::genPrepareIncludeStatement(includes);
 
-        std::ofstream stream(filePath);
-        if (!stream) {
-            logger.genError("Failed to open \"" + filePath + "\" for writing.");
-            return false;
-        }
-
         static const std::string Templ =
             "#^#GENERATED#$#\n"
             "\n"
@@ -190,10 +174,7 @@ bool ToolsQtMessage::toolsWriteSrcInternal() const
             {"DEF", toolsSrcCodeInternal(*iFace)},
         };
 
-        stream << util::genProcessTemplate(Templ, repl, true);
-        stream.flush();
-        if (!stream.good()) {
-            logger.genError("Write to \"" + filePath + "\" is unsuccessful.");
+        if (!gen.genWriteFile(filePath, util::genProcessTemplate(Templ, repl, true))) {
             return false;
         }
     }
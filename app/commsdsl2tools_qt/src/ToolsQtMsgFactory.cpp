@@ -27,7 +27,6 @@
 
 #include <algorithm>
 #include <cassert>
-#include <fstream>
 
 namespace comms = commsdsl::gen::comms;
 namespace strings = commsdsl::gen::strings;
@@ -103,12 +102,6 @@ bool ToolsQtMsgFactory::toolsWriteHeaderInternal() const
 
         comms::genPrepareIncludeStatement(includes);
 
-        std::ofstream stream(filePath);
-        if (!stream) {
-            logger.genError("Failed to open \"" + filePath + "\" for writing.");
-            return false;
-        }
-
         static const std::string Templ =
             "#^#GENERATED#$#\n"
             "#pragma once\n\n"
@@ -134,10 +127,7 @@ bool ToolsQtMsgFactory::toolsWriteHeaderInternal() const
             {"FACTORY_NAMESPACE", strings::genFactoryNamespaceStr()}
         };
 
-        stream << util::genProcessTemplate(Templ, repl, true);
-        stream.flush();
-        if (!stream.good()) {
-            logger.genError("Write to \"" + filePath + "\" is unsuccessful.");
+        if (!m_toolsGenerator.genWriteFile(filePath, util::genProcessTemplate(Templ, repl, true))) {
             return false;
         }
     }
@@ -163,12 +153,6 @@ bool ToolsQtMsgFactory::toolsWriteSourceInternal() const
             return false;
         }
 
-        std::ofstream stream(filePath);
-        if (!stream) {
-            logger.genError("Failed to open \"" + filePath + "\" for writing.");
-            return false;
-        }
-
         static const std::string Templ =
             "#^#GENERATED#$#\n"
             "\n"
@@ -196,10 +180,7 @@ bool ToolsQtMsgFactory::toolsWriteSourceInternal() const
             {"FACTORY_NAMESPACE", strings::genFactoryNamespaceStr()}
         };
 
-        stream << util::genProcessTemplate(Templ, repl, true);
-        stream.flush();
-        if (!stream.good()) {
-            logger.genError("Write to \"" + filePath + "\" is unsuccessful.");
+        if (!m_toolsGenerator.genWriteFile(filePath, util::genProcessTemplate(Templ, repl, true))) {
             return false;
         }
     }
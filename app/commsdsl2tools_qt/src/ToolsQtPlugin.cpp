@@ -23,7 +23,7 @@
 #include "commsdsl/gen/util.h"
 
 #include <cassert>
-#include <fstream>
+#include <sstream>
 
 namespace comms = commsdsl::gen::comms;
 namespace strings = commsdsl::gen::strings;
@@ -92,18 +92,13 @@ bool ToolsQtPlugin::toolsWriteProtocolHeaderInternal()
         return false;
     }
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        m_toolsGenerator.genLogger().genError("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
+    std::ostringstream stream;
 
     bool hasReplace = false;
     auto replaceCode = m_toolsGenerator.genReadCodeInjectCode(relPath + strings::genReplaceFileSuffixStr(), "Replace the whole file", &hasReplace);
     if (hasReplace) {
         stream << replaceCode;
-        stream.flush();
-        return stream.good();
+        return m_toolsGenerator.genWriteFile(filePath, stream.str());
     }
 
     bool hasExtend = false;
@@ -153,9 +148,7 @@ bool ToolsQtPlugin::toolsWriteProtocolHeaderInternal()
 
     auto str = commsdsl::gen::util::genProcessTemplate(Templ, repl, true);
     stream << str;
-    stream.flush();
-    if (!stream.good()) {
-        m_toolsGenerator.genLogger().genError("Failed to write \"" + filePath + "\".");
+    if (!m_toolsGenerator.genWriteFile(filePath, stream.str())) {
         return false;
     }
 
@@ -169,18 +162,13 @@ bool ToolsQtPlugin::toolsWriteProtocolSrcInternal()
 
     m_toolsGenerator.genLogger().genInfo("Generating " + filePath);
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        m_toolsGenerator.genLogger().genError("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
+    std::ostringstream stream;
 
     bool hasReplace = false;
     auto replaceCode = m_toolsGenerator.genReadCodeInjectCode(relPath + strings::genReplaceFileSuffixStr(), "Replace the whole file", &hasReplace);
     if (hasReplace) {
         stream << replaceCode;
-        stream.flush();
-        return stream.good();
+        return m_toolsGenerator.genWriteFile(filePath, stream.str());
     }
 
     bool hasExtend = false;
@@ -240,9 +228,7 @@ bool ToolsQtPlugin::toolsWriteProtocolSrcInternal()
 
     auto str = commsdsl::gen::util::genProcessTemplate(Templ, repl, true);
     stream << str;
-    stream.flush();
-    if (!stream.good()) {
-        m_toolsGenerator.genLogger().genError("Failed to write \"" + filePath + "\".");
+    if (!m_toolsGenerator.genWriteFile(filePath, stream.str())) {
         return false;
     }
 
@@ -256,18 +242,13 @@ bool ToolsQtPlugin::toolsWritePluginHeaderInternal()
 
     m_toolsGenerator.genLogger().genInfo("Generating " + filePath);
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        m_toolsGenerator.genLogger().genError("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
+    std::ostringstream stream;
 
     bool hasReplace = false;
     auto replaceCode = m_toolsGenerator.genReadCodeInjectCode(relPath + strings::genReplaceFileSuffixStr(), "Replace the whole file", &hasReplace);
     if (hasReplace) {
         stream << replaceCode;
-        stream.flush();
-        return stream.good();
+        return m_toolsGenerator.genWriteFile(filePath, stream.str());
     }
 
     bool hasExtend = false;
@@ -325,9 +306,7 @@ bool ToolsQtPlugin::toolsWritePluginHeaderInternal()
 
     auto str = commsdsl::gen::util::genProcessTemplate(Templ, repl, true);
     stream << str;
-    stream.flush();
-    if (!stream.good()) {
-        m_toolsGenerator.genLogger().genError("Failed to write \"" + filePath + "\".");
+    if (!m_toolsGenerator.genWriteFile(filePath, stream.str())) {
         return false;
     }
 
@@ -341,18 +320,13 @@ bool ToolsQtPlugin::toolsWritePluginSrcInternal()
 
     m_toolsGenerator.genLogger().genInfo("Generating " + filePath);
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        m_toolsGenerator.genLogger().genError("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
+    std::ostringstream stream;
 
     bool hasReplace = false;
     auto replaceCode = m_toolsGenerator.genReadCodeInjectCode(relPath + strings::genReplaceFileSuffixStr(), "Replace the whole file", &hasReplace);
     if (hasReplace) {
         stream << replaceCode;
-        stream.flush();
-        return stream.good();
+        return m_toolsGenerator.genWriteFile(filePath, stream.str());
     }
 
     bool hasExtend = false;
@@ -401,9 +375,7 @@ bool ToolsQtPlugin::toolsWritePluginSrcInternal()
 
     auto str = commsdsl::gen::util::genProcessTemplate(Templ, repl, true);
     stream << str;
-    stream.flush();
-    if (!stream.good()) {
-        m_toolsGenerator.genLogger().genError("Failed to write \"" + filePath + "\".");
+    if (!m_toolsGenerator.genWriteFile(filePath, stream.str())) {
         return false;
     }
 
@@ -417,18 +389,13 @@ bool ToolsQtPlugin::toolsWritePluginJsonInternal()
 
     m_toolsGenerator.genLogger().genInfo("Generating " + filePath);
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        m_toolsGenerator.genLogger().genError("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
+    std::ostringstream stream;
 
     auto replaceFilePath = util::genPathAddElem(m_toolsGenerator.genGetCodeDir(), relPath + strings::genReplaceFileSuffixStr());
     auto replaceCode = util::genReadFileContents(replaceFilePath);
     if (!replaceCode.empty()) {
         stream << replaceCode;
-        stream.flush();
-        return stream.good();
+        return m_toolsGenerator.genWriteFile(filePath, stream.str());
     }
 
     static const std::string Templ =
@@ -466,9 +433,7 @@ bool ToolsQtPlugin::toolsWritePluginJsonInternal()
 
     auto str = commsdsl::gen::util::genProcessTemplate(Templ, repl, true);
     stream << str;
-    stream.flush();
-    if (!stream.good()) {
-        m_toolsGenerator.genLogger().genError("Failed to write \"" + filePath + "\".");
+    if (!m_toolsGenerator.genWriteFile(filePath, stream.str())) {
         return false;
     }
 
@@ -482,18 +447,13 @@ bool ToolsQtPlugin::toolsWritePluginConfigInternal()
 
     m_toolsGenerator.genLogger().genInfo("Generating " + filePath);
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        m_toolsGenerator.genLogger().genError("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
+    std::ostringstream stream;
 
     auto replaceFilePath = util::genPathAddElem(m_toolsGenerator.genGetCodeDir(), relPath + strings::genReplaceFileSuffixStr());
     auto replaceCode = util::genReadFileContents(replaceFilePath);
     if (!replaceCode.empty()) {
         stream << replaceCode;
-        stream.flush();
-        return stream.good();
+        return m_toolsGenerator.genWriteFile(filePath, stream.str());
     }
 
     static const std::string Templ =
@@ -510,9 +470,7 @@ bool ToolsQtPlugin::toolsWritePluginConfigInternal()
 
     auto str = commsdsl::gen::util::genProcessTemplate(Templ, repl, true);
     stream << str;
-    stream.flush();
-    if (!stream.good()) {
-        m_toolsGenerator.genLogger().genError("Failed to write \"" + filePath + "\".");
+    if (!m_toolsGenerator.genWriteFile(filePath, stream.str())) {
         return false;
     }
 
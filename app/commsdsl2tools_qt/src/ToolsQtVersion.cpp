@@ -23,7 +23,6 @@
 #include "commsdsl/gen/util.h"
 
 #include <cassert>
-#include <fstream>
 
 namespace comms = commsdsl::gen::comms;
 namespace strings = commsdsl::gen::strings;
@@ -49,12 +48,6 @@ bool ToolsQtVersion::toolsWriteInternal() const
     auto filePath = m_toolsGenerator.genGetOutputDir() + '/' + toolsRelHeaderPath(m_toolsGenerator);
 
     m_toolsGenerator.genLogger().genInfo("Generating " + filePath);
-    std::ofstream stream(filePath);
-    if (!stream) {
-        m_toolsGenerator.genLogger().genError("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
-
     const std::string Templ =
         "#^#GENERATED#$#\n"
         "#pragma once\n\n"
@@ -84,11 +77,7 @@ bool ToolsQtVersion::toolsWriteInternal() const
         {"APPEND", m_toolsGenerator.genReadCodeInjectCode(toolsRelHeaderPath(m_toolsGenerator) + strings::genAppendFileSuffixStr(), "Append here")},
     };
 
-    stream << util::genProcessTemplate(Templ, repl, true);
-    stream.flush();
-
-    if (!stream.good()) {
-        m_toolsGenerator.genLogger().genError("Failed to write \"" + filePath + "\".");
+    if (!m_toolsGenerator.genWriteFile(filePath, util::genProcessTemplate(Templ, repl, true))) {
         return false;
     }
 
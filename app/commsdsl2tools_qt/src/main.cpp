@@ -17,6 +17,8 @@
 #include "ToolsQtGenerator.h"
 #include "ToolsQtProgramOptions.h"
 
+#include "commsdsl/gen/GenWatcher.h"
+
 #include <cassert>
 #include <iostream>
 #include <stdexcept>
@@ -27,8 +29,7 @@ int main(int argc, const char* argv[])
         commsdsl2tools_qt::ToolsQtProgramOptions options;
         options.genParse(argc, argv);
 
-        commsdsl2tools_qt::ToolsQtGenerator generator;
-        return generator.genExec(options);
+        return commsdsl::gen::GenWatcher::genRun<commsdsl2tools_qt::ToolsQtGenerator>(options);
     }
     catch (const std::exception& e) {
         std::cerr << "Unhandled exception: " << e.what() << std::endl;
@@ -0,0 +1,94 @@
+# Checks the "--watch" mode of the code generator: the message removed from
+# the schema must cause removal of its previously generated files.
+# APP - Path to the code generator
+# WORK_DIR - Working directory
+# MODIFY - Internal, runs the schema modification part concurrently with the watching code generator
+
+set (schema_file "${WORK_DIR}/Schema.xml")
+set (msg1_file "${WORK_DIR}/output/include/watch/message/Msg1.h")
+set (msg2_file "${WORK_DIR}/output/include/watch/message/Msg2.h")
+set (pid_file "${WORK_DIR}/watch.pid")
+set (wait_iterations 100)
+
+function (write_schema with_msg2)
+    set (msg2)
+    if (with_msg2)
+        set (msg2 "    <message name=\"Msg2\" id=\"2\" />\n")
+    endif ()
+
+    file (WRITE "${schema_file}"
+        "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+        "<schema name=\"watch\" endian=\"big\">\n"
+        "    <message name=\"Msg1\" id=\"1\" />\n"
+        "${msg2}"
+        "    <frame name=\"Frame\">\n"
+        "        <id name=\"Id\">\n"
+        "            <field>\n"
+        "                <int name=\"IdField\" type=\"uint8\" />\n"
+        "            </field>\n"
+        "        </id>\n"
+        "        <payload name=\"Data\" />\n"
+        "    </frame>\n"
+        "</schema>\n")
+endfunction ()
+
+function (wait_for_file path expect_exists)
+    foreach (idx RANGE ${wait_iterations})
+        set (exists FALSE)
+        if (EXISTS "${path}")
+            set (exists TRUE)
+        endif ()
+
+        if ("${exists}" STREQUAL "${expect_exists}")
+            return ()
+        endif ()
+
+        execute_process (COMMAND ${CMAKE_COMMAND} -E sleep 0.1)
+    endforeach ()
+endfunction ()
+
+if (MODIFY)
+    wait_for_file ("${msg2_file}" TRUE)
+
+    # Let the initial generation complete
+    execute_process (COMMAND ${CMAKE_COMMAND} -E sleep 2)
+    write_schema (FALSE)
+    wait_for_file ("${msg2_file}" FALSE)
+
+    # Stop the watching code generator as soon as the regeneration is observed
+    if (EXISTS "${pid_file}")
+        file (STRINGS "${pid_file}" watch_pid LIMIT_COUNT 1)
+        execute_process (COMMAND kill ${watch_pid})
+    endif ()
+    return ()
+endif ()
+
+if (("${APP}" STREQUAL "") OR ("${WORK_DIR}" STREQUAL ""))
+    message (FATAL_ERROR "APP and WORK_DIR are expected to be provided")
+endif ()
+
+file (REMOVE_RECURSE "${WORK_DIR}")
+file (MAKE_DIRECTORY "${WORK_DIR}")
+write_schema (TRUE)
+
+# The watching code generator never exits on its own. On UNIX hosts it is started
+# via the shell recording its PID to be terminated by the schema modification part,
+# otherwise (and as a fallback) it is terminated by the timeout.
+set (watch_cmd ${APP} --watch -q -o "${WORK_DIR}/output" "${schema_file}")
+if (CMAKE_HOST_UNIX)
+    set (watch_cmd sh -c "echo $$ > \"${pid_file}\" && exec \"$0\" \"$@\"" ${watch_cmd})
+endif ()
+
+execute_process (
+    COMMAND ${watch_cmd}
+    COMMAND ${CMAKE_COMMAND} -DAPP=${APP} -DWORK_DIR=${WORK_DIR} -DMODIFY=TRUE -P ${CMAKE_CURRENT_LIST_FILE}
+    TIMEOUT 15
+)
+
+if (NOT EXISTS "${msg1_file}")
+    message (FATAL_ERROR "The ${msg1_file} is expected to be generated")
+endif ()
+
+if (EXISTS "${msg2_file}")
+    message (FATAL_ERROR "The stale ${msg2_file} is expected to be removed")
+endif ()
@@ -24,9 +24,11 @@
 #include "commsdsl/gen/GenLogger.h"
 #include "commsdsl/gen/GenMessage.h"
 #include "commsdsl/gen/GenNamespace.h"
+#include "commsdsl/gen/GenOutputSink.h"
 #include "commsdsl/gen/GenProgramOptions.h"
 #include "commsdsl/gen/GenSchema.h"
 #include "commsdsl/parse/ParseEndian.h"
+#include "commsdsl/parse/ParseProtocol.h"
 
 #include <memory>
 #include <string>
@@ -42,6 +44,7 @@ class GenGeneratorImpl;
 class GenGenerator
 {
 public:
+    using ParseProtocol = commsdsl::parse::ParseProtocol;
     using ParseSchema = commsdsl::parse::ParseSchema;
     using ParseNamespace = commsdsl::parse::ParseNamespace;
     using ParseInterface = commsdsl::parse::ParseInterface;
@@ -82,6 +85,7 @@ public:
     virtual ~GenGenerator();
 
     int genExec(const GenProgramOptions& options);
+    int genExec(const GenProgramOptions& options, const ParseProtocol& protocol);
 
     void genForceSchemaVersion(unsigned value);
     void genSetMinRemoteVersion(unsigned value);
@@ -113,6 +117,11 @@ public:
     void genSetVersionIndependentCodeForced(bool value = true);
     bool genGetVersionIndependentCodeForced() const;
 
+    // Don't create the message, interface and bundle member fields
+    // that don't exist in the (forced) schema / min remote version.
+    void genSetMissingFieldsDropped(bool value = true);
+    bool genGetMissingFieldsDropped() const;
+
     void genSetCodeInjectCommentsRequested(bool value = true);
     bool genGetCodeInjectCommentsRequested() const;
 
@@ -140,6 +149,7 @@ public:
     GenFieldsAccessList genGetAllFieldsFromAllSchemas() const;
 
     bool genPrepare(const GenFilesList& files);
+    bool genPrepare(const ParseProtocol& protocol);
     bool genWrite();
 
     bool genDoesElementExist(
@@ -153,6 +163,7 @@ public:
         bool deprecatedRemoved) const;
 
     bool genIsElementDeprecated(unsigned deprecatedSince) const;
+    bool genIsFieldDropped(const ParseField& parseObj) const;
 
     GenLogger& genLogger();
     const GenLogger& genLogger() const;
@@ -199,6 +210,19 @@ public:
     void genChooseProtocolSchema() const;
 
     bool genCreateDirectory(const std::string& path) const;
+    bool genWriteFile(const std::string& path, std::string contents) const;
+
+    // Paths of all the files written via genWriteFile()
+    const GenFilesList& genWrittenFiles() const;
+
+    void genSetOutputSink(GenOutputSinkPtr sink);
+    GenOutputSink& genOutputSink() const;
+
+    void genSetAsyncWriteEnabled(bool value = true);
+    bool genGetAsyncWriteEnabled() const;
+
+    void genSetWriteIfChangedEnabled(bool value = true);
+    bool genGetWriteIfChangedEnabled() const;
 
     void genReferenceAllMessages();
 
@@ -0,0 +1,159 @@
+//
+// Copyright 2025 - 2025 (C). Alex Robenko. All rights reserved.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <string>
+
+namespace commsdsl
+{
+
+namespace gen
+{
+
+// Destination of the generated files. All the paths passed to the sink
+// are relative to the output directory of the generator.
+class GenOutputSink
+{
+public:
+    virtual ~GenOutputSink();
+
+    bool genCreateDirectory(const std::string& relPath);
+    bool genWriteFile(const std::string& relPath, std::string contents);
+    bool genFinalize();
+
+    const std::string& genLastError() const
+    {
+        return m_lastError;
+    }
+
+protected:
+    virtual bool genCreateDirectoryImpl(const std::string& relPath);
+    virtual bool genWriteFileImpl(const std::string& relPath, std::string contents) = 0;
+    virtual bool genFinalizeImpl();
+
+    void genSetLastError(const std::string& msg);
+
+private:
+    std::string m_lastError;
+};
+
+using GenOutputSinkPtr = std::unique_ptr<GenOutputSink>;
+
+// Writes files into the real directory tree.
+class GenFsOutputSink : public GenOutputSink
+{
+public:
+    explicit GenFsOutputSink(const std::string& rootDir);
+
+    const std::string& genRootDir() const
+    {
+        return m_rootDir;
+    }
+
+    // Don't touch the existing files when their contents are the same,
+    // preserves the modification times for the incremental builds.
+    void genSetWriteIfChanged(bool value = true)
+    {
+        m_writeIfChanged = value;
+    }
+
+    bool genGetWriteIfChanged() const
+    {
+        return m_writeIfChanged;
+    }
+
+protected:
+    virtual bool genCreateDirectoryImpl(const std::string& relPath) override;
+    virtual bool genWriteFileImpl(const std::string& relPath, std::string contents) override;
+
+    std::string genAbsPath(const std::string& relPath) const;
+
+private:
+    bool genIsSameContents(const std::string& path, const std::string& contents) const;
+
+    std::string m_rootDir;
+    bool m_writeIfChanged = false;
+};
+
+// Keeps the generated files in memory, used when the generator is
+// embedded into other applications.
+class GenMemOutputSink : public GenOutputSink
+{
+public:
+    using GenFilesMap = std::map<std::string, std::string>;
+
+    const GenFilesMap& genFiles() const
+    {
+        return m_files;
+    }
+
+    GenFilesMap genReleaseFiles();
+
+protected:
+    virtual bool genWriteFileImpl(const std::string& relPath, std::string contents) override;
+
+private:
+    GenFilesMap m_files;
+};
+
+// Streams the generated files into a single (ustar) tar archive.
+class GenArchiveOutputSinkImpl;
+class GenArchiveOutputSink : public GenOutputSink
+{
+public:
+    explicit GenArchiveOutputSink(const std::string& archivePath);
+    virtual ~GenArchiveOutputSink();
+
+protected:
+    virtual bool genWriteFileImpl(const std::string& relPath, std::string contents) override;
+    virtual bool genFinalizeImpl() override;
+
+private:
+    std::unique_ptr<GenArchiveOutputSinkImpl> m_impl;
+};
+
+// Decorator performing the actual writes of the wrapped sink on a
+// dedicated background thread. The generation code doesn't wait for
+// the I/O to complete, the errors are reported by genFinalize().
+class GenAsyncOutputSinkImpl;
+class GenAsyncOutputSink : public GenOutputSink
+{
+public:
+    static const std::size_t DefaultQueueCapacity = 256U;
+
+    explicit GenAsyncOutputSink(GenOutputSinkPtr sink, std::size_t queueCapacity = DefaultQueueCapacity);
+    virtual ~GenAsyncOutputSink();
+
+    GenOutputSink& genWrappedSink();
+    GenOutputSinkPtr genReleaseWrappedSink();
+
+protected:
+    virtual bool genCreateDirectoryImpl(const std::string& relPath) override;
+    virtual bool genWriteFileImpl(const std::string& relPath, std::string contents) override;
+    virtual bool genFinalizeImpl() override;
+
+private:
+    std::unique_ptr<GenAsyncOutputSinkImpl> m_impl;
+};
+
+} // namespace gen
+
+} // namespace commsdsl
@@ -59,6 +59,9 @@ public:
     bool genDebugRequested() const;
     bool genWarnAsErrRequested() const;
     const std::string& genGetOutputDirectory() const;
+    const std::string& genGetOutputArchive() const;
+    bool genAsyncWriteRequested() const;
+    bool genWatchRequested() const;
     GenStringsList genGetInputFiles() const;
     const std::string& genGetCodeInputDirectory() const;
     bool genMultipleSchemasEnabled() const;
@@ -0,0 +1,70 @@
+//
+// Copyright 2025 - 2025 (C). Alex Robenko. All rights reserved.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "commsdsl/gen/GenGenerator.h"
+#include "commsdsl/gen/GenProgramOptions.h"
+
+#include <functional>
+#include <memory>
+
+namespace commsdsl
+{
+
+namespace gen
+{
+
+// Implements the "--watch" mode. The schema files are parsed once
+// and kept in memory. The files are re-parsed only when the schema files
+// get modified. Any modification to the code input directory causes only
+// the code regeneration. Every regeneration uses a new generator object
+// created by the provided callback. The files written by the previous
+// generation, which are not produced any more, are removed.
+class GenWatcherImpl;
+class GenWatcher
+{
+public:
+    using GenGeneratorPtr = std::unique_ptr<GenGenerator>;
+    using GenCreateGeneratorFunc = std::function<GenGeneratorPtr ()>;
+
+    explicit GenWatcher(GenCreateGeneratorFunc&& createFunc);
+    ~GenWatcher();
+
+    int genExec(const GenProgramOptions& options);
+
+    // Common entry point of all the code generators, executes the generator
+    // once or keeps regenerating the code when "--watch" is requested.
+    template <typename TGenerator>
+    static int genRun(const GenProgramOptions& options)
+    {
+        GenWatcher watcher(
+            []()
+            {
+                return std::make_unique<TGenerator>();
+            });
+
+        return watcher.genExec(options);
+    }
+
+private:
+    std::unique_ptr<GenWatcherImpl> m_impl;
+};
+
+} // namespace gen
+
+} // namespace commsdsl
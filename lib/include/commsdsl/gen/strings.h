@@ -91,6 +91,7 @@ const std::string& genFieldsSuffixStr();
 const std::string& genLayersSuffixStr();
 const std::string& genBareMetalStr();
 const std::string& genDataViewStr();
+const std::string& genHighThroughputStr();
 const std::string& genTransportMessageSuffixStr();
 const std::string& genUnexpectedValueStr();
 const std::string& genVersionFileNameStr();
@@ -49,6 +49,10 @@ public:
         auto fields = m_bundleParseObj.parseMembers();
         m_members.reserve(fields.size());
         for (auto& parseObj : fields) {
+            if (m_generator.genIsFieldDropped(parseObj)) {
+                continue;
+            }
+
             auto ptr = GenField::genCreate(m_generator, parseObj, m_parent);
             assert(ptr);
             if (!ptr->genPrepare()) {
@@ -28,6 +28,7 @@
 #include "commsdsl/gen/GenIntField.h"
 #include "commsdsl/gen/GenListField.h"
 #include "commsdsl/gen/GenOptionalField.h"
+#include "commsdsl/gen/GenOutputSink.h"
 #include "commsdsl/gen/GenPayloadLayer.h"
 #include "commsdsl/gen/GenRefField.h"
 #include "commsdsl/gen/GenSchema.h"
@@ -259,6 +260,67 @@ public:
         return m_outputDir;
     }
 
+    void genSetOutputSink(GenOutputSinkPtr sink)
+    {
+        m_outputSink = std::move(sink);
+    }
+
+    GenOutputSinkPtr genReleaseOutputSink()
+    {
+        genOutputSink();
+        return std::move(m_outputSink);
+    }
+
+    void genSetAsyncWriteEnabled(bool value)
+    {
+        m_asyncWriteEnabled = value;
+    }
+
+    bool genGetAsyncWriteEnabled() const
+    {
+        return m_asyncWriteEnabled;
+    }
+
+    void genSetWriteIfChangedEnabled(bool value)
+    {
+        m_writeIfChangedEnabled = value;
+    }
+
+    bool genGetWriteIfChangedEnabled() const
+    {
+        return m_writeIfChangedEnabled;
+    }
+
+    GenOutputSink& genOutputSink() const
+    {
+        if (!m_outputSink) {
+            auto sink = std::make_unique<GenFsOutputSink>(m_outputDir);
+            sink->genSetWriteIfChanged(m_writeIfChangedEnabled);
+            m_outputSink = std::move(sink);
+        }
+
+        return *m_outputSink;
+    }
+
+    std::string genOutputRelPath(const std::string& path) const
+    {
+        if (m_outputDir.empty() || (!util::genStrStartsWith(path, m_outputDir))) {
+            return path;
+        }
+
+        auto pos = m_outputDir.size();
+        while ((pos < path.size()) && ((path[pos] == '/') || (path[pos] == fs::path::preferred_separator))) {
+            ++pos;
+        }
+
+        if ((pos == m_outputDir.size()) && (pos < path.size())) {
+            // Common prefix is not a directory
+            return path;
+        }
+
+        return path.substr(pos);
+    }
+
     void genSetCodeDir(const std::string& dir)
     {
         m_codeDir = dir;
@@ -276,7 +338,7 @@ public:
 
     bool genGetMultipleSchemasEnabled() const
     {
-        return m_protocol.parseGetMultipleSchemasEnabled();
+        return genProtocol().parseGetMultipleSchemasEnabled();
     }
 
     void genSetVersionIndependentCodeForced(bool value)
@@ -289,6 +351,16 @@ public:
         return m_versionIndependentCodeForced;
     }
 
+    void genSetMissingFieldsDropped(bool value)
+    {
+        m_missingFieldsDropped = value;
+    }
+
+    bool genGetMissingFieldsDropped() const
+    {
+        return m_missingFieldsDropped;
+    }
+
     void genSetCodeInjectCommentsRequested(bool value)
     {
         m_codeInjectCommentsRequested = value;
@@ -401,7 +473,20 @@ public:
             return false;
         }
 
-        auto allSchemas = m_protocol.parseSchemas();
+        return genPrepareFromProtocolInternal(m_protocol, createCompleteCb);
+    }
+
+    bool genPrepare(const commsdsl::parse::ParseProtocol& protocol, CreateCompleteFunc createCompleteCb = CreateCompleteFunc())
+    {
+        // The protocol has been parsed and validated externally,
+        // is expected to outlive the generator.
+        m_externalProtocol = &protocol;
+        return genPrepareFromProtocolInternal(protocol, createCompleteCb);
+    }
+
+    bool genPrepareFromProtocolInternal(const commsdsl::parse::ParseProtocol& protocol, CreateCompleteFunc createCompleteCb)
+    {
+        auto allSchemas = protocol.parseSchemas();
         if (allSchemas.empty()) {
             m_logger->genError("No schemas available");
             return false;
@@ -492,8 +577,22 @@ public:
         m_createdDirectories.push_back(path);
     }
 
+    void genRecordWrittenFile(const std::string& path) const
+    {
+        m_writtenFiles.push_back(path);
+    }
+
+    const GenGenerator::GenFilesList& genWrittenFiles() const
+    {
+        return m_writtenFiles;
+    }
+
     const commsdsl::parse::ParseProtocol& genProtocol() const
     {
+        if (m_externalProtocol != nullptr) {
+            return *m_externalProtocol;
+        }
+
         return m_protocol;
     }
 
@@ -667,6 +766,7 @@ private:
 
     GenGenerator& m_generator;
     commsdsl::parse::ParseProtocol m_protocol;
+    const commsdsl::parse::ParseProtocol* m_externalProtocol = nullptr;
     GenLoggerPtr m_logger;
     GenSchemasList m_schemas;
     GenSchema* m_currentSchema = nullptr;
@@ -682,8 +782,13 @@ private:
     std::string m_forcedPlatform;
     std::string m_forcedInterfaceName;
     mutable std::vector<std::string> m_createdDirectories;
+    mutable GenGenerator::GenFilesList m_writtenFiles;
+    mutable GenOutputSinkPtr m_outputSink;
     bool m_versionIndependentCodeForced = false;
+    bool m_missingFieldsDropped = false;
     bool m_codeInjectCommentsRequested = false;
+    bool m_asyncWriteEnabled = false;
+    bool m_writeIfChangedEnabled = false;
 };
 
 GenGenerator::GenGenerator() :
@@ -723,6 +828,30 @@ int GenGenerator::genExec(const GenProgramOptions& options)
     return 0;
 }
 
+int GenGenerator::genExec(const GenProgramOptions& options, const ParseProtocol& protocol)
+{
+    auto optsResult = genProcessOptions(options);
+    if (optsResult == commsdsl::gen::GenGenerator::OptsProcessResult_EarlyExit) {
+        return 0;
+    }
+
+    if (optsResult == commsdsl::gen::GenGenerator::OptsProcessResult_Failure) {
+        return -1;
+    }
+
+    if (!genPrepare(protocol)) {
+        genLogger().genError("Failed to prepare data structures for code generation");
+        return -1;
+    }
+
+    if (!genWrite()) {
+        genLogger().genError("Code generation failed");
+        return -2;
+    }
+
+    return 0;
+}
+
 void GenGenerator::genForceSchemaVersion(unsigned value)
 {
     m_impl->genForceSchemaVersion(value);
@@ -854,6 +983,16 @@ bool GenGenerator::genGetVersionIndependentCodeForced() const
     return m_impl->genGetVersionIndependentCodeForced();
 }
 
+void GenGenerator::genSetMissingFieldsDropped(bool value)
+{
+    m_impl->genSetMissingFieldsDropped(value);
+}
+
+bool GenGenerator::genGetMissingFieldsDropped() const
+{
+    return m_impl->genGetMissingFieldsDropped();
+}
+
 void GenGenerator::genSetCodeInjectCommentsRequested(bool value)
 {
     m_impl->genSetCodeInjectCommentsRequested(value);
@@ -1062,18 +1201,45 @@ bool GenGenerator::genPrepare(const GenFilesList& files)
     return genPrepareImpl();
 }
 
+bool GenGenerator::genPrepare(const ParseProtocol& protocol)
+{
+    // Make sure the logger is created
+    [[maybe_unused]] auto& l = genLogger();
+
+    auto createCompleteFunc =
+        [this]()
+        {
+            return genCreateCompleteImpl();
+        };
+
+    if (!m_impl->genPrepare(protocol, createCompleteFunc)) {
+        return false;
+    }
+
+    return genPrepareImpl();
+}
+
 bool GenGenerator::genWrite()
 {
+    if (m_impl->genGetAsyncWriteEnabled() && (dynamic_cast<GenAsyncOutputSink*>(&m_impl->genOutputSink()) == nullptr)) {
+        m_impl->genSetOutputSink(std::make_unique<GenAsyncOutputSink>(m_impl->genReleaseOutputSink()));
+    }
+
     auto& outDir = genGetOutputDir();
     if ((!outDir.empty()) && (!genCreateDirectory(outDir))) {
         return false;
     }
 
-    if (!m_impl->genWrite()) {
+    bool result = m_impl->genWrite() && genWriteImpl();
+
+    // Finalize the output even on failure to report all the pending write errors
+    auto& sink = m_impl->genOutputSink();
+    if (!sink.genFinalize()) {
+        genLogger().genError("Failed to finalize the output: " + sink.genLastError());
         return false;
     }
 
-    return genWriteImpl();
+    return result;
 }
 
 bool GenGenerator::genDoesElementExist(
@@ -1097,6 +1263,15 @@ bool GenGenerator::genIsElementDeprecated(unsigned deprecatedSince) const
     return genCurrentSchema().genIsElementDeprecated(deprecatedSince);
 }
 
+bool GenGenerator::genIsFieldDropped(const ParseField& parseObj) const
+{
+    if (!genGetMissingFieldsDropped()) {
+        return false;
+    }
+
+    return !genDoesElementExist(parseObj.parseSinceVersion(), parseObj.parseDeprecatedSince(), parseObj.parseIsDeprecatedRemoved());
+}
+
 GenLogger& GenGenerator::genLogger()
 {
     auto& loggerPtr = m_impl->genGetLogger();
@@ -1323,22 +1498,63 @@ bool GenGenerator::genCreateDirectory(const std::string& path) const
         return true;
     }
 
-    std::error_code ec;
-    if (fs::is_directory(path, ec)) {
-        m_impl->genRecordCreatedDirectory(path);
-        return true;
+    auto& sink = m_impl->genOutputSink();
+    if (!sink.genCreateDirectory(m_impl->genOutputRelPath(path))) {
+        genLogger().genError(sink.genLastError());
+        return false;
     }
 
-    fs::create_directories(path, ec);
-    if (ec) {
-        genLogger().genError("Failed to genCreate directory \"" + path + "\" with error: " + ec.message());
+    m_impl->genRecordCreatedDirectory(path);
+    return true;
+}
+
+bool GenGenerator::genWriteFile(const std::string& path, std::string contents) const
+{
+    auto& sink = m_impl->genOutputSink();
+    if (!sink.genWriteFile(m_impl->genOutputRelPath(path), std::move(contents))) {
+        genLogger().genError(sink.genLastError());
         return false;
     }
 
-    m_impl->genRecordCreatedDirectory(path);
+    m_impl->genRecordWrittenFile(path);
     return true;
 }
 
+const GenGenerator::GenFilesList& GenGenerator::genWrittenFiles() const
+{
+    return m_impl->genWrittenFiles();
+}
+
+void GenGenerator::genSetOutputSink(GenOutputSinkPtr sink)
+{
+    m_impl->genSetOutputSink(std::move(sink));
+}
+
+GenOutputSink& GenGenerator::genOutputSink() const
+{
+    return m_impl->genOutputSink();
+}
+
+void GenGenerator::genSetAsyncWriteEnabled(bool value)
+{
+    m_impl->genSetAsyncWriteEnabled(value);
+}
+
+bool GenGenerator::genGetAsyncWriteEnabled() const
+{
+    return m_impl->genGetAsyncWriteEnabled();
+}
+
+void GenGenerator::genSetWriteIfChangedEnabled(bool value)
+{
+    m_impl->genSetWriteIfChangedEnabled(value);
+}
+
+bool GenGenerator::genGetWriteIfChangedEnabled() const
+{
+    return m_impl->genGetWriteIfChangedEnabled();
+}
+
 void GenGenerator::genReferenceAllMessages()
 {
     m_impl->genReferenceAllMessages();
@@ -1392,6 +1608,16 @@ GenGenerator::OptsProcessResult GenGenerator::genProcessOptions(const GenProgram
     }
 
     genSetOutputDir(options.genGetOutputDirectory());
+    auto& outputArchive = options.genGetOutputArchive();
+    if ((!outputArchive.empty()) && options.genWatchRequested()) {
+        logger.genError("Cannot use both --output-archive and --watch options at the same time");
+        return OptsProcessResult_Failure;
+    }
+
+    if (!outputArchive.empty()) {
+        genSetOutputSink(std::make_unique<GenArchiveOutputSink>(outputArchive));
+    }
+
     genSetCodeDir(options.genGetCodeInputDirectory());
     genSetMultipleSchemasEnabled(options.genMultipleSchemasEnabled());
     genSetMinRemoteVersion(options.genGetMinRemoteVersion());
@@ -1400,6 +1626,10 @@ GenGenerator::OptsProcessResult GenGenerator::genProcessOptions(const GenProgram
     genSetForcedPlatform(options.genForcedPlatform());
     genSetForcedInterface(options.genForcedInterface());
     genSetCodeInjectCommentsRequested(options.genCodeInjectComments());
+    genSetAsyncWriteEnabled(options.genAsyncWriteRequested());
+    if (options.genWatchRequested()) {
+        genSetWriteIfChangedEnabled();
+    }
 
     return genProcessOptionsImpl(options);
 }
@@ -1676,35 +1906,21 @@ bool GenGenerator::genCopyExtraSourceFiles(const std::vector<std::string>& reser
             return false;
         }
 
-        std::error_code ec;
-        fs::copy_file(srcPath, destPath, fs::copy_options::overwrite_existing, ec);
-        if (ec) {
-            genLogger().genError("Failed to copy with reason: " + ec.message());
+        std::ifstream stream(srcPath, std::ios_base::binary);
+        if (!stream) {
+            genLogger().genError("Failed to open " + srcPath.string() + " for reading.");
             return false;
         }
 
+        std::string content((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
         if (protSchema.genMainNamespace() != schemaNs) {
             // The namespace has changed
-
-            auto destStr = destPath.string();
-            std::ifstream stream(destStr);
-            if (!stream) {
-                genLogger().genError("Failed to open " + destStr + " for modification.");
-                return false;
-            }
-
-            std::string content((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
-            stream.close();
-
             content = util::genStrReplace(content, "namespace " + schemaNs, "namespace " + protSchema.genMainNamespace());
-            std::ofstream outStream(destStr, std::ios_base::trunc);
-            if (!outStream) {
-                genLogger().genError("Failed to modify " + destStr + ".");
-                return false;
-            }
+            genLogger().genInfo("Updated " + destPath.string() + " to have proper main namespace.");
+        }
 
-            outStream << content;
-            genLogger().genInfo("Updated " + destStr + " to have proper main namespace.");
+        if (!genWriteFile(destPath.string(), std::move(content))) {
+            return false;
         }
     }
     return true;
@@ -61,6 +61,10 @@ public:
         auto fields = m_parseObj.parseFields();
         m_fields.reserve(fields.size());
         for (auto& parseObj : fields) {
+            if (m_generator.genIsFieldDropped(parseObj)) {
+                continue;
+            }
+
             auto ptr = GenField::genCreate(m_generator, parseObj, m_parent);
             assert(ptr);
             m_fields.push_back(std::move(ptr));
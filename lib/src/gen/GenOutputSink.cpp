@@ -0,0 +1,547 @@
+//
+// Copyright 2025 - 2025 (C). Alex Robenko. All rights reserved.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "commsdsl/gen/GenOutputSink.h"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <condition_variable>
+#include <cstdint>
+#include <ctime>
+#include <deque>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <mutex>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+namespace commsdsl
+{
+
+namespace gen
+{
+
+namespace
+{
+
+const std::size_t GenTarBlockSize = 512U;
+
+using GenTarBlock = std::array<char, GenTarBlockSize>;
+
+void genTarPutStr(GenTarBlock& block, std::size_t offset, std::size_t len, const std::string& value)
+{
+    assert(value.size() <= len);
+    std::copy_n(value.begin(), std::min(len, value.size()), block.begin() + static_cast<std::ptrdiff_t>(offset));
+}
+
+void genTarPutOctal(GenTarBlock& block, std::size_t offset, std::size_t len, std::uintmax_t value)
+{
+    // Zero padded octal value terminated by NUL
+    assert(1U < len);
+    auto pos = offset + len - 1U;
+    block[pos] = '\0';
+    while (offset < pos) {
+        --pos;
+        block[pos] = static_cast<char>('0' + (value & 0x7));
+        value >>= 3U;
+    }
+}
+
+GenTarBlock genTarHeader(const std::string& name, std::size_t size, char type, const std::string& prefix = std::string())
+{
+    // Offsets are according to the POSIX ustar format
+    GenTarBlock block;
+    block.fill('\0');
+    genTarPutStr(block, 0, 100, name);
+    genTarPutOctal(block, 100, 8, 0644);
+    genTarPutOctal(block, 108, 8, 0);
+    genTarPutOctal(block, 116, 8, 0);
+    genTarPutOctal(block, 124, 12, size);
+    genTarPutOctal(block, 136, 12, static_cast<std::uintmax_t>(std::time(nullptr)));
+    block[156] = type;
+    genTarPutStr(block, 257, 6, std::string("ustar", 6));
+    genTarPutStr(block, 263, 2, "00");
+    genTarPutStr(block, 345, 155, prefix);
+
+    std::fill_n(block.begin() + 148, 8, ' ');
+    std::uintmax_t checksum = 0U;
+    for (auto ch : block) {
+        checksum += static_cast<std::uint8_t>(ch);
+    }
+
+    genTarPutOctal(block, 148, 7, checksum);
+    return block;
+}
+
+} // namespace
+
+GenOutputSink::~GenOutputSink() = default;
+
+bool GenOutputSink::genCreateDirectory(const std::string& relPath)
+{
+    return genCreateDirectoryImpl(relPath);
+}
+
+bool GenOutputSink::genWriteFile(const std::string& relPath, std::string contents)
+{
+    return genWriteFileImpl(relPath, std::move(contents));
+}
+
+bool GenOutputSink::genFinalize()
+{
+    return genFinalizeImpl();
+}
+
+bool GenOutputSink::genCreateDirectoryImpl([[maybe_unused]] const std::string& relPath)
+{
+    // Directories are implicit in the file paths by default
+    return true;
+}
+
+bool GenOutputSink::genFinalizeImpl()
+{
+    return true;
+}
+
+void GenOutputSink::genSetLastError(const std::string& msg)
+{
+    m_lastError = msg;
+}
+
+GenFsOutputSink::GenFsOutputSink(const std::string& rootDir) :
+    m_rootDir(rootDir)
+{
+}
+
+bool GenFsOutputSink::genCreateDirectoryImpl(const std::string& relPath)
+{
+    auto path = genAbsPath(relPath);
+    std::error_code ec;
+    if (fs::is_directory(path, ec)) {
+        return true;
+    }
+
+    fs::create_directories(path, ec);
+    if (ec) {
+        genSetLastError("Failed to create directory \"" + path + "\": " + ec.message());
+        return false;
+    }
+
+    return true;
+}
+
+bool GenFsOutputSink::genWriteFileImpl(const std::string& relPath, std::string contents)
+{
+    auto path = genAbsPath(relPath);
+    if (m_writeIfChanged && genIsSameContents(path, contents)) {
+        return true;
+    }
+
+    std::ofstream stream(path, std::ios_base::binary | std::ios_base::trunc);
+    if (!stream) {
+        genSetLastError("Failed to open \"" + path + "\" for writing.");
+        return false;
+    }
+
+    stream.write(contents.data(), static_cast<std::streamsize>(contents.size()));
+    stream.flush();
+    if (!stream.good()) {
+        genSetLastError("Failed to write \"" + path + "\".");
+        return false;
+    }
+
+    return true;
+}
+
+std::string GenFsOutputSink::genAbsPath(const std::string& relPath) const
+{
+    if (m_rootDir.empty()) {
+        return relPath;
+    }
+
+    return (fs::path(m_rootDir) / relPath).string();
+}
+
+bool GenFsOutputSink::genIsSameContents(const std::string& path, const std::string& contents) const
+{
+    std::error_code ec;
+    auto size = fs::file_size(path, ec);
+    if (ec || (size != contents.size())) {
+        return false;
+    }
+
+    std::ifstream stream(path, std::ios_base::binary);
+    if (!stream) {
+        return false;
+    }
+
+    std::string existing(std::istreambuf_iterator<char>(stream), (std::istreambuf_iterator<char>()));
+    return existing == contents;
+}
+
+GenMemOutputSink::GenFilesMap GenMemOutputSink::genReleaseFiles()
+{
+    return std::move(m_files);
+}
+
+bool GenMemOutputSink::genWriteFileImpl(const std::string& relPath, std::string contents)
+{
+    m_files[relPath] = std::move(contents);
+    return true;
+}
+
+class GenArchiveOutputSinkImpl
+{
+public:
+    explicit GenArchiveOutputSinkImpl(const std::string& archivePath) :
+        m_archivePath(archivePath)
+    {
+    }
+
+    bool genWriteFile(const std::string& relPath, const std::string& contents)
+    {
+        if (!genOpen()) {
+            return false;
+        }
+
+        auto name = fs::path(relPath).generic_string();
+        std::string prefix;
+        if (100U < name.size()) {
+            // Try to split the path between "prefix" and "name" ustar fields first.
+            auto sepPos = name.find('/', name.size() - 101U);
+            if ((sepPos != std::string::npos) && (sepPos <= 155U) && (0U < sepPos)) {
+                prefix = name.substr(0, sepPos);
+                name = name.substr(sepPos + 1U);
+            }
+        }
+
+        if (100U < name.size()) {
+            // Use GNU long name extension, supported by all the common tar implementations
+            static const std::string LongLinkName("././@LongLink");
+            auto longName = name + '\0';
+            genWriteBlock(genTarHeader(LongLinkName, longName.size(), 'L'));
+            genWriteData(longName);
+            name.resize(100U);
+        }
+
+        genWriteBlock(genTarHeader(name, contents.size(), '0', prefix));
+        genWriteData(contents);
+        return m_stream.good();
+    }
+
+    bool genFinalize()
+    {
+        if (!genOpen()) {
+            return false;
+        }
+
+        // End of archive is marked by two zeroed blocks
+        GenTarBlock block;
+        block.fill('\0');
+        genWriteBlock(block);
+        genWriteBlock(block);
+        m_stream.flush();
+        bool result = m_stream.good();
+        m_stream.close();
+        m_finalized = true;
+        return result;
+    }
+
+    bool genIsOpen() const
+    {
+        return m_stream.is_open();
+    }
+
+    const std::string& genArchivePath() const
+    {
+        return m_archivePath;
+    }
+
+private:
+    bool genOpen()
+    {
+        if (m_stream.is_open()) {
+            return m_stream.good();
+        }
+
+        if (m_finalized) {
+            return false;
+        }
+
+        auto parentDir = fs::path(m_archivePath).parent_path();
+        if (!parentDir.empty()) {
+            std::error_code ec;
+            fs::create_directories(parentDir, ec);
+        }
+
+        m_stream.open(m_archivePath, std::ios_base::binary | std::ios_base::trunc);
+        return static_cast<bool>(m_stream);
+    }
+
+    void genWriteBlock(const GenTarBlock& block)
+    {
+        m_stream.write(block.data(), static_cast<std::streamsize>(block.size()));
+    }
+
+    void genWriteData(const std::string& data)
+    {
+        m_stream.write(data.data(), static_cast<std::streamsize>(data.size()));
+        auto rem = data.size() % GenTarBlockSize;
+        if (rem == 0U) {
+            return;
+        }
+
+        static const GenTarBlock Padding = {};
+        m_stream.write(Padding.data(), static_cast<std::streamsize>(GenTarBlockSize - rem));
+    }
+
+    std::string m_archivePath;
+    std::ofstream m_stream;
+    bool m_finalized = false;
+};
+
+GenArchiveOutputSink::GenArchiveOutputSink(const std::string& archivePath) :
+    m_impl(std::make_unique<GenArchiveOutputSinkImpl>(archivePath))
+{
+}
+
+GenArchiveOutputSink::~GenArchiveOutputSink()
+{
+    if (m_impl->genIsOpen()) {
+        // Don't leave truncated archive behind
+        m_impl->genFinalize();
+    }
+}
+
+bool GenArchiveOutputSink::genWriteFileImpl(const std::string& relPath, std::string contents)
+{
+    if (!m_impl->genWriteFile(relPath, contents)) {
+        genSetLastError("Failed to write \"" + relPath + "\" into \"" + m_impl->genArchivePath() + "\".");
+        return false;
+    }
+
+    return true;
+}
+
+bool GenArchiveOutputSink::genFinalizeImpl()
+{
+    if (!m_impl->genFinalize()) {
+        genSetLastError("Failed to finalize \"" + m_impl->genArchivePath() + "\".");
+        return false;
+    }
+
+    return true;
+}
+
+class GenAsyncOutputSinkImpl
+{
+public:
+    GenAsyncOutputSinkImpl(GenOutputSinkPtr sink, std::size_t queueCapacity) :
+        m_sink(std::move(sink)),
+        m_queueCapacity(std::max(queueCapacity, std::size_t(1U)))
+    {
+        assert(m_sink);
+    }
+
+    ~GenAsyncOutputSinkImpl()
+    {
+        genStop();
+    }
+
+    GenOutputSink& genSink()
+    {
+        return *m_sink;
+    }
+
+    GenOutputSinkPtr genReleaseSink()
+    {
+        genStop();
+        return std::move(m_sink);
+    }
+
+    bool genPush(bool isDir, const std::string& relPath, std::string contents)
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        if (!m_errors.empty()) {
+            return false;
+        }
+
+        if (!m_thread.joinable()) {
+            m_stopRequested = false;
+            m_thread = std::thread([this]() { genRun(); });
+        }
+
+        m_queueCond.wait(
+            lock,
+            [this]()
+            {
+                return m_queue.size() < m_queueCapacity;
+            });
+
+        m_queue.push_back(Op{isDir, relPath, std::move(contents)});
+        m_workCond.notify_one();
+        return true;
+    }
+
+    bool genFinalize(std::string& errors)
+    {
+        genStop();
+
+        if (!m_sink->genFinalize()) {
+            m_errors.push_back(m_sink->genLastError());
+        }
+
+        for (auto& e : m_errors) {
+            if (!errors.empty()) {
+                errors += '\n';
+            }
+
+            errors += e;
+        }
+
+        bool result = m_errors.empty();
+        m_errors.clear();
+        return result;
+    }
+
+private:
+    struct Op
+    {
+        bool m_isDir = false;
+        std::string m_relPath;
+        std::string m_contents;
+    };
+
+    void genRun()
+    {
+        while (true) {
+            Op op;
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_workCond.wait(
+                    lock,
+                    [this]()
+                    {
+                        return m_stopRequested || (!m_queue.empty());
+                    });
+
+                if (m_queue.empty()) {
+                    assert(m_stopRequested);
+                    return;
+                }
+
+                op = std::move(m_queue.front());
+                m_queue.pop_front();
+                m_queueCond.notify_one();
+            }
+
+            bool result = false;
+            if (op.m_isDir) {
+                result = m_sink->genCreateDirectory(op.m_relPath);
+            }
+            else {
+                result = m_sink->genWriteFile(op.m_relPath, std::move(op.m_contents));
+            }
+
+            if (!result) {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_errors.push_back(m_sink->genLastError());
+            }
+        }
+    }
+
+    void genStop()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stopRequested = true;
+            m_workCond.notify_one();
+        }
+
+        if (m_thread.joinable()) {
+            m_thread.join();
+        }
+    }
+
+    GenOutputSinkPtr m_sink;
+    std::size_t m_queueCapacity = 0U;
+    std::thread m_thread;
+    std::mutex m_mutex;
+    std::condition_variable m_workCond;
+    std::condition_variable m_queueCond;
+    std::deque<Op> m_queue;
+    std::vector<std::string> m_errors;
+    bool m_stopRequested = false;
+};
+
+GenAsyncOutputSink::GenAsyncOutputSink(GenOutputSinkPtr sink, std::size_t queueCapacity) :
+    m_impl(std::make_unique<GenAsyncOutputSinkImpl>(std::move(sink), queueCapacity))
+{
+}
+
+GenAsyncOutputSink::~GenAsyncOutputSink() = default;
+
+GenOutputSink& GenAsyncOutputSink::genWrappedSink()
+{
+    return m_impl->genSink();
+}
+
+GenOutputSinkPtr GenAsyncOutputSink::genReleaseWrappedSink()
+{
+    return m_impl->genReleaseSink();
+}
+
+bool GenAsyncOutputSink::genCreateDirectoryImpl(const std::string& relPath)
+{
+    if (!m_impl->genPush(true, relPath, std::string())) {
+        genSetLastError("Skipped creation of \"" + relPath + "\" due to previous failures.");
+        return false;
+    }
+
+    return true;
+}
+
+bool GenAsyncOutputSink::genWriteFileImpl(const std::string& relPath, std::string contents)
+{
+    // The contents are moved all the way into the queue, no copies on the generation thread
+    if (!m_impl->genPush(false, relPath, std::move(contents))) {
+        genSetLastError("Skipped writing of \"" + relPath + "\" due to previous failures.");
+        return false;
+    }
+
+    return true;
+}
+
+bool GenAsyncOutputSink::genFinalizeImpl()
+{
+    std::string errors;
+    if (!m_impl->genFinalize(errors)) {
+        genSetLastError(errors);
+        return false;
+    }
+
+    return true;
+}
+
+} // namespace gen
+
+} // namespace commsdsl
@@ -32,6 +32,9 @@ const std::string GenWarnAsErrStr("warn-as-err");
 const std::string GenFullWarnAsErrStr("w," + GenWarnAsErrStr);
 const std::string GenOutputDirStr("output-dir");
 const std::string GenFullOutputDirStr("o," + GenOutputDirStr);
+const std::string GenOutputArchiveStr("output-archive");
+const std::string GenAsyncWriteStr("async-write");
+const std::string GenWatchStr("watch");
 const std::string GenInputFilesListStr("input-files-list");
 const std::string GenFullInputFilesListStr("i," + GenInputFilesListStr);
 const std::string GenInputFilesPrefixStr("input-files-prefix");
@@ -353,6 +356,16 @@ GenProgramOptions& GenProgramOptions::genAddCommonOptions()
             (GenFullDebugStr, "Show debug logging.")
             (GenFullWarnAsErrStr, "Treat warnings as errors.")
             (GenFullOutputDirStr, "Output directory path. When not provided current is used.", true)
+            (GenOutputArchiveStr,
+                "Path to the tar archive to store all the generated files instead of writing them "
+                "into the output directory.", true)
+            (GenAsyncWriteStr,
+                "Perform file system writes on a separate background thread, "
+                "while the generation of the following files continues.")
+            (GenWatchStr,
+                "Keep running after the code generation, watch the schema files and the code input "
+                "directory for changes and regenerate the code. Only the modified output files are "
+                "rewritten.")
             (GenFullInputFilesListStr, "File containing list of input files.", true)
             (GenFullInputFilesPrefixStr, "Prefix for the values from the list file.", true)
             (GenFullCodeInputDirStr, "Directory with code updates.", true)
@@ -481,6 +494,21 @@ const std::string& GenProgramOptions::genGetOutputDirectory() const
     return genValue(GenOutputDirStr);
 }
 
+const std::string& GenProgramOptions::genGetOutputArchive() const
+{
+    return genValue(GenOutputArchiveStr);
+}
+
+bool GenProgramOptions::genAsyncWriteRequested() const
+{
+    return genIsOptUsed(GenAsyncWriteStr);
+}
+
+bool GenProgramOptions::genWatchRequested() const
+{
+    return genIsOptUsed(GenWatchStr);
+}
+
 GenProgramOptions::GenStringsList GenProgramOptions::genGetInputFiles() const
 {
     std::vector<std::string> result;
@@ -0,0 +1,542 @@
+//
+// Copyright 2025 - 2025 (C). Alex Robenko. All rights reserved.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "commsdsl/gen/GenWatcher.h"
+
+#include "commsdsl/gen/GenLogger.h"
+#include "commsdsl/parse/ParseProtocol.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <map>
+#include <set>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#ifdef __linux__
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif // #ifdef __linux__
+
+namespace fs = std::filesystem;
+
+namespace commsdsl
+{
+
+namespace gen
+{
+
+namespace
+{
+
+// Editors usually produce several events for a single save,
+// wait for them to settle before the regeneration.
+const std::chrono::milliseconds GenSettleDuration(200);
+const std::chrono::milliseconds GenPollInterval(500);
+
+std::string genNormalizedPath(const std::string& path)
+{
+    std::error_code ec;
+    auto result = fs::absolute(path, ec);
+    if (ec) {
+        return path;
+    }
+
+    return result.lexically_normal().string();
+}
+
+bool genIsInsideDir(const std::string& path, const std::string& dir)
+{
+    if (dir.empty() || (path.size() <= dir.size()) || (path.compare(0, dir.size(), dir) != 0)) {
+        return false;
+    }
+
+    return (path[dir.size()] == '/') || (path[dir.size()] == fs::path::preferred_separator);
+}
+
+} // namespace
+
+class GenWatcherImpl
+{
+public:
+    using GenCreateGeneratorFunc = GenWatcher::GenCreateGeneratorFunc;
+
+    explicit GenWatcherImpl(GenCreateGeneratorFunc&& createFunc) :
+        m_createFunc(std::move(createFunc))
+    {
+        assert(m_createFunc);
+    }
+
+    ~GenWatcherImpl()
+    {
+#ifdef __linux__
+        if (0 <= m_fd) {
+            ::close(m_fd);
+        }
+#endif // #ifdef __linux__
+    }
+
+    int genExec(const GenProgramOptions& options)
+    {
+        if (options.genHelpRequested() || options.genVersionRequested() || (!options.genWatchRequested())) {
+            auto generator = m_createFunc();
+            return generator->genExec(options);
+        }
+
+        genCreateLogger(options);
+        if (options.genQuietRequested() && options.genDebugRequested()) {
+            m_logger->genError("Cannot use both --quiet and --debug options at the same time");
+            return -1;
+        }
+
+        auto files = options.genGetInputFiles();
+        if (files.empty()) {
+            m_logger->genError("No input files are provided");
+            return -1;
+        }
+
+        for (auto& f : files) {
+            m_schemaPaths.insert(genNormalizedPath(f));
+        }
+
+        auto& codeDir = options.genGetCodeInputDirectory();
+        if (!codeDir.empty()) {
+            m_codeDir = genNormalizedPath(codeDir);
+        }
+
+        // Start monitoring before the initial generation to avoid missing the
+        // modifications performed while it is in progress.
+        genStartMonitor();
+
+        if (genParse(options, files)) {
+            genGenerate(options);
+        }
+
+        m_logger->genInfo("Watching for changes...");
+        while (true) {
+            GenPathsSet changed;
+            if (!genWaitForChanges(changed)) {
+                return -1;
+            }
+
+            bool schemaChanged =
+                std::any_of(
+                    changed.begin(), changed.end(),
+                    [this](auto& p)
+                    {
+                        return m_schemaPaths.find(p) != m_schemaPaths.end();
+                    });
+
+            bool codeChanged =
+                std::any_of(
+                    changed.begin(), changed.end(),
+                    [this](auto& p)
+                    {
+                        return (p == m_codeDir) || genIsInsideDir(p, m_codeDir);
+                    });
+
+            if ((!schemaChanged) && (!codeChanged)) {
+                continue;
+            }
+
+            if (schemaChanged) {
+                m_logger->genInfo("Schema files have been modified");
+                if (genParse(options, files)) {
+                    genGenerate(options);
+                }
+            }
+            else if (m_protocol) {
+                m_logger->genInfo("Code input directory has been modified");
+                genGenerate(options);
+            }
+
+            // On parse failure the previous valid model is kept
+            m_logger->genInfo("Watching for changes...");
+        }
+    }
+
+private:
+    using GenPathsSet = std::set<std::string>;
+    using GenProtocolPtr = std::unique_ptr<commsdsl::parse::ParseProtocol>;
+    using GenLoggerPtr = std::unique_ptr<GenLogger>;
+    using GenFileStamp = std::pair<fs::file_time_type, std::uintmax_t>;
+    using GenSnapshot = std::map<std::string, GenFileStamp>;
+
+    void genCreateLogger(const GenProgramOptions& options)
+    {
+        // The "had warning" state of the logger is not resettable,
+        // use new one for every parse.
+        m_logger = std::make_unique<GenLogger>();
+        if (options.genQuietRequested()) {
+            m_logger->genSetMinLevel(commsdsl::parse::ParseErrorLevel_Warning);
+        }
+
+        if (options.genDebugRequested()) {
+            m_logger->genSetMinLevel(commsdsl::parse::ParseErrorLevel_Debug);
+        }
+
+        if (options.genWarnAsErrRequested()) {
+            m_logger->genSetWarnAsError();
+        }
+    }
+
+    bool genParse(const GenProgramOptions& options, const GenProgramOptions::GenStringsList& files)
+    {
+        genCreateLogger(options);
+
+        auto protocol = std::make_unique<commsdsl::parse::ParseProtocol>();
+        protocol->parseSetMultipleSchemasEnabled(options.genMultipleSchemasEnabled());
+        protocol->parseSetErrorReportCallback(
+            [this](commsdsl::parse::ParseErrorLevel level, const std::string& msg)
+            {
+                assert(m_logger);
+                m_logger->genLog(level, msg);
+            });
+
+        for (auto& f : files) {
+            m_logger->genInfo("Parsing " + f);
+            if (!protocol->parse(f)) {
+                return false;
+            }
+
+            if (m_logger->genHadWarning()) {
+                m_logger->genError("Warning treated as error");
+                return false;
+            }
+        }
+
+        if (!protocol->parseValidate()) {
+            return false;
+        }
+
+        if (m_logger->genHadWarning()) {
+            m_logger->genError("Warning treated as error");
+            return false;
+        }
+
+        m_protocol = std::move(protocol);
+        return true;
+    }
+
+    void genGenerate(const GenProgramOptions& options)
+    {
+        assert(m_protocol);
+        auto generator = m_createFunc();
+        if (generator->genExec(options, *m_protocol) != 0) {
+            return;
+        }
+
+        GenPathsSet writtenFiles;
+        for (auto& f : generator->genWrittenFiles()) {
+            writtenFiles.insert(genNormalizedPath(f));
+        }
+
+        if (m_hasWrittenFiles) {
+            genRemoveStaleFiles(writtenFiles, genNormalizedPath(options.genGetOutputDirectory()));
+        }
+
+        m_writtenFiles = std::move(writtenFiles);
+        m_hasWrittenFiles = true;
+        m_logger->genInfo("Code generation is complete");
+    }
+
+    void genRemoveStaleFiles(const GenPathsSet& writtenFiles, const std::string& outputDir)
+    {
+        for (auto& f : m_writtenFiles) {
+            if (writtenFiles.find(f) != writtenFiles.end()) {
+                continue;
+            }
+
+            m_logger->genInfo("Removing stale " + f);
+            std::error_code ec;
+            fs::remove(f, ec);
+            if (ec) {
+                m_logger->genWarning("Failed to remove \"" + f + "\": " + ec.message());
+                continue;
+            }
+
+            // Remove the directories left empty, but never the output one
+            auto dir = fs::path(f).parent_path();
+            while (genIsInsideDir(dir.string(), outputDir) && fs::is_empty(dir, ec) && (!ec)) {
+                if (!fs::remove(dir, ec)) {
+                    break;
+                }
+
+                dir = dir.parent_path();
+            }
+        }
+    }
+
+    void genStartMonitor()
+    {
+#ifdef __linux__
+        m_fd = ::inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+        if (0 <= m_fd) {
+            genUpdateWatches();
+            return;
+        }
+
+        m_logger->genDebug("Failed to initialize inotify, using polling instead");
+#endif // #ifdef __linux__
+
+        m_snapshot = genTakeSnapshot();
+    }
+
+    bool genWaitForChanges(GenPathsSet& changed)
+    {
+#ifdef __linux__
+        if (0 <= m_fd) {
+            return genWaitForNotifications(changed);
+        }
+#endif // #ifdef __linux__
+
+        return genPollForChanges(changed);
+    }
+
+    GenPathsSet genWatchedDirs() const
+    {
+        GenPathsSet result;
+        for (auto& p : m_schemaPaths) {
+            result.insert(fs::path(p).parent_path().string());
+        }
+
+        if (m_codeDir.empty()) {
+            return result;
+        }
+
+        std::error_code ec;
+        if (!fs::is_directory(m_codeDir, ec)) {
+            return result;
+        }
+
+        result.insert(m_codeDir);
+        for (fs::recursive_directory_iterator iter(m_codeDir, ec), end; (!ec) && (iter != end); iter.increment(ec)) {
+            if (iter->is_directory(ec)) {
+                result.insert(iter->path().lexically_normal().string());
+            }
+        }
+
+        return result;
+    }
+
+#ifdef __linux__
+    void genUpdateWatches()
+    {
+        assert(0 <= m_fd);
+        static const std::uint32_t Mask =
+            IN_CLOSE_WRITE | IN_MOVED_TO | IN_MOVED_FROM | IN_CREATE | IN_DELETE;
+
+        auto dirs = genWatchedDirs();
+        for (auto& w : m_watches) {
+            dirs.erase(w.second);
+        }
+
+        for (auto& d : dirs) {
+            auto wd = ::inotify_add_watch(m_fd, d.c_str(), Mask);
+            if (wd < 0) {
+                m_logger->genWarning("Failed to watch directory \"" + d + "\"");
+                continue;
+            }
+
+            m_watches[wd] = d;
+        }
+    }
+
+    bool genWaitForNotifications(GenPathsSet& changed)
+    {
+        struct pollfd pfd = {};
+        pfd.fd = m_fd;
+        pfd.events = POLLIN;
+
+        int timeout = -1;
+        while (true) {
+            auto result = ::poll(&pfd, 1, timeout);
+            if ((result < 0) && (errno == EINTR)) {
+                continue;
+            }
+
+            if (result < 0) {
+                m_logger->genError("Failed to wait for file system notifications");
+                return false;
+            }
+
+            if (result == 0) {
+                break;
+            }
+
+            genReadNotifications(changed);
+            timeout = static_cast<int>(GenSettleDuration.count());
+        }
+
+        // New sub-directories could have been added
+        genUpdateWatches();
+        return true;
+    }
+
+    void genReadNotifications(GenPathsSet& changed)
+    {
+        alignas(struct inotify_event) char buf[4096];
+        while (true) {
+            auto len = ::read(m_fd, buf, sizeof(buf));
+            if (len <= 0) {
+                break;
+            }
+
+            std::size_t pos = 0U;
+            while (pos < static_cast<std::size_t>(len)) {
+                struct inotify_event event;
+                std::copy_n(&buf[pos], sizeof(event), reinterpret_cast<char*>(&event));
+                const char* name = &buf[pos + sizeof(event)];
+                pos += sizeof(event) + event.len;
+
+                if ((event.mask & IN_IGNORED) != 0U) {
+                    m_watches.erase(event.wd);
+                    continue;
+                }
+
+                auto iter = m_watches.find(event.wd);
+                if (iter == m_watches.end()) {
+                    continue;
+                }
+
+                auto path = iter->second;
+                if (0U < event.len) {
+                    path = (fs::path(path) / std::string(name)).string();
+                }
+
+                changed.insert(std::move(path));
+            }
+        }
+    }
+#endif // #ifdef __linux__
+
+    GenSnapshot genTakeSnapshot() const
+    {
+        GenSnapshot result;
+        auto addFileFunc =
+            [&result](const fs::path& path)
+            {
+                std::error_code ec;
+                auto time = fs::last_write_time(path, ec);
+                if (ec) {
+                    return;
+                }
+
+                auto size = fs::file_size(path, ec);
+                if (ec) {
+                    return;
+                }
+
+                result[path.lexically_normal().string()] = std::make_pair(time, size);
+            };
+
+        for (auto& p : m_schemaPaths) {
+            addFileFunc(p);
+        }
+
+        if (m_codeDir.empty()) {
+            return result;
+        }
+
+        std::error_code ec;
+        for (fs::recursive_directory_iterator iter(m_codeDir, ec), end; (!ec) && (iter != end); iter.increment(ec)) {
+            if (iter->is_regular_file(ec)) {
+                addFileFunc(iter->path());
+            }
+        }
+
+        return result;
+    }
+
+    static void genCompareSnapshots(const GenSnapshot& prev, const GenSnapshot& curr, GenPathsSet& changed)
+    {
+        for (auto& p : prev) {
+            auto iter = curr.find(p.first);
+            if ((iter == curr.end()) || (iter->second != p.second)) {
+                changed.insert(p.first);
+            }
+        }
+
+        for (auto& c : curr) {
+            if (prev.find(c.first) == prev.end()) {
+                changed.insert(c.first);
+            }
+        }
+    }
+
+    bool genPollForChanges(GenPathsSet& changed)
+    {
+        while (changed.empty()) {
+            std::this_thread::sleep_for(GenPollInterval);
+            auto snapshot = genTakeSnapshot();
+            genCompareSnapshots(m_snapshot, snapshot, changed);
+            m_snapshot = std::move(snapshot);
+        }
+
+        while (true) {
+            std::this_thread::sleep_for(GenSettleDuration);
+            auto snapshot = genTakeSnapshot();
+            GenPathsSet moreChanged;
+            genCompareSnapshots(m_snapshot, snapshot, moreChanged);
+            m_snapshot = std::move(snapshot);
+            if (moreChanged.empty()) {
+                break;
+            }
+
+            changed.insert(moreChanged.begin(), moreChanged.end());
+        }
+
+        return true;
+    }
+
+    GenCreateGeneratorFunc m_createFunc;
+    GenLoggerPtr m_logger;
+    GenProtocolPtr m_protocol;
+    GenPathsSet m_schemaPaths;
+    std::string m_codeDir;
+    GenSnapshot m_snapshot;
+    GenPathsSet m_writtenFiles;
+    bool m_hasWrittenFiles = false;
+#ifdef __linux__
+    int m_fd = -1;
+    std::map<int, std::string> m_watches;
+#endif // #ifdef __linux__
+};
+
+GenWatcher::GenWatcher(GenCreateGeneratorFunc&& createFunc) :
+    m_impl(std::make_unique<GenWatcherImpl>(std::move(createFunc)))
+{
+}
+
+GenWatcher::~GenWatcher() = default;
+
+int GenWatcher::genExec(const GenProgramOptions& options)
+{
+    return m_impl->genExec(options);
+}
+
+} // namespace gen
+
+} // namespace commsdsl
@@ -404,6 +404,12 @@ const std::string& genDataViewStr()
     return Str;
 }
 
+const std::string& genHighThroughputStr()
+{
+    static const std::string Str("HighThroughput");
+    return Str;
+}
+
 const std::string& genTransportMessageSuffixStr()
 {
     static const std::string Str("TransportMessage");